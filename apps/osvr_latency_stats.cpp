@@ -0,0 +1,145 @@
+/** @file
+    @brief Implementation
+
+    @date 2017
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2017 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include <osvr/ClientKit/Context.h>
+#include <osvr/ClientKit/Interface.h>
+#include <osvr/ClientKit/LatencyC.h>
+
+// Library/third-party includes
+#include <boost/program_options.hpp>
+
+// Standard includes
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+/// @brief Formats a duration in microseconds as milliseconds.
+static std::string toMs(int64_t usec) {
+    std::ostringstream os;
+    os << std::fixed << std::setprecision(2) << usec / 1000. << "ms";
+    return os.str();
+}
+
+int main(int argc, char *argv[]) {
+    std::vector<std::string> paths;
+    double interval;
+    namespace po = boost::program_options;
+    // clang-format off
+    po::options_description desc("Options");
+    desc.add_options()
+        ("help,h", "produce help message")
+        ("path,p", po::value<std::vector<std::string> >(&paths)->multitoken(), "Tracker path(s) to monitor (default: /me/head)")
+        ("interval,i", po::value<double>(&interval)->default_value(1.0), "Seconds between reports")
+        ;
+    // clang-format on
+    po::variables_map vm;
+    bool usage = false;
+    try {
+        po::store(po::command_line_parser(argc, argv).options(desc).run(), vm);
+        po::notify(vm);
+    } catch (std::exception &e) {
+        std::cerr << "\nError parsing command line: " << e.what() << "\n\n";
+        usage = true;
+    }
+    if (usage || vm.count("help") || interval <= 0) {
+        std::cerr << "\nPeriodically prints the rate of tracker reports "
+                     "arriving at a client, and\nhow old they are on arrival "
+                     "(p50/p99/max). Ages are only meaningful when\nthe "
+                     "server runs on the same machine (or a clock-synchronized "
+                     "one).\n";
+        std::cerr << "Usage: " << argv[0] << " [options]\n\n";
+        std::cerr << desc << "\n";
+        return 1;
+    }
+    if (paths.empty()) {
+        paths.push_back("/me/head");
+    }
+
+    osvr::clientkit::ClientContext context("org.osvr.tools.latencystats");
+    std::vector<osvr::clientkit::Interface> ifaces;
+    for (auto const &path : paths) {
+        ifaces.push_back(context.getInterface(path));
+    }
+
+    if (!context.checkStatus()) {
+        context.log(OSVR_LOGLEVEL_NOTICE,
+                    "Client context has not yet started up - waiting. "
+                    "Make sure the server is running.");
+        do {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            context.update();
+        } while (!context.checkStatus());
+        context.log(OSVR_LOGLEVEL_NOTICE,
+                    "OK, client context ready. Proceeding.");
+    }
+
+    /// Start clean, rather than counting whatever piled up during startup.
+    for (auto &iface : ifaces) {
+        osvrClientResetInterfaceLatencyStats(iface.get());
+    }
+
+    using clock = std::chrono::steady_clock;
+    auto const period = std::chrono::duration_cast<clock::duration>(
+        std::chrono::duration<double>(interval));
+    auto nextReport = clock::now() + period;
+    while (true) {
+        context.update();
+        if (clock::now() < nextReport) {
+            std::this_thread::sleep_for(std::chrono::microseconds(500));
+            continue;
+        }
+        nextReport += period;
+        for (std::size_t i = 0; i < ifaces.size(); ++i) {
+            OSVR_ReportLatencyStats stats;
+            if (OSVR_RETURN_SUCCESS !=
+                osvrClientGetInterfaceLatencyStats(ifaces[i].get(), &stats)) {
+                continue;
+            }
+            std::cout << std::setw(20) << std::left << paths[i] << std::right;
+            if (stats.reportCount == 0) {
+                std::cout << " no reports\n";
+            } else {
+                std::cout << " " << std::setw(5) << stats.reportCount
+                          << " reports, " << std::fixed << std::setprecision(1)
+                          << std::setw(7) << stats.reportRate << "Hz"
+                          << "  p50 " << toMs(stats.latencyP50) << "  p99 "
+                          << toMs(stats.latencyP99) << "  max "
+                          << toMs(stats.latencyMax);
+                if (stats.outOfOrderCount) {
+                    std::cout << "  (" << stats.outOfOrderCount
+                              << " out of order)";
+                }
+                std::cout << "\n";
+            }
+            osvrClientResetInterfaceLatencyStats(ifaces[i].get());
+        }
+        std::cout << std::flush;
+    }
+    return 0;
+}
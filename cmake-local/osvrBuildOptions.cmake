@@ -38,6 +38,7 @@ option(BUILD_WITH_OPENCV "Should we build the stock and example plugins and apps
 option(BUILD_HEADER_DEPENDENCY_TESTS "Should we add targets to ensure that every public header compiles cleanly on its own? Increases number of targets greatly..." ${OSVR_ON_UNLESS_SUBPROJECT})
 
 option(BUILD_ADVANCED_DEV_TOOLS "Should we build tools designed for core developers?" OFF)
+option(BUILD_BENCHMARKS "Should we build the osvr_benchmarks microbenchmark suite (only when tests are built)?" OFF)
 
 # Logging options
 option(BUILD_WITH_LOGGING_SINGLETON "Enable the logging singleton - required for optimal logging performance and logging to file." TRUE)
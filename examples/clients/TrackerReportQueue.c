@@ -0,0 +1,83 @@
+/** @file
+    @brief Implementation
+
+    @date 2017
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+/*
+// Copyright 2017 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+/* Internal Includes */
+#include <osvr/ClientKit/ContextC.h>
+#include <osvr/ClientKit/InterfaceC.h>
+#include <osvr/ClientKit/ReportQueueC.h>
+
+/* Library/third-party includes */
+/* - none */
+
+/* Standard includes */
+#include <stdio.h>
+
+#define MAX_REPORTS 64
+
+int main() {
+    OSVR_ClientContext ctx =
+        osvrClientInit("com.osvr.exampleclients.TrackerReportQueue", 0);
+
+    OSVR_ClientInterface lefthand = NULL;
+    osvrClientGetInterface(ctx, "/me/hands/left", &lefthand);
+
+    /* Ask for every pose report, not just the latest: they'll be kept for us
+     * between updates. */
+    osvrClientInterfaceSetPoseReportQueueCapacity(lefthand, MAX_REPORTS);
+
+    OSVR_TimeValue timestamps[MAX_REPORTS];
+    OSVR_PoseReport reports[MAX_REPORTS];
+
+    /* Pretend that this is your application's mainloop. */
+    int i;
+    for (i = 0; i < 1000000; ++i) {
+        osvrClientUpdate(ctx);
+
+        uint32_t numReports = 0;
+        uint32_t numDropped = 0;
+        osvrClientInterfaceDrainPoseReports(lefthand, timestamps, reports,
+                                            MAX_REPORTS, &numReports,
+                                            &numDropped);
+        uint32_t j;
+        for (j = 0; j < numReports; ++j) {
+            printf("%ld.%06ld: Position = (%f, %f, %f)\n",
+                   (long)timestamps[j].seconds,
+                   (long)timestamps[j].microseconds,
+                   reports[j].pose.translation.data[0],
+                   reports[j].pose.translation.data[1],
+                   reports[j].pose.translation.data[2]);
+        }
+        if (numDropped > 0) {
+            printf("(%u reports dropped: drain more often or use a larger "
+                   "queue)\n",
+                   (unsigned)numDropped);
+        }
+    }
+
+    osvrClientShutdown(ctx);
+    printf("Library shut down, exiting.\n");
+    return 0;
+}
@@ -35,10 +35,11 @@
 #include <osvr/Client/InterfaceTree.h>
 
 // Library/third-party includes
-// - none
+#include <json/value.h>
 
 // Standard includes
 #include <string>
+#include <unordered_map>
 
 namespace osvr {
 namespace common {
@@ -95,6 +96,12 @@ namespace client {
         /// or more interface objects but no remote handler.
         void m_connectNeededCallbacks();
 
+        /// @brief After a path tree update, re-resolves every path with a
+        /// handler, rebuilding only those whose source changed (and removing
+        /// those that no longer resolve), then connects any newly-resolvable
+        /// paths.
+        void m_handleTreeUpdate();
+
         /// @brief Access the client context's logger.
         util::log::LoggerPtr const &logger() const;
 
@@ -102,6 +109,14 @@ namespace client {
         /// remote handlers.
         InterfaceTree m_interfaces;
 
+        /// @brief For each path with a handler, a summary of everything about
+        /// its resolved source that went into making that handler, so we can
+        /// tell when a tree update requires a new one.
+        std::unordered_map<std::string, Json::Value> m_handlerSources;
+
+        /// @brief The path tree owner passed into the constructor.
+        common::PathTreeOwner &m_pathTreeOwner;
+
         /// @brief Reference to the main path tree object, retrieved from the
         /// common::PathTreeOwner passed into constructor.
         common::PathTree &m_pathTree;
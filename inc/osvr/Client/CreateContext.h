@@ -28,6 +28,7 @@
 // Internal Includes
 #include <osvr/Client/Export.h>
 #include <osvr/Common/ClientContext_fwd.h>
+#include <osvr/Common/LocalReportDispatcher.h>
 
 // Library/third-party includes
 // - none
@@ -43,9 +44,11 @@ namespace client {
     OSVR_CLIENT_EXPORT common::ClientContext *
     createContext(const char appId[], const char host[] = "localhost");
 
-    OSVR_CLIENT_EXPORT common::ClientContext *
-    createAnalysisClientContext(const char appId[], const char host[],
-                                vrpn_ConnectionPtr const& conn);
+    /// @param localReports If provided, reports from devices in this process
+    /// are received directly through it rather than through conn.
+    OSVR_CLIENT_EXPORT common::ClientContext *createAnalysisClientContext(
+        const char appId[], const char host[], vrpn_ConnectionPtr const &conn,
+        common::LocalReportDispatcherPtr const &localReports = nullptr);
 } // namespace client
 } // namespace osvr
 
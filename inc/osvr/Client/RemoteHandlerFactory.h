@@ -32,6 +32,7 @@
 #include <osvr/Common/OriginalSource.h>
 #include <osvr/Common/InterfaceList.h>
 #include <osvr/Common/ClientContext_fwd.h>
+#include <osvr/Common/LocalReportDispatcher.h>
 #include <osvr/Client/RemoteHandler.h>
 
 // Library/third-party includes
@@ -80,9 +81,13 @@ namespace client {
 
     /// @brief Populates a RemoteHandlerFactory with each of the specific
     /// factories included with OSVR.
-    OSVR_CLIENT_EXPORT void
-    populateRemoteHandlerFactory(RemoteHandlerFactory &factory,
-                                 VRPNConnectionCollection const &conns);
+    ///
+    /// @param localReports For contexts inside the server process: devices
+    /// publishing through this dispatcher are subscribed to directly, where
+    /// the factory supports it, instead of through VRPN.
+    OSVR_CLIENT_EXPORT void populateRemoteHandlerFactory(
+        RemoteHandlerFactory &factory, VRPNConnectionCollection const &conns,
+        common::LocalReportDispatcherPtr const &localReports = nullptr);
 
 } // namespace client
 } // namespace osvr
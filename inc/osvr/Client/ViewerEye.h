@@ -36,6 +36,7 @@
 #include <osvr/Util/MatrixConventionsC.h>
 #include <osvr/Util/RadialDistortionParametersC.h>
 #include <osvr/Util/Angles.h>
+#include <osvr/Util/TimeValue.h>
 
 // Library/third-party includes
 #include <boost/optional.hpp>
@@ -89,6 +90,15 @@ namespace client {
 
         OSVR_CLIENT_EXPORT Eigen::Matrix4d getView() const;
 
+        /// @brief Gets the pose predicted for the given target time, such as
+        /// the scan-out time of the display.
+        OSVR_CLIENT_EXPORT OSVR_Pose3
+        getPoseAtTime(util::time::TimeValue const &targetTime) const;
+
+        /// @brief Gets the view matrix predicted for the given target time.
+        OSVR_CLIENT_EXPORT Eigen::Matrix4d
+        getViewAtTime(util::time::TimeValue const &targetTime) const;
+
         bool wantDistortion() const {
             return m_radDistortParams.is_initialized();
         }
@@ -131,7 +141,11 @@ namespace client {
             OSVR_DisplayInputCount displayInputIdx,
             util::Angle opticalAxisOffsetY = 0. * util::radians);
         util::Rectd m_getRect(double near, double far) const;
-        Eigen::Isometry3d getPoseIsometry() const;
+        /// @brief Gets the latest pose, or if a target time is given, the
+        /// pose predicted for that time.
+        Eigen::Isometry3d getPoseIsometry(
+            boost::optional<util::time::TimeValue> const &targetTime =
+                boost::none) const;
         InternalInterfaceOwner m_pose;
         Eigen::Vector3d m_offset;
 #if 0
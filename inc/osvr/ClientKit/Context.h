@@ -63,6 +63,20 @@ namespace clientkit {
         }
     }
 
+    inline void ClientContext::startUpdateThread() {
+        OSVR_ReturnCode ret = osvrClientStartUpdateThread(m_context);
+        if (OSVR_RETURN_SUCCESS != ret) {
+            throw std::runtime_error("Error starting context update thread.");
+        }
+    }
+
+    inline void ClientContext::stopUpdateThread() {
+        OSVR_ReturnCode ret = osvrClientStopUpdateThread(m_context);
+        if (OSVR_RETURN_SUCCESS != ret) {
+            throw std::runtime_error("Error stopping context update thread.");
+        }
+    }
+
     inline Interface ClientContext::getInterface(const std::string &path) {
         OSVR_ClientInterface iface = NULL;
         OSVR_ReturnCode ret =
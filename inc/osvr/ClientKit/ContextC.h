@@ -84,6 +84,28 @@ osvrClientInitHost(const char applicationIdentifier[],
 */
 OSVR_CLIENTKIT_EXPORT OSVR_ReturnCode osvrClientUpdate(OSVR_ClientContext ctx);
 
+/** @brief Starts a thread, owned by the context, that updates it continuously
+    (waiting for network traffic in between), so that you don't have to call
+    osvrClientUpdate() - which becomes a no-op while the thread runs.
+
+    Callbacks are then called on that thread, not yours. State retrieval
+    functions (like osvrGetPoseState()) are lock-free and may be called from any
+    thread: each returns a consistent snapshot of one report type's state.
+
+    @param ctx Client context
+*/
+OSVR_CLIENTKIT_EXPORT OSVR_ReturnCode
+osvrClientStartUpdateThread(OSVR_ClientContext ctx);
+
+/** @brief Stops the thread started by osvrClientStartUpdateThread(), if
+    running. Not to be called from a callback. osvrClientShutdown() also stops
+    it.
+
+    @param ctx Client context
+*/
+OSVR_CLIENTKIT_EXPORT OSVR_ReturnCode
+osvrClientStopUpdateThread(OSVR_ClientContext ctx);
+
 /** @brief Checks to see if the client context is fully started up and connected
     properly to a server.
 
@@ -80,6 +80,14 @@ namespace clientkit {
         /// mainloop.
         void update();
 
+        /// @brief Starts a thread, owned by the context, that updates it
+        /// continuously, so you don't have to call update(). Callbacks will
+        /// then be called on that thread.
+        void startUpdateThread();
+
+        /// @brief Stops the update thread, if running.
+        void stopUpdateThread();
+
         /// @brief Get the interface associated with the given path.
         /// @param path A resource path.
         /// @returns The interface object.
@@ -39,6 +39,7 @@
 #include <osvr/Util/Pose3C.h>
 #include <osvr/Util/BoolC.h>
 #include <osvr/Util/RadialDistortionParametersC.h>
+#include <osvr/Util/TimeValueC.h>
 
 /* Library/third-party includes */
 /* none */
@@ -228,6 +229,27 @@ OSVR_CLIENTKIT_EXPORT OSVR_ReturnCode
 osvrClientGetViewerEyePose(OSVR_DisplayConfig disp, OSVR_ViewerCount viewer,
                            OSVR_EyeCount eye, OSVR_Pose3 *pose);
 
+/** @brief Get the "viewpoint" for the given eye of a viewer in a display
+   config, predicted for a given target time (typically the time the frame
+   being rendered will be scanned out).
+
+    Will only succeed if osvrClientCheckDisplayStartup() succeeds.
+
+    @param disp Display config object
+    @param viewer Viewer ID
+    @param eye Eye ID
+    @param targetTime Time for which to predict the pose
+    @param[out] pose Room-space pose (not relative to pose of the viewer)
+
+    @return OSVR_RETURN_FAILURE if invalid parameters were passed or no pose was
+    yet available, in which case the pose argument is unmodified.
+
+    @sa osvrGetPoseStateAtTime()
+*/
+OSVR_CLIENTKIT_EXPORT OSVR_ReturnCode osvrClientGetViewerEyePoseAtTime(
+    OSVR_DisplayConfig disp, OSVR_ViewerCount viewer, OSVR_EyeCount eye,
+    const struct OSVR_TimeValue *targetTime, OSVR_Pose3 *pose);
+
 /** @brief Get the view matrix (inverse of pose) for the given eye of a
     viewer in a display config - matrix of **doubles**.
 
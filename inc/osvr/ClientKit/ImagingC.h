@@ -35,6 +35,8 @@
 #include <osvr/Util/ReturnCodesC.h>
 #include <osvr/Util/ClientOpaqueTypesC.h>
 #include <osvr/Util/ImagingReportTypesC.h>
+#include <osvr/Util/BoolC.h>
+#include <osvr/Util/StdInt.h>
 
 /* Library/third-party includes */
 /* none */
@@ -50,6 +52,63 @@ OSVR_EXTERN_C_BEGIN
 OSVR_CLIENTKIT_EXPORT OSVR_ReturnCode
 osvrClientFreeImage(OSVR_ClientContext ctx, OSVR_ImageBufferElement *buf);
 
+/** @brief What to do when the client holds images delivered from shared
+    memory for too long, pinning the server's buffers.
+*/
+typedef enum OSVR_ImageLeaseAction {
+    /** @brief Deliver new images as copies in client-owned buffers until
+        the held images are freed. (Default) */
+    OSVR_IMAGE_LEASE_COPY_OUT = 0,
+    /** @brief Release the server's buffers behind overdue (or, past the pin
+        limit, the oldest) held images: their contents may then be
+        overwritten. See osvrClientIsImageRevoked() */
+    OSVR_IMAGE_LEASE_REVOKE = 1
+} OSVR_ImageLeaseAction;
+
+/** @brief Sets the policy for images delivered from shared memory.
+    @param ctx Client context.
+    @param action What to do about images held too long.
+    @param deadlineSeconds How long an image may be held before the action
+    applies. (Default 0.1)
+    @param maxPinned How many images may hold server buffers at once.
+    (Default 4)
+*/
+OSVR_CLIENTKIT_EXPORT OSVR_ReturnCode
+osvrClientSetImageLeasePolicy(OSVR_ClientContext ctx,
+                              OSVR_ImageLeaseAction action,
+                              double deadlineSeconds, uint32_t maxPinned);
+
+typedef struct OSVR_ImageLeaseStats {
+    /** @brief Images held by the client that pin a server buffer. */
+    uint32_t pinned;
+    /** @brief Images delivered as copies due to the lease policy. */
+    uint64_t copied;
+    /** @brief Images whose server buffers were released while held. */
+    uint64_t revoked;
+    /** @brief Images lost because the server overwrote them before the
+        client could read them. */
+    uint64_t dropped;
+} OSVR_ImageLeaseStats;
+
+/** @brief Gets the counters of the image lease policy.
+    @param ctx Client context.
+    @param[out] stats Destination for the counters.
+*/
+OSVR_CLIENTKIT_EXPORT OSVR_ReturnCode
+osvrClientGetImageLeaseStats(OSVR_ClientContext ctx,
+                             OSVR_ImageLeaseStats *stats);
+
+/** @brief Checks whether an image buffer the client still holds had its
+    server buffer revoked, in which case its contents may be overwritten.
+    @param ctx Client context.
+    @param buf Image buffer.
+    @param[out] revoked Destination for the result.
+*/
+OSVR_CLIENTKIT_EXPORT OSVR_ReturnCode
+osvrClientIsImageRevoked(OSVR_ClientContext ctx,
+                         OSVR_ImageBufferElement const *buf,
+                         OSVR_CBool *revoked);
+
 OSVR_EXTERN_C_END
 
 #endif
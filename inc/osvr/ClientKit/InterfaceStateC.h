@@ -75,6 +75,26 @@ OSVR_CALLBACK_METHODS(Skeleton)
 
 #undef OSVR_CALLBACK_METHODS
 
+/** @brief Get the pose of an interface predicted for a given target time
+    (typically the scan-out time of the display), returning failure if no pose
+    state exists.
+
+    The prediction extrapolates from the latest pose state, using any velocity
+    and acceleration state for the interface, or else motion estimated from the
+    previous pose state. Target times earlier than the latest pose return that
+    pose unchanged, and prediction intervals are capped at 100ms.
+
+    @param iface The interface object
+    @param targetTime The time for which to predict the pose
+    @param[out] timestamp The timestamp of the latest pose report the
+    prediction was based on
+    @param[out] state The predicted pose
+*/
+OSVR_CLIENTKIT_EXPORT OSVR_ReturnCode
+osvrGetPoseStateAtTime(OSVR_ClientInterface iface,
+                       const struct OSVR_TimeValue *targetTime,
+                       struct OSVR_TimeValue *timestamp, OSVR_PoseState *state);
+
 OSVR_EXTERN_C_END
 
 #endif
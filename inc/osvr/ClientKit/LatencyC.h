@@ -0,0 +1,99 @@
+/** @file
+    @brief Header
+
+    Must be c-safe!
+
+    @date 2017
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+/*
+// Copyright 2017 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#ifndef INCLUDED_LatencyC_h_GUID_4A8E2D71_C6B3_4F09_9E15_D3B7A20F6C84
+#define INCLUDED_LatencyC_h_GUID_4A8E2D71_C6B3_4F09_9E15_D3B7A20F6C84
+
+/* Internal Includes */
+#include <osvr/ClientKit/Export.h>
+#include <osvr/Util/APIBaseC.h>
+#include <osvr/Util/ReturnCodesC.h>
+#include <osvr/Util/AnnotationMacrosC.h>
+#include <osvr/Util/ClientOpaqueTypesC.h>
+#include <osvr/Util/StdInt.h>
+
+/* Library/third-party includes */
+/* none */
+
+/* Standard includes */
+/* none */
+
+OSVR_EXTERN_C_BEGIN
+/** @addtogroup ClientKit
+@{
+*/
+
+/** @brief Statistics on the reports received for an interface since the
+    statistics were last reset.
+
+    Report age is the time from the report's timestamp (set by the plugin, or
+    by the server when sending if the plugin gave none) to its arrival at the
+    client. It is only meaningful when the server and client clocks agree, as
+    they do when both run on the same machine.
+*/
+typedef struct OSVR_ReportLatencyStats {
+    /** @brief Number of reports received. */
+    uint64_t reportCount;
+    /** @brief Number of reports timestamped earlier than the report before
+        them. */
+    uint64_t outOfOrderCount;
+    /** @brief Average reports per second, or 0 if fewer than two reports. */
+    double reportRate;
+    /** @brief Median report age, in microseconds. */
+    int64_t latencyP50;
+    /** @brief 99th-percentile report age, in microseconds. */
+    int64_t latencyP99;
+    /** @brief Largest report age, in microseconds. */
+    int64_t latencyMax;
+} OSVR_ReportLatencyStats;
+
+/** @brief Get the report statistics for an interface.
+
+    Statistics are currently gathered for tracker (pose) reports.
+
+    @param iface The interface object
+    @param[out] stats The statistics
+    @returns OSVR_RETURN_FAILURE if a null interface or output was passed.
+*/
+OSVR_CLIENTKIT_EXPORT OSVR_ReturnCode
+osvrClientGetInterfaceLatencyStats(OSVR_ClientInterface iface,
+                                   OSVR_ReportLatencyStats *stats);
+
+/** @brief Reset the report statistics for an interface, e.g. to start a new
+    measurement interval.
+
+    @param iface The interface object
+    @returns OSVR_RETURN_FAILURE if a null interface was passed.
+*/
+OSVR_CLIENTKIT_EXPORT OSVR_ReturnCode
+osvrClientResetInterfaceLatencyStats(OSVR_ClientInterface iface);
+
+/** @} */
+OSVR_EXTERN_C_END
+
+#endif
@@ -0,0 +1,115 @@
+/** @file
+    @brief Header
+
+    Must be c-safe!
+
+    @date 2017
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+/*
+// Copyright 2017 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+
+#ifndef INCLUDED_ReportQueueC_h_GUID_87ED663A_F9A4_4642_9DAF_1DDEF05F15A1
+#define INCLUDED_ReportQueueC_h_GUID_87ED663A_F9A4_4642_9DAF_1DDEF05F15A1
+
+/* Internal Includes */
+#include <osvr/ClientKit/Export.h>
+#include <osvr/Util/APIBaseC.h>
+#include <osvr/Util/ReturnCodesC.h>
+#include <osvr/Util/AnnotationMacrosC.h>
+#include <osvr/Util/ClientOpaqueTypesC.h>
+#include <osvr/Util/ClientReportTypesC.h>
+#include <osvr/Util/TimeValueC.h>
+#include <osvr/Util/StdInt.h>
+
+/* Library/third-party includes */
+/* none */
+
+/* Standard includes */
+/* none */
+
+OSVR_EXTERN_C_BEGIN
+/** @addtogroup ClientKit
+@{
+*/
+
+/** @name Report queues
+
+    An alternative to callbacks for applications that consume every report of
+    a high-rate interface: once a queue is enabled for a report type, each
+    report of that type received during osvrClientUpdate() is stored, with its
+    timestamp, in a ring of fixed capacity allocated up front. The
+    application then drains the queued reports in bulk after the update.
+
+    If the queue fills before it is drained, the oldest reports are
+    overwritten; the number lost is returned by the next drain.
+
+    Callbacks and state are unaffected by queues.
+    @{
+*/
+#define OSVR_REPORT_QUEUE_METHODS(TYPE)                                        \
+    /** @brief Set the capacity of the TYPE report queue of an interface,      \
+        discarding any reports queued. A capacity of 0 (the default)           \
+        disables the queue. */                                                 \
+    OSVR_CLIENTKIT_EXPORT OSVR_ReturnCode                                      \
+        osvrClientInterfaceSet##TYPE##ReportQueueCapacity(                     \
+            OSVR_ClientInterface iface, uint32_t capacity);                    \
+    /** @brief Remove up to maxReports queued TYPE reports from an interface,  \
+        oldest first, copying them and their timestamps into the given         \
+        arrays.                                                                \
+                                                                               \
+        @param[out] numReports Number of reports copied.                       \
+        @param[out] numDropped Optional (may be NULL): number of reports       \
+        overwritten before they could be drained, since the previous drain.    \
+    */                                                                         \
+    OSVR_CLIENTKIT_EXPORT OSVR_ReturnCode                                      \
+        osvrClientInterfaceDrain##TYPE##Reports(                               \
+            OSVR_ClientInterface iface, struct OSVR_TimeValue *timestamps,     \
+            OSVR_##TYPE##Report *reports, uint32_t maxReports,                 \
+            uint32_t *numReports, uint32_t *numDropped);
+
+OSVR_REPORT_QUEUE_METHODS(Pose)
+OSVR_REPORT_QUEUE_METHODS(Position)
+OSVR_REPORT_QUEUE_METHODS(Orientation)
+OSVR_REPORT_QUEUE_METHODS(Velocity)
+OSVR_REPORT_QUEUE_METHODS(LinearVelocity)
+OSVR_REPORT_QUEUE_METHODS(AngularVelocity)
+OSVR_REPORT_QUEUE_METHODS(Acceleration)
+OSVR_REPORT_QUEUE_METHODS(LinearAcceleration)
+OSVR_REPORT_QUEUE_METHODS(AngularAcceleration)
+OSVR_REPORT_QUEUE_METHODS(Button)
+OSVR_REPORT_QUEUE_METHODS(Analog)
+OSVR_REPORT_QUEUE_METHODS(Location2D)
+OSVR_REPORT_QUEUE_METHODS(Direction)
+OSVR_REPORT_QUEUE_METHODS(EyeTracker2D)
+OSVR_REPORT_QUEUE_METHODS(EyeTracker3D)
+OSVR_REPORT_QUEUE_METHODS(EyeTrackerBlink)
+OSVR_REPORT_QUEUE_METHODS(NaviVelocity)
+OSVR_REPORT_QUEUE_METHODS(NaviPosition)
+OSVR_REPORT_QUEUE_METHODS(Skeleton)
+
+#undef OSVR_REPORT_QUEUE_METHODS
+/** @} */
+
+/** @} */
+OSVR_EXTERN_C_END
+
+#endif
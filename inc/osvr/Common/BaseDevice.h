@@ -66,6 +66,16 @@ namespace common {
         void unregisterHandler(vrpn_MESSAGEHANDLER handler, void *userdata,
                                RawMessageType const &msgType);
 
+        /// @brief Like registerHandler(), but for messages from any sender,
+        /// such as VRPN's own notices of endpoints connecting (which don't
+        /// come from this device).
+        void registerAnySenderHandler(vrpn_MESSAGEHANDLER handler,
+                                      void *userdata,
+                                      RawMessageType const &msgType);
+        void unregisterAnySenderHandler(vrpn_MESSAGEHANDLER handler,
+                                        void *userdata,
+                                        RawMessageType const &msgType);
+
         /// @brief Call with a MessageRegistration object, and the message type
         /// will be registered and stored in the `type` field.
         template <typename T>
@@ -40,6 +40,31 @@ namespace common {
     /// @brief Traits class for use with MessageHandler.
     typedef ImpliedSenderMessageHandleTraits<vrpn_MESSAGEHANDLER, BaseDevice>
         BaseDeviceMessageHandleTraits;
+
+    /// @brief Traits class for use with MessageHandler, for handlers of
+    /// messages from any sender on the device's connection.
+    class BaseDeviceAnySenderMessageHandleTraits {
+      public:
+        typedef vrpn_MESSAGEHANDLER handler_type;
+        class registration_type {
+          public:
+            registration_type(BaseDevice *dev) : m_dev(dev) {}
+
+            void registerHandler(handler_type handler, void *userdata,
+                                 RawSenderType const &,
+                                 RawMessageType const &msgType) {
+                m_dev->registerAnySenderHandler(handler, userdata, msgType);
+            }
+            void unregisterHandler(handler_type handler, void *userdata,
+                                   RawSenderType const &,
+                                   RawMessageType const &msgType) {
+                m_dev->unregisterAnySenderHandler(handler, userdata, msgType);
+            }
+
+          private:
+            BaseDevice *m_dev;
+        };
+    };
 } // namespace common
 } // namespace osvr
 #endif // INCLUDED_BaseMessageTraits_h_GUID_AB3AFAC5_54F4_41BF_78D9_CE10525DD053
@@ -43,19 +43,56 @@
 #include <boost/any.hpp>
 
 // Standard includes
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <vector>
-#include <map>
+
+namespace osvr {
+namespace common {
+    class ImageLeaseManager;
+} // namespace common
+} // namespace osvr
 
 struct OSVR_ClientContextObject : boost::noncopyable {
   public:
     typedef std::vector<osvr::common::ClientInterfacePtr> InterfaceList;
+    typedef std::recursive_mutex UpdateMutex;
     /// @brief Destructor
     OSVR_COMMON_EXPORT virtual ~OSVR_ClientContextObject();
 
-    /// @brief System-wide update method.
+    /// @brief System-wide update method. Does nothing while the update
+    /// thread is running, since that thread is already calling it.
     OSVR_COMMON_EXPORT void update();
 
+    /// @name Threaded update
+    /// @brief Instead of the application calling update() in its own loop,
+    /// the context can own a thread that updates continuously, waiting for
+    /// network traffic in between.
+    ///
+    /// While it runs, callbacks are called on that thread, and state getters
+    /// read published snapshots without locking. Methods that modify the
+    /// context take the update mutex themselves; hold it yourself to use the
+    /// references returned by getPathTree(), getRoomToWorldTransform(), or
+    /// getInterfaces().
+    /// @{
+    /// @brief Starts the update thread, if it isn't already running.
+    OSVR_COMMON_EXPORT void startUpdateThread();
+
+    /// @brief Stops and joins the update thread, if it is running. Must not
+    /// be called from a callback, or while holding the update mutex.
+    OSVR_COMMON_EXPORT void stopUpdateThread();
+
+    bool isUpdateThreadRunning() const { return m_updateThreadRunning; }
+
+    /// @brief The mutex held for the duration of each update.
+    UpdateMutex &getUpdateMutex() const { return m_updateMutex; }
+    /// @}
+
     /// @brief Accessor for app ID
     std::string const &getAppId() const;
 
@@ -92,6 +129,7 @@ struct OSVR_ClientContextObject : boost::noncopyable {
     /// @brief Pass (smart-pointer) ownership of some object to the client
     /// context.
     template <typename T> void *acquireObject(T obj) {
+        std::lock_guard<UpdateMutex> lock(m_updateMutex);
         return m_ownedObjects.acquire(obj);
     }
 
@@ -101,6 +139,12 @@ struct OSVR_ClientContextObject : boost::noncopyable {
     /// @returns true if the object was found and released.
     OSVR_COMMON_EXPORT bool releaseObject(void *obj);
 
+    /// @brief Accessor for the leases on shared-memory image frames held by
+    /// the client. Use with the update mutex held.
+    osvr::common::ImageLeaseManager &getImageLeaseManager() {
+        return *m_imageLeases;
+    }
+
     /// @brief Gets the transform from room space to world space.
     OSVR_COMMON_EXPORT osvr::common::Transform const &
     getRoomToWorldTransform() const;
@@ -109,6 +153,13 @@ struct OSVR_ClientContextObject : boost::noncopyable {
     OSVR_COMMON_EXPORT void
     setRoomToWorldTransform(osvr::common::Transform const &xform);
 
+    /// @brief Gets a counter that changes every time the room to world
+    /// transform is set, so values computed from the transform can be cached
+    /// and cheaply checked for staleness.
+    std::uint32_t getRoomToWorldTransformGeneration() const {
+        return m_roomToWorldGeneration;
+    }
+
     /// @brief Returns the specialized deleter for this object.
     OSVR_COMMON_EXPORT osvr::common::ClientContextDeleter getDeleter() const;
 
@@ -136,7 +187,17 @@ struct OSVR_ClientContextObject : boost::noncopyable {
         osvr::common::ClientContextDeleter del);
 
   private:
+    /// @brief Updates the context and interfaces, with the mutex held.
+    void m_updateAll();
+    /// @brief Loop run by the update thread.
+    void m_runUpdateThread();
     virtual void m_update() = 0;
+    /// @brief Called by the update thread between updates, to wait (without
+    /// holding the update mutex, except while actually handling traffic) for
+    /// up to the given time for there to be something to update. The
+    /// default implementation just sleeps.
+    OSVR_COMMON_EXPORT virtual void
+    m_waitForUpdate(std::chrono::microseconds maxWait);
     virtual void m_sendRoute(std::string const &route) = 0;
     OSVR_COMMON_EXPORT virtual bool m_getStatus() const;
     /// @brief Optional implementation-specific handling of interface retrieval,
@@ -167,12 +228,19 @@ struct OSVR_ClientContextObject : boost::noncopyable {
     osvr::common::ClientInterfaceFactory m_clientInterfaceFactory;
 
     osvr::util::MultipleKeyedOwnershipContainer m_ownedObjects;
+    osvr::unique_ptr<osvr::common::ImageLeaseManager> m_imageLeases;
     osvr::common::ClientContextDeleter m_deleter;
 
     /// Logger for the use of OSVR libraries on behalf of the client
     osvr::util::log::LoggerPtr m_logger;
     /// Logger for the client's exclusive use
     osvr::util::log::LoggerPtr m_clientLogger;
+
+    std::uint32_t m_roomToWorldGeneration = 0;
+
+    mutable UpdateMutex m_updateMutex;
+    std::atomic<bool> m_updateThreadRunning{false};
+    std::thread m_updateThread;
 };
 
 namespace osvr {
@@ -31,8 +31,10 @@
 #include <osvr/Common/ClientInterfacePtr.h>
 #include <osvr/Common/InterfaceState.h>
 #include <osvr/Common/InterfaceCallbacks.h>
+#include <osvr/Common/InterfaceReportQueues.h>
 #include <osvr/Common/StateType.h>
 #include <osvr/Common/ReportStateTraits.h>
+#include <osvr/Common/ReportLatencyStats.h>
 #include <osvr/Common/Tracing.h>
 #include <osvr/Util/ClientOpaqueTypesC.h>
 #include <osvr/Util/ClientCallbackTypesC.h>
@@ -45,6 +47,7 @@
 #include <string>
 #include <vector>
 #include <functional>
+#include <mutex>
 
 struct OSVR_ClientInterfaceObject : boost::noncopyable {
 
@@ -85,6 +88,15 @@ struct OSVR_ClientInterfaceObject : boost::noncopyable {
 
     bool hasAnyState() const { return m_state.hasAnyState(); }
 
+    /// @brief If pose state exists, predicts the pose at the given target
+    /// time from it and any velocity/acceleration state, returning the
+    /// timestamp of the underlying pose report. See
+    /// osvr::common::predictPoseState()
+    OSVR_COMMON_EXPORT bool
+    getPoseStateAtTime(osvr::util::time::TimeValue const &targetTime,
+                       osvr::util::time::TimeValue &timestamp,
+                       OSVR_PoseState &state) const;
+
     /// @brief Set saved state for a report type.
     template <typename ReportType>
     void setState(const OSVR_TimeValue &timestamp, ReportType const &report) {
@@ -102,6 +114,7 @@ struct OSVR_ClientInterfaceObject : boost::noncopyable {
     /// @brief Register a callback for a known report type.
     template <typename CallbackType>
     void registerCallback(CallbackType cb, void *userdata) {
+        auto lock = lockContext();
         m_callbacks.addCallback(cb, userdata);
     }
 
@@ -120,11 +133,44 @@ struct OSVR_ClientInterfaceObject : boost::noncopyable {
     }
     /// @}
 
+    /// @name Report queue methods
+    /// @brief Forwarding to the nested InterfaceReportQueues instance.
+    /// @{
+    /// @brief Access the queue of reports of the given type, to enable it by
+    /// setting a capacity, or to drain it.
+    template <typename ReportType>
+    osvr::common::ReportQueue<ReportType> &getReportQueue() {
+        return m_queues.get<ReportType>();
+    }
+
+    /// @brief Add a report to the queue for its type, if enabled.
+    template <typename ReportType>
+    void queueReport(const OSVR_TimeValue &timestamp,
+                     ReportType const &report) {
+        m_queues.push(timestamp, report);
+    }
+    /// @}
+
+    /// @brief Statistics on the age and rate of reports arriving for this
+    /// interface.
+    osvr::common::ReportLatencyStats &getLatencyStats() {
+        return m_latencyStats;
+    }
+    osvr::common::ReportLatencyStats const &getLatencyStats() const {
+        return m_latencyStats;
+    }
+
     /// @brief Update any state.
     void update();
 
     osvr::common::ClientContext &getContext() const { return m_ctx; }
 
+    /// @brief Holds the context's update mutex, for touching anything other
+    /// than state (callbacks, queues, statistics) while the context's update
+    /// thread may be running.
+    OSVR_COMMON_EXPORT std::unique_lock<std::recursive_mutex>
+    lockContext() const;
+
     /// @brief Access the type-erased data for this interface.
     boost::any &data() { return m_data; }
 
@@ -132,7 +178,9 @@ struct OSVR_ClientInterfaceObject : boost::noncopyable {
     osvr::common::ClientContext &m_ctx;
     std::string const m_path;
     osvr::common::InterfaceCallbacks m_callbacks;
+    osvr::common::InterfaceReportQueues m_queues;
     osvr::common::InterfaceState m_state;
+    osvr::common::ReportLatencyStats m_latencyStats;
     boost::any m_data;
 };
 
@@ -69,6 +69,12 @@ namespace common {
         void m_registerHandler(vrpn_MESSAGEHANDLER handler, void *userdata,
                                RawMessageType const &msgType);
 
+        /// @brief Like m_registerHandler(), but receives the message type from
+        /// any sender on the connection, not just this device.
+        void m_registerAnySenderHandler(vrpn_MESSAGEHANDLER handler,
+                                        void *userdata,
+                                        RawMessageType const &msgType);
+
         /// @brief Called once when we have a parent
         virtual void m_parentSet() = 0;
 
@@ -79,6 +85,8 @@ namespace common {
       private:
         Parent *m_parent;
         MessageHandlerList<BaseDeviceMessageHandleTraits> m_messageHandlers;
+        MessageHandlerList<BaseDeviceAnySenderMessageHandleTraits>
+            m_anySenderMessageHandlers;
     };
 } // namespace common
 } // namespace osvr
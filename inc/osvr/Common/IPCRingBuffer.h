@@ -62,6 +62,12 @@ namespace common {
     /// segment name and signalling new data, and no guarantee that the data you
     /// were notified about won't be overwritten - just that if you're currently
     /// accessing data, we won't overwrite that.
+    ///
+    /// Optionally (see Options::setLockFree()), the ring buffer can instead
+    /// operate in a lock-free broadcast mode, where the producer never waits on
+    /// consumers: each entry carries a generation counter, and consumers copy
+    /// the data out, detecting (and skipping) entries that were overwritten
+    /// before or during the copy.
     class IPCRingBuffer : public enable_shared_from_this<IPCRingBuffer> {
       public:
         typedef uint8_t BackendType;
@@ -100,12 +106,21 @@ namespace common {
             Options &setEntrySize(entry_size_type entrySize);
             entry_size_type getEntrySize() const { return m_entrySize; }
 
+            /// @brief Sets whether the ring buffer uses the lock-free broadcast
+            /// mode, in which the (single) producer never blocks on consumers,
+            /// at the cost of consumers copying the data out. Only used when
+            /// creating: clients get the mode from the existing buffer.
+            /// @return *this for chained method idiom.
+            Options &setLockFree(bool lockFree);
+            bool getLockFree() const { return m_lockFree; }
+
           private:
             std::string m_name;
             BackendType m_shmBackend;
             alignment_type m_alignment = 16;
             entry_count_type m_entries = 16;
             entry_size_type m_entrySize = 65536;
+            bool m_lockFree = false;
         };
 
         /// @brief Gets an integer representing a unique arrangement of the
@@ -143,6 +158,10 @@ namespace common {
         /// this ring buffer.
         OSVR_COMMON_EXPORT uint16_t getEntries() const;
 
+        /// @brief Returns true if this ring buffer operates in the lock-free
+        /// broadcast mode.
+        OSVR_COMMON_EXPORT bool isLockFree() const;
+
         /// @brief The sequence number is automatically incremented with each
         /// "put" into the buffer. Note that, as an unsigned integer, it does
         /// have (and uses) well-defined overflow semantics.
@@ -155,8 +174,12 @@ namespace common {
         typedef shared_ptr<value_type> smart_pointer_type;
 
         /// @brief A class providing write access to the next available element
-        /// in the ring buffer, owning the appropriate mutex locks and providing
+        /// in the ring buffer, owning that element's mutex lock (or in
+        /// lock-free mode, committing the element when destroyed) and providing
         /// access to the sequence number.
+        ///
+        /// Only readers of that element wait while it is held: the ring's
+        /// bookkeeping lock is released as soon as the element is reserved.
         class BufferWriteProxy {
           public:
             /// @brief not copyable
@@ -166,12 +189,17 @@ namespace common {
             BufferWriteProxy &operator=(BufferWriteProxy const &) = delete;
 
             /// @brief move-constructible
-            BufferWriteProxy(BufferWriteProxy &&other) {
+            BufferWriteProxy(BufferWriteProxy &&other)
+                : m_buf(nullptr), m_seq(0) {
+                std::swap(m_buf, other.m_buf);
+                std::swap(m_seq, other.m_seq);
                 std::swap(m_data, other.m_data);
             }
 
             /// @brief move-assignable
             BufferWriteProxy &operator=(BufferWriteProxy &&other) {
+                std::swap(m_buf, other.m_buf);
+                std::swap(m_seq, other.m_seq);
                 std::swap(m_data, other.m_data);
                 return *this;
             }
@@ -195,6 +223,9 @@ namespace common {
         /// holding a sharable mutex lock preventing it from being overwritten
         /// while this object is in scope.
         ///
+        /// In lock-free mode, it instead owns a verified private copy of the
+        /// entry, so it never holds up the producer.
+        ///
         /// As such, you should only access the memory pointed to by this object
         /// while you keep this object alive, and you should let it go out of
         /// scope when you no longer need the data.
@@ -243,6 +274,9 @@ namespace common {
 
         /// @brief Gets access to an element in the buffer by sequence number:
         /// returns a proxy object  that behaves mostly like a smart pointer.
+        ///
+        /// In lock-free mode, the returned proxy is invalid if the element was
+        /// overwritten before it could be completely copied.
         OSVR_COMMON_EXPORT BufferReadProxy get(sequence_type num);
 
         /// @brief Gets access to the most recent element in the buffer: returns
@@ -0,0 +1,127 @@
+/** @file
+    @brief Header
+
+    @date 2017
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2017 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef INCLUDED_ImageLeaseManager_h_GUID_55FBAEFC_7E20_4F51_9B4A_C33CD9C7BF9E
+#define INCLUDED_ImageLeaseManager_h_GUID_55FBAEFC_7E20_4F51_9B4A_C33CD9C7BF9E
+
+// Internal Includes
+#include <osvr/Common/Export.h>
+#include <osvr/Common/ImagingComponent.h>
+#include <osvr/Util/SharedPtr.h>
+#include <osvr/Util/TimeValue.h>
+
+// Library/third-party includes
+#include <boost/noncopyable.hpp>
+
+// Standard includes
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace osvr {
+namespace common {
+    /// @brief What to do about a client holding frames that pin shared
+    /// memory ring buffer entries for too long.
+    enum class ImageLeaseAction {
+        /// @brief While the client is over its limits, deliver new frames as
+        /// copies in client-owned pooled buffers, pinning nothing more.
+        CopyOut,
+        /// @brief Release the ring entries of overdue frames (the oldest
+        /// first, when over the pin limit), marking them revoked: the
+        /// producer may then overwrite their contents.
+        Revoke
+    };
+
+    struct ImageLeasePolicy {
+        ImageLeaseAction action = ImageLeaseAction::CopyOut;
+        /// @brief How long a frame may pin its ring entry, in seconds.
+        double deadline = 0.1;
+        /// @brief Most ring entries the client may pin at once.
+        std::size_t maxPinned = 4;
+    };
+
+    struct ImageLeaseStats {
+        /// @brief Ring entries currently pinned by frames the client holds.
+        std::size_t pinned = 0;
+        /// @brief Frames delivered as pooled copies instead of pinning.
+        std::uint64_t copied = 0;
+        /// @brief Frames whose ring entries were released before the client
+        /// freed them.
+        std::uint64_t revoked = 0;
+        /// @brief Frames overwritten in the ring before we could read them.
+        std::uint64_t dropped = 0;
+    };
+
+    /// @brief Tracks, per client context, the image frames delivered from
+    /// shared memory ring buffers, applying an ImageLeasePolicy so a slow or
+    /// leaky client can't pin every entry and starve the producer.
+    ///
+    /// Like the rest of the client context, not thread-safe: use with the
+    /// context's update mutex held (as update and releaseObject do).
+    class ImageLeaseManager : boost::noncopyable {
+      public:
+        OSVR_COMMON_EXPORT ImageLeaseManager();
+        OSVR_COMMON_EXPORT ~ImageLeaseManager();
+
+        OSVR_COMMON_EXPORT void setPolicy(ImageLeasePolicy const &policy);
+        ImageLeasePolicy const &getPolicy() const { return m_policy; }
+
+        /// @brief Takes a frame, returning the buffer to hand to the client:
+        /// for frames read from shared memory, either the same memory under
+        /// a lease or a pooled copy, depending on the policy. Other frames
+        /// are already client-owned, and pass through unchanged.
+        OSVR_COMMON_EXPORT ImageBufferPtr
+        lease(ImageData const &data, util::time::TimeValue const &now);
+
+        /// @brief Applies the deadline: call regularly.
+        OSVR_COMMON_EXPORT void update(util::time::TimeValue const &now);
+
+        /// @brief Counts frames lost before they could be leased.
+        void recordDropped(std::uint64_t frames) { m_stats.dropped += frames; }
+
+        /// @brief Whether the given buffer, as delivered to the client, had
+        /// its ring entry revoked (and so may have been overwritten).
+        OSVR_COMMON_EXPORT bool
+        isRevoked(OSVR_ImageBufferElement const *buf) const;
+
+        OSVR_COMMON_EXPORT ImageLeaseStats getStats() const;
+
+      private:
+        struct Lease;
+        class BufferPool;
+        /// @brief Forgets leases the client has freed.
+        void m_prune();
+        void m_revoke(Lease &lease);
+        ImageLeasePolicy m_policy;
+        ImageLeaseStats m_stats;
+        std::vector<weak_ptr<Lease>> m_leases;
+        /// @brief Set by update() while, with CopyOut, some lease is overdue.
+        bool m_overdue = false;
+        shared_ptr<BufferPool> m_pool;
+    };
+} // namespace common
+} // namespace osvr
+
+#endif // INCLUDED_ImageLeaseManager_h_GUID_55FBAEFC_7E20_4F51_9B4A_C33CD9C7BF9E
@@ -38,7 +38,9 @@
 #include <vrpn_BaseClass.h>
 
 // Standard includes
-// - none
+#include <cstdint>
+#include <map>
+#include <vector>
 
 namespace osvr {
 namespace common {
@@ -47,6 +49,10 @@ namespace common {
         OSVR_ChannelCount sensor;
         OSVR_ImagingMetadata metadata;
         ImageBufferPtr buffer;
+        /// @brief For frames read from shared memory: keeps the memory mapped
+        /// independently of the buffer's hold on its ring entry. Null
+        /// otherwise.
+        shared_ptr<void> mapping;
     };
     namespace messages {
         class ImageRegion : public MessageRegistration<ImageRegion> {
@@ -69,8 +75,74 @@ namespace common {
             class MessageSerialization;
             static const char *identifier();
         };
+        class ImageChunk : public MessageRegistration<ImageChunk> {
+          public:
+            class MessageSerialization;
+            static const char *identifier();
+        };
+        class ImagingTransportRequest
+            : public MessageRegistration<ImagingTransportRequest> {
+          public:
+            class MessageSerialization;
+            static const char *identifier();
+        };
+        /// @brief VRPN's own notice that a remote endpoint connected.
+        class VrpnGotConnection : public MessageRegistration<VrpnGotConnection> {
+          public:
+            static const char *identifier();
+        };
+        /// @brief VRPN's own notice that a remote endpoint disconnected.
+        class VrpnDroppedConnection
+            : public MessageRegistration<VrpnDroppedConnection> {
+          public:
+            static const char *identifier();
+        };
     } // namespace messages
 
+    /// @brief Bit flags for the ways a client can consume image data, used in
+    /// the transport requests it sends to the server.
+    namespace imaging_transport {
+        typedef uint32_t TransportFlags;
+        static const TransportFlags SHARED_MEMORY = 1 << 0;
+        static const TransportFlags IN_PROCESS_MEMORY = 1 << 1;
+        static const TransportFlags NETWORK = 1 << 2;
+        /// @brief Number of transport flag bits defined above.
+        static const std::size_t COUNT = 3;
+    } // namespace imaging_transport
+
+    /// @brief A frame being written by a producer directly into an imaging
+    /// shared memory ring buffer entry, avoiding a copy: see
+    /// ImagingComponent::acquireSharedMemoryFrame()
+    ///
+    /// Readers can't access the entry until the frame is sent or destroyed.
+    /// Destroying it unsent still uses up the entry, but clients are never
+    /// told about it.
+    class ImagingSharedMemoryFrame {
+      public:
+        /// @brief Gets the writable buffer, of the size implied by the
+        /// metadata.
+        OSVR_ImageBufferElement *getBuffer() const { return m_proxy.get(); }
+
+        OSVR_ImagingMetadata const &getMetadata() const { return m_metadata; }
+
+        OSVR_ChannelCount getSensor() const { return m_sensor; }
+
+      private:
+        friend class ImagingComponent;
+        ImagingSharedMemoryFrame(OSVR_ImagingMetadata const &metadata,
+                                 OSVR_ChannelCount sensor,
+                                 IPCRingBufferPtr const &shm)
+            : m_metadata(metadata), m_sensor(sensor), m_shm(shm),
+              m_proxy(shm->put()) {}
+        OSVR_ImagingMetadata m_metadata;
+        OSVR_ChannelCount m_sensor;
+        /// @brief The ring the entry is in: the sensor's ring may be replaced
+        /// (for new metadata) before this frame is sent.
+        IPCRingBufferPtr m_shm;
+        IPCRingBuffer::BufferWriteProxy m_proxy;
+    };
+    typedef unique_ptr<ImagingSharedMemoryFrame> ImagingSharedMemoryFramePtr;
+
     /// @brief BaseDevice component
     class ImagingComponent : public DeviceComponent {
       public:
@@ -88,23 +160,98 @@ namespace common {
         /// shared memory ring buffer.
         messages::ImagePlacedInSharedMemory imagePlacedInSharedMemory;
 
+        /// @brief Message from server to client, containing one piece of a
+        /// (possibly compressed) frame too large, or too deep, to fit in a
+        /// single imageRegion message.
+        messages::ImageChunk imageChunk;
+
 #ifdef OSVR_COMMON_IN_PROCESS_IMAGING
         /// @brief Message from server to client, notifying of image data in process
         /// memory (assumes joint client kit)
         messages::ImagePlacedInProcessMemory imagePlacedInProcessMemory;
 #endif
 
+        /// @brief Message from client to server, periodically listing the
+        /// transports (imaging_transport flags) that client can consume. The
+        /// server only produces the representations requested within the
+        /// last few seconds, plus those older clients (which never send this
+        /// message) understand while any of them might be connected.
+        messages::ImagingTransportRequest transportRequest;
+
         OSVR_COMMON_EXPORT void sendImageData(
             OSVR_ImagingMetadata metadata, OSVR_ImageBufferElement *imageData,
             OSVR_ChannelCount sensor, OSVR_TimeValue const &timestamp);
 
+        /// @brief Reserves the next shared memory ring buffer entry for a
+        /// frame with the given metadata, so the producer can place the image
+        /// there directly instead of having sendImageData() copy it.
+        ///
+        /// Touches the same state as sending image data on this component, so
+        /// must not run concurrently with a send: call it from the server
+        /// thread, or under the device's send guard.
+        ///
+        /// @return an empty pointer if shared memory imaging is unavailable
+        /// (including in in-process imaging builds), in which case fall back
+        /// to sendImageData().
+        OSVR_COMMON_EXPORT ImagingSharedMemoryFramePtr
+        acquireSharedMemoryFrame(OSVR_ImagingMetadata metadata,
+                                 OSVR_ChannelCount sensor);
+
+        /// @brief Commits a frame from acquireSharedMemoryFrame() and notifies
+        /// clients, as sendImageData() would.
+        OSVR_COMMON_EXPORT void
+        sendSharedMemoryFrame(ImagingSharedMemoryFramePtr &&frame,
+                              OSVR_TimeValue const &timestamp);
+
         typedef std::function<void(ImageData const &,
                                    util::time::TimeValue const &)> ImageHandler;
         OSVR_COMMON_EXPORT void registerImageHandler(ImageHandler cb);
 
+        /// @brief Client: the number of frames announced in shared memory
+        /// that had already been overwritten when we went to read them.
+        std::uint64_t getDroppedFrameCount() const { return m_droppedFrames; }
+
       private:
         ImagingComponent(OSVR_ChannelCount numChan);
         virtual void m_parentSet();
+        virtual void m_update();
+
+        /// @brief Server: should we produce this transport, either because a
+        /// client requested it recently or because an older client might
+        /// be connected?
+        bool m_isTransportRequested(
+            imaging_transport::TransportFlags transport) const;
+
+        /// @brief Server: has a transport-aware client requested this
+        /// transport recently?
+        bool m_isTransportExplicitlyRequested(
+            imaging_transport::TransportFlags transport) const;
+
+        /// @brief Server: are more endpoints connected than clients that have
+        /// sent us transport requests recently? If so, assume the rest are
+        /// older clients that expect everything they used to get.
+        bool m_isLegacyClientConnected() const;
+
+        /// @brief Client: updates the transports we accept, sending a request
+        /// right away if they changed.
+        void
+        m_setAcceptedTransports(imaging_transport::TransportFlags transports);
+
+        /// @brief Client: sends our transport request to the server.
+        void m_sendTransportRequest();
+
+        /// @brief Gets the shared memory ring buffer for the sensor,
+        /// (re-)creating it if the frame size changed.
+        /// @return nullptr if it couldn't be created.
+        IPCRingBuffer *m_getShmBuf(OSVR_ImagingMetadata const &metadata,
+                                   OSVR_ChannelCount sensor);
+
+        /// @brief Sends the notification of a frame placed in shared memory.
+        void m_sendSharedMemoryMessage(OSVR_ImagingMetadata const &metadata,
+                                       IPCRingBuffer::sequence_type seq,
+                                       OSVR_ChannelCount sensor,
+                                       IPCRingBuffer const &shm,
+                                       OSVR_TimeValue const &timestamp);
 
         /// @return true if we could send it.
         bool m_sendImageDataViaSharedMemory(OSVR_ImagingMetadata metadata,
@@ -118,6 +265,13 @@ namespace common {
                                       OSVR_ChannelCount sensor,
                                       OSVR_TimeValue const &timestamp);
 
+        /// @brief Sends a frame over the network split across imageChunk
+        /// messages, compressing it if that helps.
+        bool m_sendImageDataInChunks(OSVR_ImagingMetadata const &metadata,
+                                     OSVR_ImageBufferElement const *imageData,
+                                     OSVR_ChannelCount sensor,
+                                     OSVR_TimeValue const &timestamp);
+
 #ifdef OSVR_COMMON_IN_PROCESS_IMAGING
         /// @return true if we could send it.
         bool m_sendImageDataViaInProcessMemory(OSVR_ImagingMetadata metadata,
@@ -132,19 +286,81 @@ namespace common {
         static int VRPN_CALLBACK
         m_handleImagePlacedInSharedMemory(void *userdata, vrpn_HANDLERPARAM p);
 
+        static int VRPN_CALLBACK
+        m_handleImageChunk(void *userdata, vrpn_HANDLERPARAM p);
+
 #ifdef OSVR_COMMON_IN_PROCESS_IMAGING
         static int VRPN_CALLBACK
         m_handleImagePlacedInProcessMemory(void *userdata, vrpn_HANDLERPARAM p);
 #endif
 
+        static int VRPN_CALLBACK
+        m_handleTransportRequest(void *userdata, vrpn_HANDLERPARAM p);
+
+        static int VRPN_CALLBACK
+        m_handleGotConnection(void *userdata, vrpn_HANDLERPARAM p);
+
+        static int VRPN_CALLBACK
+        m_handleDroppedConnection(void *userdata, vrpn_HANDLERPARAM p);
+
         void m_checkFirst(OSVR_ImagingMetadata const &metadata);
         void m_growShmVecIfRequired(OSVR_ChannelCount sensor);
+        void m_growChunkVecIfRequired(OSVR_ChannelCount sensor);
 
         OSVR_ChannelCount m_numSensor;
         std::vector<ImageHandler> m_cb;
         bool m_gotOne;
         /// @brief One for each sensor
         std::vector<IPCRingBufferPtr> m_shmBuf;
+
+        /// @brief Per-sensor state for chunked network frames.
+        struct ChunkedFrameState {
+            /// @brief Server: ID of the last frame sent. Client: ID of the
+            /// last frame decoded.
+            uint32_t frameId = 0;
+            /// @brief Copy of that last frame, for delta coding, if valid.
+            bool havePrevious = false;
+            OSVR_ImagingMetadata previousMetadata;
+            std::vector<uint8_t> previous;
+            /// @brief Server: frames sent since the last one that can be
+            /// decoded on its own.
+            uint32_t framesSinceKeyframe = 0;
+
+            /// @brief Client: whether we are partway through receiving a
+            /// frame, and the header of its first chunk.
+            bool assembling = false;
+            uint32_t assemblingFrameId = 0;
+            uint32_t assemblingReferenceId = 0;
+            uint8_t assemblingEncoding = 0;
+            uint32_t assemblingEncodedSize = 0;
+            OSVR_ImagingMetadata assemblingMetadata;
+            /// @brief Encoded frame data (received so far, on the client)
+            std::vector<uint8_t> encoded;
+        };
+        /// @brief One for each sensor
+        std::vector<ChunkedFrameState> m_chunkState;
+
+        messages::VrpnGotConnection m_gotConnection;
+        messages::VrpnDroppedConnection m_droppedConnection;
+
+        /// @brief Server: the latest transport request from a client.
+        struct TransportRequest {
+            imaging_transport::TransportFlags transports;
+            util::time::TimeValue time;
+        };
+        /// @brief Server: transport requests, by client ID. Expired ones are
+        /// pruned as new requests arrive.
+        std::map<uint32_t, TransportRequest> m_transportRequests;
+        /// @brief Server: number of remote endpoints currently connected
+        /// (only counting those that connected after we were set up).
+        std::size_t m_connectedEndpoints = 0;
+
+        /// @brief Client: the transports we're currently willing to consume.
+        imaging_transport::TransportFlags m_acceptedTransports;
+        /// @brief Client: when we last sent a transport request.
+        util::time::TimeValue m_lastTransportRequest = {};
+        /// @brief Client: see getDroppedFrameCount()
+        std::uint64_t m_droppedFrames = 0;
     };
 } // namespace common
 } // namespace osvr
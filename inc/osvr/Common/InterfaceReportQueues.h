@@ -0,0 +1,150 @@
+/** @file
+    @brief Header
+
+    @date 2017
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2017 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_InterfaceReportQueues_h_GUID_52D3A871_E23E_4ABC_8963_49914DBE40D5
+#define INCLUDED_InterfaceReportQueues_h_GUID_52D3A871_E23E_4ABC_8963_49914DBE40D5
+
+// Internal Includes
+#include <osvr/Common/ReportTypes.h>
+#include <osvr/Util/TimeValue.h>
+
+// Library/third-party includes
+#include <osvr/TypePack/TypeKeyedTuple.h>
+
+// Standard includes
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace osvr {
+namespace common {
+    /// @brief A bounded ring of timestamped reports of one type, for clients
+    /// that would rather drain every report in bulk than get a callback per
+    /// report.
+    ///
+    /// Storage is allocated once, when the capacity is set: a zero capacity
+    /// (the default) means the queue is disabled and pushes are ignored. When
+    /// full, the oldest report is overwritten and counted as dropped.
+    template <typename ReportType> class ReportQueue {
+      public:
+        struct Entry {
+            util::time::TimeValue timestamp;
+            ReportType report;
+        };
+
+        /// @brief Sets the capacity, discarding any queued reports.
+        void setCapacity(std::size_t capacity) {
+            m_entries.assign(capacity, Entry());
+            m_begin = 0;
+            m_size = 0;
+            m_dropped = 0;
+        }
+
+        std::size_t capacity() const { return m_entries.size(); }
+        bool enabled() const { return !m_entries.empty(); }
+        std::size_t size() const { return m_size; }
+
+        void push(util::time::TimeValue const &timestamp,
+                  ReportType const &report) {
+            if (!enabled()) {
+                return;
+            }
+            auto const cap = m_entries.size();
+            std::size_t idx;
+            if (m_size == cap) {
+                /// Overwrite the oldest.
+                idx = m_begin;
+                m_begin = m_wrap(m_begin + 1);
+                ++m_dropped;
+            } else {
+                idx = m_wrap(m_begin + m_size);
+                ++m_size;
+            }
+            m_entries[idx].timestamp = timestamp;
+            m_entries[idx].report = report;
+        }
+
+        /// @brief Removes up to @p maxEntries reports, oldest first, calling
+        /// `f(Entry const &)` on each.
+        /// @return the number removed.
+        template <typename F>
+        std::size_t drain(std::size_t maxEntries, F &&f) {
+            std::size_t n = 0;
+            while (n < maxEntries && m_size > 0) {
+                f(m_entries[m_begin]);
+                m_begin = m_wrap(m_begin + 1);
+                --m_size;
+                ++n;
+            }
+            return n;
+        }
+
+        /// @brief Returns the number of reports overwritten before they could
+        /// be drained since the last call, and resets that count.
+        std::uint32_t takeDroppedCount() {
+            auto ret = m_dropped;
+            m_dropped = 0;
+            return ret;
+        }
+
+      private:
+        std::size_t m_wrap(std::size_t idx) const {
+            return idx >= m_entries.size() ? idx - m_entries.size() : idx;
+        }
+        std::vector<Entry> m_entries;
+        std::size_t m_begin = 0;
+        std::size_t m_size = 0;
+        std::uint32_t m_dropped = 0;
+    };
+
+    /// @brief Trait computing the queue type for a report type.
+    struct ReportQueueStorage {
+        template <typename ReportType> using apply = ReportQueue<ReportType>;
+    };
+
+    using ReportQueueTuple =
+        typepack::TypeKeyedTuple<traits::ReportTypeList, ReportQueueStorage>;
+
+    /// @brief Class to maintain the optional report queues for an interface,
+    /// one for each report type explicitly enumerated.
+    class InterfaceReportQueues {
+      public:
+        template <typename ReportType> ReportQueue<ReportType> &get() {
+            return typepack::get<ReportType>(m_queues);
+        }
+
+        template <typename ReportType>
+        void push(util::time::TimeValue const &timestamp,
+                  ReportType const &report) {
+            typepack::get<ReportType>(m_queues).push(timestamp, report);
+        }
+
+      private:
+        ReportQueueTuple m_queues;
+    };
+
+} // namespace common
+} // namespace osvr
+
+#endif // INCLUDED_InterfaceReportQueues_h_GUID_52D3A871_E23E_4ABC_8963_49914DBE40D5
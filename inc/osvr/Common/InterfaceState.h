@@ -33,12 +33,13 @@
 #include <osvr/Common/Tracing.h>
 #include <osvr/TypePack/TypeKeyedTuple.h>
 #include <osvr/TypePack/Quote.h>
+#include <osvr/Util/SeqLock.h>
 
 // Library/third-party includes
-#include <boost/optional.hpp>
+// - none
 
 // Standard includes
-// - none
+#include <atomic>
 
 namespace osvr {
 namespace common {
@@ -50,10 +51,18 @@ namespace common {
         util::time::TimeValue timestamp;
     };
 
+    /// @brief The value published for a report type: the contents are only
+    /// meaningful if valid is true.
+    template <typename ReportType> struct StateMapEntry {
+        StateMapContents<ReportType> contents;
+        bool valid;
+    };
+
     /// @brief Alias taking a report type and returning a state map
-    /// value type.
+    /// value type: a seqlocked entry, so that while one thread (running
+    /// the context update) writes state, others can read it without locking.
     template <typename ReportType>
-    using StateMapValueType = boost::optional<StateMapContents<ReportType>>;
+    using StateMapValueType = util::SeqLock<StateMapEntry<ReportType>>;
 
     /// @brief Data structure mapping from a report type to an optional state
     /// value.
@@ -63,39 +72,73 @@ namespace common {
 
     /// @brief Class to maintain state for an interface for each report (and
     /// thus state) type explicitly enumerated.
+    ///
+    /// Only one thread may set state, but the getters are lock-free and may
+    /// be called from any thread concurrently with it. Each report type's
+    /// state (with its timestamp) is read as a consistent snapshot, but
+    /// reading two types is not one atomic snapshot.
     class InterfaceState {
       public:
         template <typename ReportType>
         void setStateFromReport(util::time::TimeValue const &timestamp,
                                 ReportType const &report) {
-            StateMapContents<ReportType> c;
-            c.state = reportState(report);
-            c.timestamp = timestamp;
-            typepack::get<ReportType, StateMap>(m_states) = c;
-            m_hasState = true;
+            StateMapEntry<ReportType> e;
+            e.contents.state = reportState(report);
+            e.contents.timestamp = timestamp;
+            e.valid = true;
+            auto &slot = typepack::get<ReportType, StateMap>(m_states);
+            m_keepHistory(slot);
+            slot.store(e);
+            m_hasState.store(true, std::memory_order_release);
         }
 
         template <typename ReportType> bool hasState() const {
-            // using typepack::get;
-            return m_hasState && bool(typepack::cget<ReportType>(m_states));
+            return m_hasState.load(std::memory_order_acquire) &&
+                   typepack::cget<ReportType>(m_states).load().valid;
         }
 
-        bool hasAnyState() const { return m_hasState; }
+        bool hasAnyState() const {
+            return m_hasState.load(std::memory_order_acquire);
+        }
 
         template <typename ReportType>
         void getState(util::time::TimeValue &timestamp,
                       traits::StateFromReport_t<ReportType> &state) const {
-            if (hasState<ReportType>()) {
-                timestamp = typepack::cget<ReportType>(m_states)->timestamp;
-                state = typepack::cget<ReportType>(m_states)->state;
+            auto const e = typepack::cget<ReportType>(m_states).load();
+            if (e.valid) {
+                timestamp = e.contents.timestamp;
+                state = e.contents.state;
             }
             /// @todo do we fail silently or throw exception if we are asked for
             /// state we don't have?
         }
 
+        /// @brief Get the pose state that preceded the current one, if any: a
+        /// minimal history for estimating motion from devices that report no
+        /// velocity.
+        bool getPreviousPoseState(util::time::TimeValue &timestamp,
+                                  OSVR_PoseState &state) const {
+            auto const e = m_previousPose.load();
+            if (!e.valid) {
+                return false;
+            }
+            timestamp = e.contents.timestamp;
+            state = e.contents.state;
+            return true;
+        }
+
       private:
+        /// @brief Only pose state keeps history, so this is a no-op for other
+        /// report types.
+        template <typename ReportType>
+        void m_keepHistory(StateMapValueType<ReportType> const &) {}
+        void m_keepHistory(StateMapValueType<OSVR_PoseReport> const &current) {
+            /// We are the only writer, so this load never retries.
+            m_previousPose.store(current.load());
+        }
         StateMap m_states;
-        bool m_hasState = false;
+        StateMapValueType<OSVR_PoseReport> m_previousPose;
+        std::atomic<bool> m_hasState{false};
     };
 
 } // namespace common
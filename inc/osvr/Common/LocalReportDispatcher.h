@@ -0,0 +1,153 @@
+/** @file
+    @brief Header
+
+    @date 2017
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2017 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef INCLUDED_LocalReportDispatcher_h_GUID_BE18A2A3_FD1F_4E27_BD04_E6550929B329
+#define INCLUDED_LocalReportDispatcher_h_GUID_BE18A2A3_FD1F_4E27_BD04_E6550929B329
+
+// Internal Includes
+#include <osvr/Common/Export.h>
+#include <osvr/Common/ReportTypes.h>
+#include <osvr/TypePack/TypeKeyedTuple.h>
+#include <osvr/Util/SharedPtr.h>
+#include <osvr/Util/TimeValue.h>
+#include <osvr/Util/UniquePtr.h>
+
+// Library/third-party includes
+#include <boost/noncopyable.hpp>
+
+// Standard includes
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace osvr {
+namespace common {
+    /// @brief Trait computing the storage for in-process subscribers to a
+    /// report type: handlers keyed by subscription ID.
+    struct LocalReportHandlerStorage {
+        template <typename ReportType>
+        using apply = std::vector<std::pair<
+            std::size_t, std::function<void(util::time::TimeValue const &,
+                                            ReportType const &)>>>;
+    };
+
+    using LocalReportHandlerTuple =
+        typepack::TypeKeyedTuple<traits::ReportTypeList,
+                                 LocalReportHandlerStorage>;
+
+    /// @brief Keeps a subscription to a device's local reports alive: the
+    /// handler is removed when this is destroyed.
+    class LocalReportSubscription : boost::noncopyable {
+      public:
+        explicit LocalReportSubscription(std::function<void()> unsubscribe)
+            : m_unsubscribe(std::move(unsubscribe)) {}
+        ~LocalReportSubscription() { m_unsubscribe(); }
+
+      private:
+        std::function<void()> m_unsubscribe;
+    };
+    typedef unique_ptr<LocalReportSubscription> LocalReportSubscriptionPtr;
+
+    /// @brief The in-process subscribers to one server device's reports,
+    /// which the device hands, as typed structs, straight to each subscriber
+    /// as it sends them.
+    ///
+    /// Like the server connection it bypasses, this is only to be used from
+    /// the server's thread (or with it paused for an async device's send),
+    /// and handlers must not subscribe or unsubscribe.
+    class LocalDeviceReports
+        : boost::noncopyable,
+          public enable_shared_from_this<LocalDeviceReports> {
+      public:
+        /// @brief Publisher: cheap check, so the device can skip building
+        /// reports nobody in-process wants.
+        template <typename ReportType> bool hasSubscribers() const {
+            return !typepack::cget<ReportType>(m_handlers).empty();
+        }
+
+        /// @brief Publisher: calls each subscriber for this report type.
+        template <typename ReportType>
+        void publish(util::time::TimeValue const &timestamp,
+                     ReportType const &report) const {
+            for (auto const &handler : typepack::cget<ReportType>(m_handlers)) {
+                handler.second(timestamp, report);
+            }
+        }
+
+        /// @brief Subscriber: adds a handler for a report type, taking
+        /// (util::time::TimeValue const &, ReportType const &), until the
+        /// returned subscription is destroyed.
+        template <typename ReportType, typename F>
+        LocalReportSubscriptionPtr subscribe(F &&handler) {
+            auto id = ++m_lastId;
+            typepack::get<ReportType>(m_handlers)
+                .emplace_back(id, std::forward<F>(handler));
+            auto self = shared_from_this();
+            return LocalReportSubscriptionPtr{new LocalReportSubscription(
+                [self, id] { self->m_unsubscribe<ReportType>(id); })};
+        }
+
+      private:
+        template <typename ReportType> void m_unsubscribe(std::size_t id) {
+            auto &handlers = typepack::get<ReportType>(m_handlers);
+            for (auto it = begin(handlers), e = end(handlers); it != e; ++it) {
+                if (it->first == id) {
+                    handlers.erase(it);
+                    return;
+                }
+            }
+        }
+        LocalReportHandlerTuple m_handlers;
+        std::size_t m_lastId = 0;
+    };
+    typedef shared_ptr<LocalDeviceReports> LocalDeviceReportsPtr;
+
+    /// @brief Lets analysis plugins' client contexts, running inside the
+    /// server, receive reports from the server's devices directly instead of
+    /// through a serialize/deserialize round trip on the server connection.
+    /// External clients still get everything through the connection.
+    class LocalReportDispatcher : boost::noncopyable {
+      public:
+        /// @brief Server side: gets (creating if needed) the subscriber list
+        /// of the named device, through which it will publish reports.
+        OSVR_COMMON_EXPORT LocalDeviceReportsPtr
+        getPublisher(std::string const &deviceName);
+
+        /// @brief Client side: gets the subscriber list of the named device,
+        /// or null if no device by that name publishes in this process.
+        OSVR_COMMON_EXPORT LocalDeviceReportsPtr
+        getDevice(std::string const &deviceName) const;
+
+      private:
+        std::unordered_map<std::string, LocalDeviceReportsPtr> m_devices;
+    };
+    typedef shared_ptr<LocalReportDispatcher> LocalReportDispatcherPtr;
+} // namespace common
+} // namespace osvr
+
+#endif // INCLUDED_LocalReportDispatcher_h_GUID_BE18A2A3_FD1F_4E27_BD04_E6550929B329
@@ -0,0 +1,94 @@
+/** @file
+    @brief Header
+
+    @date 2017
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2017 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_PathTreeDelta_h_GUID_B5226D23_173A_4980_BCC2_E869688C15BD
+#define INCLUDED_PathTreeDelta_h_GUID_B5226D23_173A_4980_BCC2_E869688C15BD
+
+// Internal Includes
+#include <osvr/Common/Export.h>
+
+// Library/third-party includes
+#include <json/value.h>
+
+// Standard includes
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace osvr {
+namespace common {
+    /// @brief Serialized path tree nodes (as produced by pathTreeToJson()),
+    /// keyed by their full path.
+    typedef std::map<std::string, Json::Value> SerializedNodeMap;
+
+    /// @brief Index a JSON array of serialized nodes by their "path" member.
+    OSVR_COMMON_EXPORT SerializedNodeMap
+    mapNodesByPath(Json::Value const &nodes);
+
+    /// @brief Turn a node map back into a JSON array of nodes, in path order.
+    OSVR_COMMON_EXPORT Json::Value
+    nodeMapToJson(SerializedNodeMap const &nodes);
+
+    /// @brief A revision of a path tree, expressed either in full or as the
+    /// changes from an earlier revision.
+    struct PathTreeDelta {
+        /// @brief Revision of the tree this delta produces. Revisions start at
+        /// 1.
+        std::uint32_t revision = 0;
+        /// @brief Revision this delta must be applied to, or 0 if the delta
+        /// holds the entire tree.
+        std::uint32_t baseRevision = 0;
+        /// @brief Nodes added or changed: complete serialized nodes.
+        std::vector<Json::Value> upserted;
+        /// @brief Paths of nodes removed.
+        std::vector<std::string> removed;
+
+        bool isFull() const { return baseRevision == 0; }
+        /// @brief Whether applying this delta would change nothing.
+        bool empty() const {
+            return !isFull() && upserted.empty() && removed.empty();
+        }
+    };
+
+    /// @brief Compute the delta taking the tree from @p base (at revision @p
+    /// baseRevision) to @p current (at revision @p revision).
+    OSVR_COMMON_EXPORT PathTreeDelta makePathTreeDelta(
+        SerializedNodeMap const &base, SerializedNodeMap const &current,
+        std::uint32_t baseRevision, std::uint32_t revision);
+
+    /// @brief Wrap an entire tree as a delta at the given revision.
+    OSVR_COMMON_EXPORT PathTreeDelta
+    makeFullPathTreeDelta(SerializedNodeMap const &current,
+                          std::uint32_t revision);
+
+    /// @brief Apply a delta to a node map: replaces the map contents entirely
+    /// for a full delta. Does not check the base revision - that's up to the
+    /// caller.
+    OSVR_COMMON_EXPORT void applyPathTreeDelta(SerializedNodeMap &nodes,
+                                               PathTreeDelta const &delta);
+} // namespace common
+} // namespace osvr
+
+#endif // INCLUDED_PathTreeDelta_h_GUID_B5226D23_173A_4980_BCC2_E869688C15BD
@@ -35,10 +35,28 @@
 #include <json/value.h>
 
 // Standard includes
+#include <map>
+#include <set>
+#include <string>
 #include <vector>
 
 namespace osvr {
 namespace common {
+    /// @brief The structural difference between two versions of a path tree,
+    /// as sets of full node paths.
+    struct PathTreeDiff {
+        /// @brief Nodes present only in the new tree.
+        std::set<std::string> added;
+        /// @brief Nodes present only in the old tree.
+        std::set<std::string> removed;
+        /// @brief Nodes present in both, with different contents.
+        std::set<std::string> changed;
+
+        bool empty() const {
+            return added.empty() && removed.empty() && changed.empty();
+        }
+    };
+
     /// @brief Object responsible for owning a path tree (specifically a
     /// "downstream"/client path tree), replacing its contents from
     /// JSON-serialized data, and notifying a collection of observers of such
@@ -67,8 +85,18 @@ namespace common {
 
         /// @brief Replace the entirety of the path tree from the given
         /// serialized array of nodes.
+        ///
+        /// The new nodes are first compared against the current ones: if
+        /// nothing differs (and the tree was already populated), the tree is
+        /// left alone and observers are not notified. Otherwise, the
+        /// difference is available from getLastDiff() for the duration of the
+        /// update notifications (and until the next update).
         OSVR_COMMON_EXPORT void replaceTree(Json::Value const &nodes);
 
+        /// @brief Get the difference between the tree before and after the
+        /// most recent update.
+        PathTreeDiff const &getLastDiff() const { return m_lastDiff; }
+
         /// @brief Access the path tree object itself
         PathTree &get() { return m_tree; }
 
@@ -78,6 +106,10 @@ namespace common {
       private:
         PathTree m_tree;
         std::vector<PathTreeObserverWeakPtr> m_observers;
+        /// @brief Serialized nodes of the current tree, by path, to diff
+        /// against.
+        std::map<std::string, Json::Value> m_nodesByPath;
+        PathTreeDiff m_lastDiff;
         bool m_valid = false;
     };
 } // namespace common
@@ -0,0 +1,66 @@
+/** @file
+    @brief Header
+
+    @date 2017
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2017 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_PosePrediction_h_GUID_C53A9E07_1B84_4F6D_8D2E_6A0F4B97E1C5
+#define INCLUDED_PosePrediction_h_GUID_C53A9E07_1B84_4F6D_8D2E_6A0F4B97E1C5
+
+// Internal Includes
+#include <osvr/Common/Export.h>
+#include <osvr/Common/InterfaceState.h>
+#include <osvr/Util/ClientReportTypesC.h>
+#include <osvr/Util/TimeValue.h>
+
+// Library/third-party includes
+// - none
+
+// Standard includes
+// - none
+
+namespace osvr {
+namespace common {
+    /// @brief The furthest ahead of the latest pose report that a prediction
+    /// will extrapolate, in seconds: beyond this, a constant-velocity
+    /// model does more harm than good.
+    static const double MAX_POSE_PREDICTION_INTERVAL = 0.1;
+
+    /// @brief Predicts the pose of an interface at a target time (typically
+    /// the scan-out time of the display) from its latest pose state.
+    ///
+    /// Uses the interface's velocity and acceleration states when they are
+    /// present and not older than the pose; otherwise, estimates velocity from
+    /// the previous pose state. Target times before the latest pose return
+    /// that pose unchanged, and those more than
+    /// MAX_POSE_PREDICTION_INTERVAL after it are clamped.
+    ///
+    /// @return false (leaving the outputs untouched) if there is no pose
+    /// state.
+    OSVR_COMMON_EXPORT bool
+    predictPoseState(InterfaceState const &state,
+                     util::time::TimeValue const &targetTime,
+                     util::time::TimeValue &reportTime, OSVR_PoseState &pose);
+
+} // namespace common
+} // namespace osvr
+
+#endif // INCLUDED_PosePrediction_h_GUID_C53A9E07_1B84_4F6D_8D2E_6A0F4B97E1C5
@@ -30,9 +30,12 @@
 #include <osvr/Util/StringIds.h>
 
 // Library/third-party includes
+#include <boost/utility/string_ref.hpp>
 #include <json/value.h>
 
 // Standard includes
+#include <cstdint>
+#include <string>
 #include <vector>
 
 namespace osvr {
@@ -40,17 +43,22 @@ namespace common {
 
     /// Centralize a string registry. Basically, the server side, and part
     /// of the client side internals.
+    ///
+    /// IDs are indices into a vector of the strings, so they are stable;
+    /// lookups by string go through a hash index, and take a string_ref so
+    /// that a string literal or other C string needs no temporary
+    /// std::string.
     class RegisteredStringMap {
       public:
         /// register new ID with given string and returns StringID.
         /// If string already exists, then it returns existing StringID
         OSVR_COMMON_EXPORT util::StringID
-        registerStringID(std::string const &str);
+        registerStringID(boost::string_ref str);
 
         /// retrieve the StringID associated with the given string
         /// returns an empty util::StringID if it was not found
         OSVR_COMMON_EXPORT util::StringID
-        getStringID(std::string const &str) const;
+        getStringID(boost::string_ref str) const;
 
         /// retrieve the name of the string given the ID
         /// returns empty string if nothing found
@@ -70,6 +78,23 @@ namespace common {
 
         /// special flag that gets switched whenever new element is inserted;
         bool m_modified = false;
+
+      private:
+        /// @brief Returns the index of the entry equal to str (which has the
+        /// given hash), or m_regEntries.size() if there is none.
+        std::size_t m_find(boost::string_ref str, std::uint32_t hash) const;
+        /// @brief Adds the last entry to the index, growing it if needed.
+        void m_indexLastEntry();
+        /// @brief Rebuilds the index with the given (power of two) number of
+        /// slots.
+        void m_rebuildIndex(std::size_t slots);
+
+        /// Open-addressing (linear probing) hash index: each slot holds an
+        /// index into m_regEntries plus one, or 0 if the slot is empty.
+        std::vector<std::uint32_t> m_index;
+        /// Hash of each entry, parallel to m_regEntries, so probing mostly
+        /// skips string comparisons and growing the index skips rehashing.
+        std::vector<std::uint32_t> m_hashes;
     };
 
     /// This is like a RegisteredStringMap, except it also knows that some peer
@@ -81,11 +106,12 @@ namespace common {
         /// register new ID with given string and returns StringID.
         /// If string already exists, then it returns existing StringID
         OSVR_COMMON_EXPORT util::StringID
-        registerStringID(std::string const &str);
+        registerStringID(boost::string_ref str);
 
         /// retrieve the StringID associated with the given string
         /// returns an empty util::StringID if it's not found
-        OSVR_COMMON_EXPORT util::StringID getStringID(std::string const &str) const;
+        OSVR_COMMON_EXPORT util::StringID
+        getStringID(boost::string_ref str) const;
 
         /// retrieve the name of the string given the ID
         /// returns empty string if nothing found
@@ -0,0 +1,113 @@
+/** @file
+    @brief Header
+
+    @date 2017
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2017 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_ReportLatencyStats_h_GUID_7E1C4F52_9D3A_4B86_A0E5_2F6B81C7D493
+#define INCLUDED_ReportLatencyStats_h_GUID_7E1C4F52_9D3A_4B86_A0E5_2F6B81C7D493
+
+// Internal Includes
+#include <osvr/Common/Export.h>
+#include <osvr/Util/TimeValue.h>
+
+// Library/third-party includes
+// - none
+
+// Standard includes
+#include <array>
+#include <cstdint>
+
+namespace osvr {
+namespace common {
+
+    /// @brief Accumulates statistics on the reports arriving for an
+    /// interface: how many, how often, and how old each was on arrival (the
+    /// time from its timestamp, as set by the plugin or by the server at send,
+    /// to its receipt by the client).
+    ///
+    /// Ages are binned in a fixed histogram (10us resolution below 1ms,
+    /// coarsening by a factor of 10 per decade up to 1s), so recording is
+    /// constant-time and allocation-free, and percentiles are reported as the
+    /// upper bound of the bin they fall in. Ages are only meaningful if the
+    /// report timestamps come from the same clock as the client's, as they do
+    /// when server and client share a machine.
+    class ReportLatencyStats {
+      public:
+        OSVR_COMMON_EXPORT ReportLatencyStats();
+
+        /// @brief Record a report with the given timestamp, received at the
+        /// given time.
+        OSVR_COMMON_EXPORT void
+        recordReport(util::time::TimeValue const &reportTime,
+                     util::time::TimeValue const &receivedTime);
+
+        /// @brief Forget everything recorded so far.
+        OSVR_COMMON_EXPORT void reset();
+
+        /// @brief Number of reports recorded.
+        std::uint64_t getReportCount() const { return m_count; }
+
+        /// @brief Number of reports whose timestamp was earlier than that of
+        /// the report before them: a symptom of reordering or dropped data
+        /// upstream.
+        std::uint64_t getOutOfOrderCount() const { return m_outOfOrder; }
+
+        /// @brief Average reports per second, between the first and last
+        /// report received, or 0 if fewer than two reports.
+        OSVR_COMMON_EXPORT double getReportRate() const;
+
+        /// @brief Report age, in microseconds, that the given fraction
+        /// (between 0 and 1) of reports did not exceed, or 0 if no reports.
+        OSVR_COMMON_EXPORT std::int64_t
+        getLatencyPercentile(double fraction) const;
+
+        /// @brief Largest report age, in microseconds.
+        std::int64_t getMaxLatency() const { return m_max; }
+
+      private:
+        enum {
+            /// @brief Decades of age covered: 1ms, 10ms, 100ms, 1s
+            DECADES = 4,
+            /// @brief Bins for ages under 1ms, at 10us each.
+            FIRST_DECADE_BINS = 100,
+            /// @brief Bins for each subsequent decade, at a tenth of the
+            /// decade's upper limit each.
+            DECADE_BINS = 90,
+            /// @brief Plus one for ages of 1 second or more.
+            NUM_BINS = FIRST_DECADE_BINS + DECADE_BINS * (DECADES - 1) + 1
+        };
+        static std::size_t binForLatency(std::int64_t usec);
+        static std::int64_t upperBoundForBin(std::size_t bin);
+
+        std::array<std::uint32_t, NUM_BINS> m_bins;
+        std::uint64_t m_count;
+        std::uint64_t m_outOfOrder;
+        std::int64_t m_max;
+        util::time::TimeValue m_firstReceived;
+        util::time::TimeValue m_lastReceived;
+        util::time::TimeValue m_lastReportTime;
+    };
+
+} // namespace common
+} // namespace osvr
+
+#endif // INCLUDED_ReportLatencyStats_h_GUID_7E1C4F52_9D3A_4B86_A0E5_2F6B81C7D493
@@ -0,0 +1,122 @@
+/** @file
+    @brief Header
+
+    @date 2017
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2017 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_RigidTransform_h_GUID_D65348BB_1FBD_4973_8A01_1783F0B2DEFB
+#define INCLUDED_RigidTransform_h_GUID_D65348BB_1FBD_4973_8A01_1783F0B2DEFB
+
+// Internal Includes
+#include <osvr/Common/Transform.h>
+
+// Library/third-party includes
+#include <osvr/Util/EigenCoreGeometry.h>
+
+// Standard includes
+// - none
+
+namespace osvr {
+namespace common {
+
+    /// @brief A Transform whose pre and post components are both rigid
+    /// (rotation and translation only), stored as quaternions and
+    /// translations so it can be applied to poses and derivatives with a few
+    /// quaternion operations rather than 4x4 matrix products.
+    ///
+    /// Results match those of the Transform it was made from.
+    class RigidTransform {
+      public:
+        RigidTransform()
+            : m_preRotation(Eigen::Quaterniond::Identity()),
+              m_preTranslation(Eigen::Vector3d::Zero()),
+              m_postRotation(Eigen::Quaterniond::Identity()),
+              m_postTranslation(Eigen::Vector3d::Zero()) {}
+
+        EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+        /// @brief Sets this object from a Transform, if its pre and post
+        /// matrices are both rigid.
+        ///
+        /// @return false (leaving this object unchanged) if either includes
+        /// scaling, shear or projection.
+        bool assign(Transform const &xform) {
+            if (!isRigid(xform.getPre()) || !isRigid(xform.getPost())) {
+                return false;
+            }
+            m_preRotation = Eigen::Quaterniond(
+                Eigen::Matrix3d(xform.getPre().topLeftCorner<3, 3>()));
+            m_preRotation.normalize();
+            m_preTranslation = xform.getPre().topRightCorner<3, 1>();
+            m_postRotation = Eigen::Quaterniond(
+                Eigen::Matrix3d(xform.getPost().topLeftCorner<3, 3>()));
+            m_postRotation.normalize();
+            m_postTranslation = xform.getPost().topRightCorner<3, 1>();
+            return true;
+        }
+
+        /// @brief Apply the transformation to a pose given as orientation and
+        /// position, in place. Equivalent to Transform::transform().
+        void transformPose(Eigen::Quaterniond &rotation,
+                           Eigen::Vector3d &translation) const {
+            translation = m_postRotation *
+                              (rotation * m_preTranslation + translation) +
+                          m_postTranslation;
+            rotation = m_postRotation * rotation * m_preRotation;
+        }
+
+        /// @brief Apply only the rotation to a vector representing a velocity
+        /// or acceleration. Equivalent to Transform::transformDerivative().
+        Eigen::Vector3d transformDerivative(Eigen::Vector3d const &vec) const {
+            return m_postRotation * vec;
+        }
+
+        /// @brief Transform a rotational derivative: angular velocity or
+        /// acceleration. Equivalent to Transform::transformDerivative().
+        Eigen::Quaterniond
+        transformDerivative(Eigen::Quaterniond const &quat) const {
+            return m_postRotation * quat * m_postRotation.conjugate();
+        }
+
+        /// @brief Checks whether a matrix is a rigid transformation: an
+        /// orthonormal, right-handed rotation block, and no projective part.
+        static bool isRigid(Eigen::Matrix4d const &mat) {
+            static const double TOLERANCE = 1e-9;
+            if (!mat.bottomRows<1>().isApprox(
+                    Eigen::RowVector4d(0, 0, 0, 1), TOLERANCE)) {
+                return false;
+            }
+            Eigen::Matrix3d rot = mat.topLeftCorner<3, 3>();
+            return (rot.transpose() * rot).isIdentity(TOLERANCE) &&
+                   rot.determinant() > 0;
+        }
+
+      private:
+        Eigen::Quaterniond m_preRotation;
+        Eigen::Vector3d m_preTranslation;
+        Eigen::Quaterniond m_postRotation;
+        Eigen::Vector3d m_postTranslation;
+    };
+
+} // namespace common
+} // namespace osvr
+
+#endif // INCLUDED_RigidTransform_h_GUID_D65348BB_1FBD_4973_8A01_1783F0B2DEFB
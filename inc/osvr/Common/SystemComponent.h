@@ -31,12 +31,15 @@
 #include <osvr/Common/DeviceComponent.h>
 #include <osvr/Common/SerializationTags.h>
 #include <osvr/Common/PathTree_fwd.h>
+#include <osvr/Common/PathTreeDelta.h>
 
 // Library/third-party includes
 #include <json/value.h>
 
 // Standard includes
-// - none
+#include <cstdint>
+#include <functional>
+#include <vector>
 
 namespace osvr {
 namespace common {
@@ -69,6 +72,20 @@ namespace common {
             class MessageSerialization;
             static const char *identifier();
         };
+
+        class PathTreeDeltaFromServer
+            : public MessageRegistration<PathTreeDeltaFromServer> {
+          public:
+            class MessageSerialization;
+            static const char *identifier();
+        };
+
+        class TreeRevisionAckToServer
+            : public MessageRegistration<TreeRevisionAckToServer> {
+          public:
+            class MessageSerialization;
+            static const char *identifier();
+        };
     } // namespace messages
 
     /// @brief BaseDevice component, to be used only with the "OSVR" special
@@ -108,17 +125,58 @@ namespace common {
 
         typedef std::function<void(Json::Value const &,
                                    util::time::TimeValue const &)> JsonHandler;
+        /// @brief Registering a handler here also subscribes to binary tree
+        /// deltas: those are applied to a locally-kept copy of the tree, and
+        /// the handler is called with the whole resulting tree, just as if
+        /// it had come in a replacement tree message. Once a binary delta has
+        /// been seen, (redundant) JSON replacement trees are ignored.
         OSVR_COMMON_EXPORT void registerReplaceTreeHandler(JsonHandler cb);
 
+        /// @brief Sends the full tree as JSON (understood by all clients).
         OSVR_COMMON_EXPORT void sendReplacementTree(PathTree &tree);
+        /// @overload
+        ///
+        /// Takes an already-serialized tree, as from pathTreeToJson()
+        OSVR_COMMON_EXPORT void sendReplacementTree(Json::Value const &nodes);
+
+        /// @brief Message from server, carrying a path tree revision in
+        /// compact binary form, either complete or relative to an earlier
+        /// revision.
+        messages::PathTreeDeltaFromServer treeDeltaOut;
+
+        OSVR_COMMON_EXPORT void sendPathTreeDelta(PathTreeDelta const &delta);
+
+        /// @brief Message from client, reporting the tree revision it holds
+        /// after handling a delta. A revision other than the one just sent
+        /// (such as 0) means the client could not apply the delta and needs
+        /// a full tree.
+        messages::TreeRevisionAckToServer treeRevisionAckIn;
+
+        OSVR_COMMON_EXPORT void sendTreeRevisionAck(std::uint32_t revision);
+
+        typedef std::function<void(std::uint32_t)> TreeRevisionAckHandler;
+        OSVR_COMMON_EXPORT void
+        registerTreeRevisionAckHandler(TreeRevisionAckHandler cb);
 
       private:
         SystemComponent();
         virtual void m_parentSet();
         static int VRPN_CALLBACK
         m_handleReplaceTree(void *userdata, vrpn_HANDLERPARAM p);
+        static int VRPN_CALLBACK
+        m_handlePathTreeDelta(void *userdata, vrpn_HANDLERPARAM p);
+        static int VRPN_CALLBACK
+        m_handleTreeRevisionAck(void *userdata, vrpn_HANDLERPARAM p);
 
         std::vector<JsonHandler> m_replaceTreeHandlers;
+        std::vector<TreeRevisionAckHandler> m_treeRevisionAckHandlers;
+
+        /// @name Client-side state for applying tree deltas
+        /// @{
+        SerializedNodeMap m_treeNodes;
+        std::uint32_t m_treeRevision = 0;
+        bool m_gotBinaryTree = false;
+        /// @}
     };
 } // namespace common
 } // namespace osvr
@@ -34,6 +34,7 @@
 
 // Standard includes
 #include <cstdint>
+#include <iosfwd>
 #include <string>
 
 namespace osvr {
@@ -78,6 +79,26 @@ namespace common {
                                       std::string const &string) {
             Policy::mark((fixedString + string).c_str());
         }
+
+        /// @name Recording control for the portable (non-ETW) backend
+        ///
+        /// Events are only recorded while recording is on: it starts off
+        /// unless the OSVR_TRACE_FILE environment variable names a file, in
+        /// which case it starts on and the trace is written there at exit.
+        /// With the ETW backend, these do nothing.
+        /// @{
+        /// @brief Turns recording of trace events on or off.
+        OSVR_COMMON_EXPORT void setRecording(bool enable);
+        /// @brief Is recording of trace events on?
+        OSVR_COMMON_EXPORT bool isRecording();
+        /// @brief Writes the recorded events still held in the per-thread
+        /// buffers in the Chrome trace event JSON format, which both
+        /// chrome://tracing and the Perfetto UI load.
+        /// @return false if there's no recorded trace to write.
+        OSVR_COMMON_EXPORT bool writeChromeTrace(std::ostream &os);
+        /// @overload
+        OSVR_COMMON_EXPORT bool writeChromeTrace(std::string const &filename);
+        /// @}
 #else  // OSVR_COMMON_TRACING_ENABLED ^^ // vv !OSVR_COMMON_TRACING_ENABLED
         struct MainTracePolicy {
             static TraceBeginStamp begin(const char *) { return 0; }
@@ -101,6 +122,10 @@ namespace common {
         inline void driverUpdateEnd(TraceBeginStamp) {}
         template <typename Policy>
         inline void markConcatenation(const char *, std::string const &) {}
+        inline void setRecording(bool) {}
+        inline bool isRecording() { return false; }
+        inline bool writeChromeTrace(std::ostream &) { return false; }
+        inline bool writeChromeTrace(std::string const &) { return false; }
 #endif // !OSVR_COMMON_TRACING_ENABLED
 
         // -- Common code between dummy implementation and real implementation
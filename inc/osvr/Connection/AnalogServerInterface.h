@@ -54,6 +54,10 @@ namespace connection {
         /// and reports changes with the given timestamp
         virtual void setValues(value_type val[], OSVR_ChannelCount chans,
                                util::time::TimeValue const &timestamp) = 0;
+
+        /// @brief Gets the number of channels, which is fixed at construction
+        /// (so may be called from any thread).
+        virtual OSVR_ChannelCount getNumChannels() const = 0;
     };
 
 } // namespace connection
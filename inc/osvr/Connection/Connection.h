@@ -31,6 +31,7 @@
 #include <osvr/Connection/ConnectionDevicePtr.h>
 #include <osvr/Connection/ConnectionPtr.h>
 #include <osvr/Connection/DeviceInitObject.h>
+#include <osvr/Common/LocalReportDispatcher.h>
 #include <osvr/Util/DeviceCallbackTypesC.h>
 #include <osvr/PluginHost/RegistrationContext_fwd.h>
 #include <osvr/Util/Log.h>
@@ -44,6 +45,7 @@
 #include <string>
 #include <vector>
 #include <functional>
+#include <map>
 #include <tuple>
 
 namespace osvr {
@@ -125,6 +127,38 @@ namespace connection {
         /// handlers.
         OSVR_CONNECTION_EXPORT void triggerDescriptorHandlers();
 
+        /// @brief Register a function to be called, from any thread, when
+        /// there is new work for whoever is calling process() (for instance,
+        /// an async device has queued a report).
+        ///
+        /// Handlers must be registered before any device threads start, and
+        /// must be thread-safe and quick.
+        OSVR_CONNECTION_EXPORT void
+        registerWakeupHandler(std::function<void()> handler);
+
+        /// @brief Call any/all wakeup handlers: safe to call from any thread.
+        OSVR_CONNECTION_EXPORT void signalWakeup();
+
+        /// @brief Request that sync devices subsequently created by the named
+        /// plugin each run in a thread of their own, calling their update
+        /// callback then sleeping the given number of microseconds, in a
+        /// loop. Their reports are handed to the thread calling process().
+        OSVR_CONNECTION_EXPORT void
+        setSyncDeviceThread(std::string const &pluginName,
+                            int sleepMicroseconds);
+
+        /// @brief Gets the sleep time between updates of the named plugin's
+        /// sync devices, if they should run in their own threads.
+        OSVR_CONNECTION_EXPORT boost::optional<int>
+        getSyncDeviceThread(std::string const &pluginName) const;
+
+        /// @brief Gets the dispatcher through which devices on this
+        /// connection also hand their reports directly to in-process
+        /// subscribers (analysis plugins' client contexts).
+        common::LocalReportDispatcherPtr const &getLocalReportDispatcher() {
+            return m_localReports;
+        }
+
         /// @brief Destructor
         OSVR_CONNECTION_EXPORT virtual ~Connection();
 
@@ -203,6 +237,9 @@ namespace connection {
       private:
         DeviceList m_devices;
         std::vector<std::function<void()> > m_descriptorHandlers;
+        std::vector<std::function<void()> > m_wakeupHandlers;
+        std::map<std::string, int> m_syncDeviceThreads;
+        common::LocalReportDispatcherPtr m_localReports;
         util::log::LoggerPtr m_log;
     };
 } // namespace connection
@@ -33,7 +33,7 @@
 #include <boost/assert.hpp>
 
 // Standard includes
-// - none
+#include <utility>
 
 namespace osvr {
 namespace connection {
@@ -49,6 +49,12 @@ namespace connection {
                                                  "with a device token!");
             return m_token->getSendGuard();
         }
+        bool queueSend(DeviceToken::SendFunction &&f) {
+            BOOST_ASSERT_MSG(m_token != nullptr, "Can't send before we've "
+                                                 "been supplied with a "
+                                                 "device token!");
+            return m_token->queueSend(std::move(f));
+        }
 
       private:
         DeviceToken *m_token = nullptr;
@@ -114,6 +114,21 @@ struct OSVR_DeviceTokenObject : boost::noncopyable {
 
     OSVR_CONNECTION_EXPORT osvr::util::GuardPtr getSendGuard();
 
+    /// @brief A function that sends on one of this device's interfaces by
+    /// talking to the connection directly.
+    using SendFunction = std::function<void()>;
+
+    /// @brief Runs a send function where it is safe to touch the connection,
+    /// in order with sendData() reports: right away for devices updated in
+    /// the server thread, or from the next connectionInteract call for
+    /// devices with a thread of their own, so those needn't wait for it.
+    ///
+    /// The function may run after this returns, so it must hold copies of
+    /// whatever it sends rather than refer to the caller's arguments.
+    ///
+    /// @return false if the function was dropped without being run.
+    OSVR_CONNECTION_EXPORT bool queueSend(SendFunction &&f);
+
     /// @brief Interact with connection. Only legal to end up in
     /// ConnectionDevice::sendData from within here somehow.
     void connectionInteract();
@@ -147,6 +162,8 @@ struct OSVR_DeviceTokenObject : boost::noncopyable {
                             osvr::connection::MessageType *type,
                             const char *bytestream, size_t len) = 0;
     virtual osvr::util::GuardPtr m_getSendGuard() = 0;
+    /// @brief Default implementation runs the function under a send guard.
+    virtual bool m_queueSend(SendFunction &&f);
     virtual void m_connectionInteract() = 0;
     virtual void m_stopThreads();
 
@@ -89,6 +89,59 @@ namespace pluginkit {
         OSVR_ChannelCount m_sensor;
     };
 
+    /// @brief A frame buffer placed directly in the server's shared memory, so
+    /// a frame can be captured or decoded into it without an extra copy.
+    /// Obtain one with osvr::pluginkit::ImagingInterface::acquireFrameBuffer()
+    /// and send it with osvr::pluginkit::ImagingInterface::sendFrameBuffer().
+    ///
+    /// If it is destroyed without being sent, clients are never told about
+    /// the frame, so they won't read it - but its shared memory slot is still
+    /// used up, replacing the oldest frame in the ring.
+    class ImagingFrameBuffer {
+      public:
+        ImagingFrameBuffer() : m_dev(NULL), m_iface(NULL), m_frameBuf(NULL) {}
+        ~ImagingFrameBuffer() { reset(); }
+
+        /// @brief Whether this object currently holds a frame buffer.
+        bool valid() const { return m_frameBuf != NULL; }
+
+        /// @brief Retrieves a cv::Mat header referring to the shared memory
+        /// buffer: write the image into it (without reallocating it!)
+        cv::Mat const &getFrame() const { return m_frame; }
+
+        /// @brief Retrieves the raw buffer pointer.
+        OSVR_ImageBufferElement *getBuf() const { return m_frame.data; }
+
+        /// @brief Discards the frame buffer, if any, without sending it.
+        void reset() {
+            if (m_frameBuf) {
+                osvrDeviceImagingReleaseFrameBuffer(m_dev, m_iface, m_frameBuf);
+            }
+            m_frameBuf = NULL;
+            m_frame = cv::Mat();
+        }
+
+      private:
+        friend class ImagingInterface;
+        // noncopyable
+        ImagingFrameBuffer(ImagingFrameBuffer const &);
+        // nonassignable
+        ImagingFrameBuffer &operator=(ImagingFrameBuffer const &);
+
+        /// @brief Hands over ownership of the handle, leaving this object
+        /// empty.
+        OSVR_ImagingFrameBuffer release() {
+            OSVR_ImagingFrameBuffer ret = m_frameBuf;
+            m_frameBuf = NULL;
+            m_frame = cv::Mat();
+            return ret;
+        }
+        OSVR_DeviceToken m_dev;
+        OSVR_ImagingDeviceInterface m_iface;
+        OSVR_ImagingFrameBuffer m_frameBuf;
+        cv::Mat m_frame;
+    };
+
     /// @brief A class wrapping an imaging interface for a device.
     class ImagingInterface {
       public:
@@ -120,17 +173,8 @@ namespace pluginkit {
                     "Must initialize the imaging interface before using it!");
             }
             cv::Mat const &frame(message.getFrame());
-            util::NumberTypeData typedata =
-                util::opencvNumberTypeData(frame.type());
-            OSVR_ImagingMetadata metadata;
-            metadata.channels = frame.channels();
-            metadata.depth = static_cast<OSVR_ImageDepth>(typedata.getSize());
-            metadata.width = frame.cols;
-            metadata.height = frame.rows;
-            metadata.type = typedata.isFloatingPoint()
-                                ? OSVR_IVT_FLOATING_POINT
-                                : (typedata.isSigned() ? OSVR_IVT_SIGNED_INT
-                                                       : OSVR_IVT_UNSIGNED_INT);
+            OSVR_ImagingMetadata metadata =
+                computeMetadata(frame.size(), frame.type());
 
             OSVR_ReturnCode ret = osvrDeviceImagingReportFrame(
                 dev, m_iface, metadata, message.getBuf(), message.getSensor(),
@@ -140,7 +184,64 @@ namespace pluginkit {
             }
         }
 
+        /// @brief Reserves a frame buffer in shared memory for a frame of the
+        /// given size and OpenCV type, replacing any frame buffer already held
+        /// by frameBuf.
+        ///
+        /// @return false if shared memory is unavailable, in which case send
+        /// an osvr::pluginkit::ImagingMessage instead.
+        bool acquireFrameBuffer(DeviceToken &dev, ImagingFrameBuffer &frameBuf,
+                                cv::Size size, int type,
+                                OSVR_ChannelCount sensor = 0) {
+            if (!m_iface) {
+                throw std::logic_error(
+                    "Must initialize the imaging interface before using it!");
+            }
+            frameBuf.reset();
+            OSVR_ImageBufferElement *buf = NULL;
+            OSVR_ReturnCode ret = osvrDeviceImagingAcquireFrameBuffer(
+                dev, m_iface, computeMetadata(size, type), sensor,
+                &frameBuf.m_frameBuf, &buf);
+            if (OSVR_RETURN_SUCCESS != ret) {
+                return false;
+            }
+            frameBuf.m_dev = dev;
+            frameBuf.m_iface = m_iface;
+            frameBuf.m_frame = cv::Mat(size, type, buf);
+            return true;
+        }
+
+        /// @brief Sends a frame buffer obtained from acquireFrameBuffer() and
+        /// filled in, leaving frameBuf empty.
+        void sendFrameBuffer(DeviceToken &dev, ImagingFrameBuffer &frameBuf,
+                             OSVR_TimeValue const &timestamp) {
+            if (!frameBuf.valid()) {
+                throw std::logic_error(
+                    "Must acquire a frame buffer before sending it!");
+            }
+            OSVR_ReturnCode ret = osvrDeviceImagingSendFrameBuffer(
+                dev, m_iface, frameBuf.release(), &timestamp);
+            if (OSVR_RETURN_SUCCESS != ret) {
+                throw std::runtime_error(
+                    "Could not send imaging frame buffer!");
+            }
+        }
+
       private:
+        static OSVR_ImagingMetadata computeMetadata(cv::Size size, int type) {
+            util::NumberTypeData typedata = util::opencvNumberTypeData(type);
+            OSVR_ImagingMetadata metadata;
+            metadata.channels = CV_MAT_CN(type);
+            metadata.depth = static_cast<OSVR_ImageDepth>(typedata.getSize());
+            metadata.width = size.width;
+            metadata.height = size.height;
+            metadata.type = typedata.isFloatingPoint()
+                                ? OSVR_IVT_FLOATING_POINT
+                                : (typedata.isSigned() ? OSVR_IVT_SIGNED_INT
+                                                       : OSVR_IVT_UNSIGNED_INT);
+            return metadata;
+        }
+
         OSVR_ImagingDeviceInterface m_iface;
     };
     /// @}
@@ -96,6 +96,73 @@ osvrDeviceImagingReportFrame(OSVR_IN_PTR OSVR_DeviceToken dev,
                              OSVR_IN OSVR_ChannelCount sensor,
                              OSVR_IN_PTR OSVR_TimeValue const *timestamp)
     OSVR_FUNC_NONNULL((1, 2, 4, 6));
+
+/** @brief Opaque type representing a frame buffer placed directly in the
+    server's shared memory, obtained from osvrDeviceImagingAcquireFrameBuffer()
+*/
+typedef struct OSVR_ImagingFrameBufferObject *OSVR_ImagingFrameBuffer;
+
+/** @brief Reserve a writable buffer, directly in the shared memory used to
+    deliver frames to clients, for a frame with the given metadata. Capturing
+    or decoding straight into this buffer, then sending it with
+    osvrDeviceImagingSendFrameBuffer(), avoids the full-frame copy done by
+    osvrDeviceImagingReportFrame().
+
+    Call this and the send/release functions from the same thread you would
+    report frames from. Until sent or released, the buffer is not available to
+    clients.
+
+    @param dev Device token
+    @param iface Imaging interface
+    @param metadata Image metadata, determining the buffer size
+    @param sensor Sensor number, usually 0
+    @param [out] frame The frame buffer handle, which must be passed to
+    osvrDeviceImagingSendFrameBuffer() or osvrDeviceImagingReleaseFrameBuffer()
+    @param [out] buffer The writable image buffer.
+
+    @return OSVR_RETURN_FAILURE if shared memory is unavailable, in which case
+    use osvrDeviceImagingReportFrame() instead.
+*/
+OSVR_PLUGINKIT_EXPORT
+OSVR_ReturnCode osvrDeviceImagingAcquireFrameBuffer(
+    OSVR_IN_PTR OSVR_DeviceToken dev,
+    OSVR_IN_PTR OSVR_ImagingDeviceInterface iface,
+    OSVR_IN OSVR_ImagingMetadata metadata, OSVR_IN OSVR_ChannelCount sensor,
+    OSVR_OUT_PTR OSVR_ImagingFrameBuffer *frame,
+    OSVR_OUT_PTR OSVR_ImageBufferElement **buffer)
+    OSVR_FUNC_NONNULL((1, 2, 5, 6));
+
+/** @brief Send a frame buffer you've filled, making it available to clients.
+    Always takes ownership of (and invalidates) the frame buffer handle.
+
+    @param dev Device token
+    @param iface Imaging interface
+    @param frame Frame buffer from osvrDeviceImagingAcquireFrameBuffer()
+    @param timestamp Timestamp correlating to frame.
+*/
+OSVR_PLUGINKIT_EXPORT
+OSVR_ReturnCode osvrDeviceImagingSendFrameBuffer(
+    OSVR_IN_PTR OSVR_DeviceToken dev,
+    OSVR_IN_PTR OSVR_ImagingDeviceInterface iface,
+    OSVR_IN_PTR OSVR_ImagingFrameBuffer frame,
+    OSVR_IN_PTR OSVR_TimeValue const *timestamp)
+    OSVR_FUNC_NONNULL((1, 2, 3, 4));
+
+/** @brief Discard a frame buffer without sending it (for instance, if the
+    capture failed), invalidating the handle.
+
+    Clients are never notified of a released frame, so they won't read it,
+    but its shared memory slot is still used up, replacing the oldest frame.
+
+    @param dev Device token
+    @param iface Imaging interface
+    @param frame Frame buffer from osvrDeviceImagingAcquireFrameBuffer()
+*/
+OSVR_PLUGINKIT_EXPORT
+OSVR_ReturnCode osvrDeviceImagingReleaseFrameBuffer(
+    OSVR_IN_PTR OSVR_DeviceToken dev,
+    OSVR_IN_PTR OSVR_ImagingDeviceInterface iface,
+    OSVR_IN_PTR OSVR_ImagingFrameBuffer frame) OSVR_FUNC_NONNULL((1, 2, 3));
 /** @} */ /* end of group */
 
 OSVR_EXTERN_C_END
@@ -235,13 +235,39 @@ namespace server {
             std::string const &path, std::string const &deviceName,
             std::string const &server, std::string const &descriptor);
 
-        /// @brief Sets the amount of time (in microseconds) that the server
-        /// loop will sleep each loop when a client is connected (0 means no
-        /// sleep)
+        /// @brief Sets the maximum amount of time (in microseconds) that the
+        /// server loop will sleep each loop when a client is connected (0
+        /// means no sleep)
+        ///
+        /// The sleep ends early when an async device has a report ready or
+        /// another thread has work for the server thread, so this mainly
+        /// bounds how often synchronous devices and the network are polled.
         ///
         /// Call only before starting the server or from within server thread.
         OSVR_SERVER_EXPORT void setSleepTime(int microseconds);
 
+        /// @brief Runs each sync device later created by the named plugin in
+        /// its own worker thread, instead of in the server thread, so a slow
+        /// update can't delay other devices. The device's update callback is
+        /// called, then the thread sleeps the given number of microseconds,
+        /// in a loop. Its reports are sent from the server thread.
+        ///
+        /// Only enable for plugins whose sync devices don't share unguarded
+        /// state with the rest of the plugin.
+        ///
+        /// Call only before loading the plugin, and before starting the
+        /// server or from within server thread.
+        OSVR_SERVER_EXPORT void setSyncDeviceThread(std::string const &plugin,
+                                                    int sleepMicroseconds);
+
+        /// @brief Sets whether the path tree is also broadcast as JSON, for
+        /// clients that predate the compact binary tree deltas. Defaults to
+        /// true: turning it off saves bandwidth and client parsing time, but
+        /// older clients will then never receive a path tree.
+        ///
+        /// Call only before starting the server or from within server thread.
+        OSVR_SERVER_EXPORT void setLegacyPathTreeBroadcast(bool enabled);
+
 #if 0
         /// @brief Returns the amount of time (in microseconds) that the server
         /// loop sleeps each loop.
@@ -0,0 +1,288 @@
+/** @file
+    @brief Header
+
+    @date 2017
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2017 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef INCLUDED_BinaryLog_h_GUID_DD397E27_EA23_48DF_B0C7_BE2DB2C32E9D
+#define INCLUDED_BinaryLog_h_GUID_DD397E27_EA23_48DF_B0C7_BE2DB2C32E9D
+
+// Internal Includes
+#include <osvr/Util/Export.h>
+#include <osvr/Util/LogLevel.h>
+#include <osvr/Util/SharedPtr.h>
+#include <osvr/Util/TimeValue.h>
+
+// Library/third-party includes
+// - none
+
+// Standard includes
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <type_traits>
+
+namespace osvr {
+namespace util {
+    namespace log {
+        /// @brief ID of a format string registered with
+        /// registerBinaryLogFormat()
+        typedef std::uint32_t BinaryLogFormatId;
+
+        /// @brief Most arguments a binary log record can carry.
+        static const std::size_t BINARY_LOG_MAX_ARGS = 6;
+        /// @brief Bytes in a record for copies of string arguments (longer
+        /// strings get truncated).
+        static const std::size_t BINARY_LOG_TEXT_BYTES = 64;
+
+        /// @brief A raw argument value, captured without formatting.
+        struct BinaryLogArg {
+            enum Type : std::uint8_t { Int, UInt, Double, Bool, Pointer, Text };
+            Type type;
+            union {
+                std::int64_t i;
+                std::uint64_t u;
+                double d;
+                bool b;
+                const void *p;
+                /// @brief For Text: location in the record's text buffer.
+                struct {
+                    std::uint16_t offset;
+                    std::uint16_t length;
+                } text;
+            } value;
+        };
+
+        /// @brief What the hot path records for each message: fixed size, so
+        /// it can live in a preallocated per-thread queue.
+        struct BinaryLogRecord {
+            time::TimeValue timestamp;
+            BinaryLogFormatId format;
+            std::uint16_t logger;
+            LogLevel level;
+            std::uint8_t argCount;
+            std::uint16_t textUsed;
+            BinaryLogArg args[BINARY_LOG_MAX_ARGS];
+            char text[BINARY_LOG_TEXT_BYTES];
+        };
+
+        /// @brief Registers a format string, in which each `{}` stands for
+        /// the next argument: typically done once per call site (see
+        /// OSVR_BINARY_LOG). The string must have static storage duration.
+        OSVR_UTIL_EXPORT BinaryLogFormatId
+        registerBinaryLogFormat(const char *format);
+
+        /// @brief Gets a registered format string, or nullptr if unknown.
+        OSVR_UTIL_EXPORT const char *getBinaryLogFormat(BinaryLogFormatId id);
+
+        /// @brief Formats a record, substituting its arguments into its
+        /// format string: what the background thread does, and what a tool
+        /// decoding saved records would do.
+        OSVR_UTIL_EXPORT std::string
+        formatBinaryLogRecord(BinaryLogRecord const &record);
+
+        /// @brief Handler for records drained by the background thread,
+        /// given the name of the logger that recorded them.
+        typedef std::function<void(std::string const &loggerName,
+                                   BinaryLogRecord const &record)>
+            BinaryLogHandler;
+
+        /// @brief Replaces what the background thread does with records
+        /// (for instance, to save them raw for decoding offline). An empty
+        /// handler restores the default: formatting each one into the text
+        /// logger (from make_logger()) of the same name.
+        OSVR_UTIL_EXPORT void setBinaryLogHandler(BinaryLogHandler handler);
+
+        /// @brief Drains all pending records right away, instead of waiting
+        /// for the background thread.
+        OSVR_UTIL_EXPORT void flushBinaryLogs();
+
+        class BinaryLogger;
+        typedef shared_ptr<BinaryLogger> BinaryLoggerPtr;
+
+        /// @brief Makes a logger for hot paths: rather than formatting text
+        /// on the calling thread, each message records just a format ID and
+        /// its raw arguments into a lock-free per-thread queue, and a
+        /// background thread formats it later. If that queue is full, the
+        /// message is dropped (and counted) rather than blocking.
+        OSVR_UTIL_EXPORT BinaryLoggerPtr
+        makeBinaryLogger(std::string const &name);
+
+        class BinaryLogger {
+          public:
+            BinaryLogger(BinaryLogger const &) = delete;
+            BinaryLogger &operator=(BinaryLogger const &) = delete;
+
+            std::string const &getName() const { return m_name; }
+
+            /// @brief Messages below this level are discarded right away.
+            void setLogLevel(LogLevel level) { m_level = level; }
+            LogLevel getLogLevel() const { return m_level; }
+
+            /// @brief Limits the messages recorded per second (0, the
+            /// default, for no limit): the rest are discarded and counted,
+            /// so diagnostics can stay enabled in production.
+            void setRateLimit(std::uint32_t messagesPerSecond) {
+                m_rateLimit = messagesPerSecond;
+            }
+
+            /// @brief Total messages discarded by the rate limit.
+            std::uint64_t getSuppressedCount() const { return m_suppressed; }
+
+            /// @brief Records a message: cheap enough for hot paths.
+            /// Arguments may be arithmetic types, pointers, or strings.
+            template <typename... Args>
+            void log(LogLevel level, BinaryLogFormatId format,
+                     Args const &... args) {
+                static_assert(sizeof...(Args) <= BINARY_LOG_MAX_ARGS,
+                              "Too many arguments for a binary log record");
+                if (level < m_level.load(std::memory_order_relaxed)) {
+                    return;
+                }
+                BinaryLogRecord record;
+                time::getNow(record.timestamp);
+                if (!m_admit(record.timestamp.seconds)) {
+                    return;
+                }
+                record.format = format;
+                record.logger = m_id;
+                record.level = level;
+                record.argCount = 0;
+                record.textUsed = 0;
+                int dummy[] = {0, (capture(record, args), 0)...};
+                (void)dummy;
+                m_submit(record);
+            }
+
+            /// @brief Constructor: use makeBinaryLogger() instead.
+            BinaryLogger(std::string const &name, std::uint16_t id);
+
+          private:
+            template <typename T>
+            static typename std::enable_if<std::is_integral<T>::value &&
+                                           std::is_signed<T>::value>::type
+            capture(BinaryLogRecord &record, T const &val) {
+                m_arg(record, BinaryLogArg::Int).value.i = val;
+            }
+            template <typename T>
+            static typename std::enable_if<std::is_integral<T>::value &&
+                                           std::is_unsigned<T>::value>::type
+            capture(BinaryLogRecord &record, T const &val) {
+                m_arg(record, BinaryLogArg::UInt).value.u = val;
+            }
+            template <typename T>
+            static typename std::enable_if<
+                std::is_floating_point<T>::value>::type
+            capture(BinaryLogRecord &record, T const &val) {
+                m_arg(record, BinaryLogArg::Double).value.d = val;
+            }
+            template <typename T>
+            static typename std::enable_if<std::is_enum<T>::value>::type
+            capture(BinaryLogRecord &record, T const &val) {
+                m_arg(record, BinaryLogArg::Int).value.i =
+                    static_cast<std::int64_t>(val);
+            }
+            static void capture(BinaryLogRecord &record, bool const &val) {
+                m_arg(record, BinaryLogArg::Bool).value.b = val;
+            }
+            static void capture(BinaryLogRecord &record, const void *val) {
+                m_arg(record, BinaryLogArg::Pointer).value.p = val;
+            }
+            static void capture(BinaryLogRecord &record, const char *val) {
+                m_captureText(record, val, std::strlen(val));
+            }
+            static void capture(BinaryLogRecord &record,
+                                std::string const &val) {
+                m_captureText(record, val.data(), val.size());
+            }
+            template <std::size_t N>
+            static void capture(BinaryLogRecord &record, char const (&val)[N]) {
+                m_captureText(record, val, std::strlen(val));
+            }
+
+            static BinaryLogArg &m_arg(BinaryLogRecord &record,
+                                       BinaryLogArg::Type type) {
+                auto &arg = record.args[record.argCount++];
+                arg.type = type;
+                return arg;
+            }
+            static void m_captureText(BinaryLogRecord &record,
+                                      const char *str, std::size_t len) {
+                auto &arg = m_arg(record, BinaryLogArg::Text);
+                auto room = BINARY_LOG_TEXT_BYTES - record.textUsed;
+                len = len < room ? len : room;
+                std::memcpy(record.text + record.textUsed, str, len);
+                arg.value.text.offset = record.textUsed;
+                arg.value.text.length = static_cast<std::uint16_t>(len);
+                record.textUsed += static_cast<std::uint16_t>(len);
+            }
+
+            /// @brief Applies the rate limit.
+            bool m_admit(std::int64_t second) {
+                auto limit = m_rateLimit.load(std::memory_order_relaxed);
+                if (limit == 0) {
+                    return true;
+                }
+                auto window = m_window.load(std::memory_order_relaxed);
+                if (window != second &&
+                    m_window.compare_exchange_strong(window, second)) {
+                    m_windowCount = 0;
+                }
+                if (m_windowCount++ < limit) {
+                    return true;
+                }
+                m_suppressed++;
+                return false;
+            }
+
+            /// @brief Copies the record into this thread's queue.
+            OSVR_UTIL_EXPORT void m_submit(BinaryLogRecord const &record);
+
+            std::string const m_name;
+            std::uint16_t const m_id;
+            std::atomic<LogLevel> m_level;
+            std::atomic<std::uint32_t> m_rateLimit;
+            /// @brief Second (since the epoch) being rate limited, and the
+            /// messages so far in it.
+            std::atomic<std::int64_t> m_window;
+            std::atomic<std::uint32_t> m_windowCount;
+            std::atomic<std::uint64_t> m_suppressed;
+        };
+
+    } // namespace log
+} // namespace util
+} // namespace osvr
+
+/// @brief Records a binary log message, registering the format string the
+/// first time this call site runs.
+#define OSVR_BINARY_LOG(LOGGER, LEVEL, FORMAT, ...)                            \
+    do {                                                                       \
+        static const ::osvr::util::log::BinaryLogFormatId                      \
+            osvr_binary_log_format_ =                                          \
+                ::osvr::util::log::registerBinaryLogFormat(FORMAT);            \
+        (LOGGER).log(LEVEL, osvr_binary_log_format_, ##__VA_ARGS__);           \
+    } while (0)
+
+#endif // INCLUDED_BinaryLog_h_GUID_DD397E27_EA23_48DF_B0C7_BE2DB2C32E9D
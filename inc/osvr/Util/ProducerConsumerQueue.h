@@ -0,0 +1,165 @@
+/** @file
+    @brief Header
+
+    @date 2017
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2017 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_ProducerConsumerQueue_h_GUID_3B9F27C4_58D1_4E0B_A6F3_7C21D94E8B16
+#define INCLUDED_ProducerConsumerQueue_h_GUID_3B9F27C4_58D1_4E0B_A6F3_7C21D94E8B16
+
+// Internal Includes
+// - none
+
+// Library/third-party includes
+// - none
+
+// Standard includes
+#include <atomic>
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace osvr {
+namespace util {
+    /// @brief A fixed-capacity, wait-free queue for passing values from
+    /// exactly one producer thread to exactly one consumer thread, in the
+    /// style of folly's ProducerConsumerQueue.
+    ///
+    /// Unlike that queue, the slots are default-constructed once up front and
+    /// then reused: writers fill a slot in place and readers consume it in
+    /// place, so element types that own storage (like a std::vector) stop
+    /// allocating once they have grown to their working size. (folly's queue
+    /// constructs on write and destroys on read, so every report would
+    /// allocate; and folly is only a source submodule used by plugins, not
+    /// something an installed core header can include.)
+    ///
+    /// Neither end ever blocks: a write to a full queue, or a read from an
+    /// empty one, just returns false.
+    template <typename T> class ProducerConsumerQueue {
+      public:
+        typedef T value_type;
+
+        /// @brief Constructor
+        /// @param capacity Maximum number of elements held at once: must be
+        /// at least 1.
+        explicit ProducerConsumerQueue(std::size_t capacity)
+            : m_slots(capacity + 1), m_readIndex(0), m_writeIndex(0) {
+            if (capacity == 0) {
+                throw std::invalid_argument(
+                    "ProducerConsumerQueue capacity must be at least 1");
+            }
+        }
+
+        ProducerConsumerQueue(ProducerConsumerQueue const &) = delete;
+        ProducerConsumerQueue &
+        operator=(ProducerConsumerQueue const &) = delete;
+
+        /// @brief Producer only: if there is room, calls `fill(T &)` on the
+        /// next free slot, then makes it visible to the consumer.
+        /// @return false if the queue was full (and fill was not called).
+        template <typename F> bool tryWrite(F &&fill) {
+            auto const current = m_writeIndex.load(std::memory_order_relaxed);
+            auto const next = m_increment(current);
+            if (next == m_readIndex.load(std::memory_order_acquire)) {
+                return false;
+            }
+            fill(m_slots[current]);
+            m_writeIndex.store(next, std::memory_order_release);
+            return true;
+        }
+
+        /// @brief Producer only: copies or moves a value into the queue.
+        /// @return false if the queue was full.
+        template <typename U> bool write(U &&val) {
+            return tryWrite([&](T &slot) { slot = std::forward<U>(val); });
+        }
+
+        /// @brief Consumer only: if there is an element, calls `consume(T &)`
+        /// on it, then frees its slot.
+        /// @return false if the queue was empty (and consume was not called).
+        template <typename F> bool tryRead(F &&consume) {
+            auto const current = m_readIndex.load(std::memory_order_relaxed);
+            if (current == m_writeIndex.load(std::memory_order_acquire)) {
+                return false;
+            }
+            consume(m_slots[current]);
+            m_readIndex.store(m_increment(current), std::memory_order_release);
+            return true;
+        }
+
+        /// @brief Consumer only: calls `consume(T &)` on each element
+        /// available, oldest first, stopping at the ones that were not yet
+        /// written when the drain started.
+        /// @return the number of elements consumed.
+        template <typename F> std::size_t drain(F &&consume) {
+            auto const end = m_writeIndex.load(std::memory_order_acquire);
+            auto current = m_readIndex.load(std::memory_order_relaxed);
+            std::size_t count = 0;
+            while (current != end) {
+                consume(m_slots[current]);
+                current = m_increment(current);
+                /// Release each slot as we go so the producer can refill.
+                m_readIndex.store(current, std::memory_order_release);
+                ++count;
+            }
+            return count;
+        }
+
+        /// @brief Approximate check for emptiness: exact only when called
+        /// from the consumer (where a false may become stale but a true
+        /// cannot).
+        bool empty() const {
+            return m_readIndex.load(std::memory_order_acquire) ==
+                   m_writeIndex.load(std::memory_order_acquire);
+        }
+
+        /// @brief Approximate number of elements queued.
+        std::size_t sizeGuess() const {
+            auto const write = m_writeIndex.load(std::memory_order_acquire);
+            auto const read = m_readIndex.load(std::memory_order_acquire);
+            return (write >= read) ? write - read
+                                   : m_slots.size() - read + write;
+        }
+
+        /// @brief Maximum number of elements that can be queued at once.
+        std::size_t capacity() const { return m_slots.size() - 1; }
+
+      private:
+        std::size_t m_increment(std::size_t idx) const {
+            return (idx + 1 == m_slots.size()) ? 0 : idx + 1;
+        }
+        /// @brief One more slot than the capacity, so that full and empty
+        /// are distinguishable by comparing indices alone.
+        std::vector<T> m_slots;
+        /// @brief The indices are written by different threads, so pad them
+        /// onto separate cache lines.
+        enum { CACHE_LINE_SIZE = 64 };
+        char m_padBeforeRead[CACHE_LINE_SIZE];
+        std::atomic<std::size_t> m_readIndex;
+        char m_padBeforeWrite[CACHE_LINE_SIZE -
+                              sizeof(std::atomic<std::size_t>)];
+        std::atomic<std::size_t> m_writeIndex;
+    };
+} // namespace util
+} // namespace osvr
+
+#endif // INCLUDED_ProducerConsumerQueue_h_GUID_3B9F27C4_58D1_4E0B_A6F3_7C21D94E8B16
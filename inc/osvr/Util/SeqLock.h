@@ -0,0 +1,111 @@
+/** @file
+    @brief Header
+
+    @date 2017
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2017 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef INCLUDED_SeqLock_h_GUID_0B080F01_A195_4226_A9B5_A759AF92DD9E
+#define INCLUDED_SeqLock_h_GUID_0B080F01_A195_4226_A9B5_A759AF92DD9E
+
+// Internal Includes
+// - none
+
+// Library/third-party includes
+// - none
+
+// Standard includes
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+
+namespace osvr {
+namespace util {
+    /// @brief Holds a value written by exactly one thread and read, without
+    /// locking, by any number of others (a "seqlock").
+    ///
+    /// The sequence counter is odd while the writer is copying a new value
+    /// in; a reader copies the value out and retries if the counter was odd
+    /// or changed during the copy. Readers never block the writer, and never
+    /// see a torn value.
+    ///
+    /// T must be trivially copyable (the value is moved around with memcpy)
+    /// and default-constructible, and should be small: readers copy all of
+    /// it on every load.
+    template <typename T> class SeqLock {
+      public:
+        typedef T value_type;
+        typedef std::uint32_t sequence_type;
+
+        SeqLock() : m_seq(0), m_value() {}
+        explicit SeqLock(T const &val) : m_seq(0), m_value(val) {}
+
+        SeqLock(SeqLock const &) = delete;
+        SeqLock &operator=(SeqLock const &) = delete;
+
+        /// @brief Writer only: publishes a new value.
+        void store(T const &val) {
+            auto const seq = m_seq.load(std::memory_order_relaxed);
+            m_seq.store(seq + 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            std::memcpy(&m_value, &val, sizeof(T));
+            m_seq.store(seq + 2, std::memory_order_release);
+        }
+
+        /// @brief Attempts a single consistent copy of the value.
+        /// @return false if the writer was active during the attempt, in
+        /// which case the contents of dest are meaningless.
+        bool tryLoad(T &dest) const {
+            auto const seq = m_seq.load(std::memory_order_acquire);
+            if ((seq & 0x1) != 0) {
+                return false;
+            }
+            std::memcpy(&dest, &m_value, sizeof(T));
+            std::atomic_thread_fence(std::memory_order_acquire);
+            return seq == m_seq.load(std::memory_order_relaxed);
+        }
+
+        /// @brief Returns a consistent copy of the value, retrying as long
+        /// as the writer keeps interfering. Calling this from the writer
+        /// thread never retries.
+        T load() const {
+            T ret;
+            while (!tryLoad(ret)) {
+                std::this_thread::yield();
+            }
+            return ret;
+        }
+
+        /// @brief Number of completed stores: lets a reader tell cheaply
+        /// whether anything has been published since it last looked.
+        sequence_type version() const {
+            return m_seq.load(std::memory_order_acquire) / 2;
+        }
+
+      private:
+        std::atomic<sequence_type> m_seq;
+        T m_value;
+    };
+} // namespace util
+} // namespace osvr
+
+#endif // INCLUDED_SeqLock_h_GUID_0B080F01_A195_4226_A9B5_A759AF92DD9E
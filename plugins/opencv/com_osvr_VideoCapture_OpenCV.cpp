@@ -106,8 +106,16 @@ class CameraDevice : boost::noncopyable {
         // Send the image.
         // Note that if larger than 160x120 (RGB), will used shared memory
         // backend only.
-        m_dev.send(m_imaging, osvr::pluginkit::ImagingMessage(m_frame),
-                   frameTime);
+        if (m_imaging.acquireFrameBuffer(m_dev, m_frameBuf, m_frame.size(),
+                                         m_frame.type())) {
+            // Copy straight into shared memory, rather than into a message
+            // that then gets copied into shared memory.
+            m_frame.copyTo(m_frameBuf.getFrame());
+            m_imaging.sendFrameBuffer(m_dev, m_frameBuf, frameTime);
+        } else {
+            m_dev.send(m_imaging, osvr::pluginkit::ImagingMessage(m_frame),
+                       frameTime);
+        }
 
         return OSVR_RETURN_SUCCESS;
     }
@@ -118,6 +126,7 @@ class CameraDevice : boost::noncopyable {
     cv::VideoCapture m_camera;
     int m_channel;
     cv::Mat m_frame;
+    osvr::pluginkit::ImagingFrameBuffer m_frameBuf;
 };
 
 class CameraDetection {
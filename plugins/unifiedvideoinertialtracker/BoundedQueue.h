@@ -0,0 +1,112 @@
+/** @file
+    @brief Header
+
+    @date 2017
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2017 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef INCLUDED_BoundedQueue_h_GUID_A073F77E_5403_4F27_AB6E_BE158549EE0D
+#define INCLUDED_BoundedQueue_h_GUID_A073F77E_5403_4F27_AB6E_BE158549EE0D
+
+// Internal Includes
+// - none
+
+// Library/third-party includes
+// - none
+
+// Standard includes
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <utility>
+
+namespace osvr {
+namespace vbtracker {
+    /// A fixed-capacity FIFO queue for handing values between threads, where
+    /// both ends block (rather than fail, like folly's ProducerConsumerQueue)
+    /// when the queue is full or empty, until the queue is closed.
+    template <typename T> class BoundedQueue {
+      public:
+        explicit BoundedQueue(std::size_t capacity) : m_capacity(capacity) {}
+
+        /// non-copyable
+        BoundedQueue(BoundedQueue const &) = delete;
+        /// non-assignable
+        BoundedQueue &operator=(BoundedQueue const &) = delete;
+
+        /// Adds a value to the back, waiting for room if the queue is full.
+        /// @return false (discarding the value) if the queue was closed.
+        bool push(T &&value) {
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_notFull.wait(lock, [&] {
+                    return m_closed || m_contents.size() < m_capacity;
+                });
+                if (m_closed) {
+                    return false;
+                }
+                m_contents.push_back(std::move(value));
+            }
+            m_notEmpty.notify_one();
+            return true;
+        }
+
+        /// Removes the value at the front, waiting for one if the queue is
+        /// empty.
+        /// @return false (leaving value untouched) if the queue was closed.
+        bool pop(T &value) {
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_notEmpty.wait(
+                    lock, [&] { return m_closed || !m_contents.empty(); });
+                if (m_closed) {
+                    return false;
+                }
+                value = std::move(m_contents.front());
+                m_contents.pop_front();
+            }
+            m_notFull.notify_one();
+            return true;
+        }
+
+        /// Wakes up and fails all current and future push() and pop() calls.
+        void close() {
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_closed = true;
+            }
+            m_notFull.notify_all();
+            m_notEmpty.notify_all();
+        }
+
+      private:
+        const std::size_t m_capacity;
+        std::mutex m_mutex;
+        std::condition_variable m_notFull;
+        std::condition_variable m_notEmpty;
+        std::deque<T> m_contents;
+        bool m_closed = false;
+    };
+} // namespace vbtracker
+} // namespace osvr
+
+#endif // INCLUDED_BoundedQueue_h_GUID_A073F77E_5403_4F27_AB6E_BE158549EE0D
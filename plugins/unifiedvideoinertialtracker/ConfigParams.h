@@ -140,6 +140,33 @@ namespace vbtracker {
         /// decide (that is, not set an explicit preference)
         int numThreads = 1;
 
+        /// How many video frames may be in flight between capture and pose
+        /// update at once. 1 (the default) captures, processes, and updates
+        /// one frame at a time; higher values let capture and initial image
+        /// processing of later frames overlap the pose update of earlier ones,
+        /// at the cost of that much more buffered latency. Forced to 1 when
+        /// debug is enabled.
+        int imageProcessingPipelineDepth = 1;
+
+        /// How many threads (including the tracker thread) to spread the
+        /// per-target pose estimation across, when more than one target is
+        /// seen in a frame. Set to 0 or less to use one per hardware thread.
+        int poseEstimationThreads = 0;
+
+        /// When every target is tracking confidently, search for blobs only in
+        /// windows around where its beacons are predicted to appear, rather
+        /// than in the whole frame. Ignored when debug is enabled.
+        bool roiBlobSearch = false;
+
+        /// Half the width (and height) of the search window around each
+        /// predicted beacon, in pixels. Must cover beacon size, motion
+        /// between frames, and any image processing pipeline latency.
+        int roiBlobSearchRadius = 40;
+
+        /// In region-of-interest mode, still search the whole frame every this
+        /// many frames, to pick up newly visible targets and beacons.
+        int roiBlobSearchFullFrameInterval = 15;
+
         /// This is the autocorrelation kernel of the process noise. The first
         /// three elements correspond to position, the second three to
         /// incremental rotation.
@@ -158,6 +158,15 @@ namespace vbtracker {
         getOptionalParameter(config.blobsKeepIdentity, root,
                              "blobsKeepIdentity");
         getOptionalParameter(config.numThreads, root, "numThreads");
+        getOptionalParameter(config.imageProcessingPipelineDepth, root,
+                             "imageProcessingPipelineDepth");
+        getOptionalParameter(config.poseEstimationThreads, root,
+                             "poseEstimationThreads");
+        getOptionalParameter(config.roiBlobSearch, root, "roiBlobSearch");
+        getOptionalParameter(config.roiBlobSearchRadius, root,
+                             "roiBlobSearchRadius");
+        getOptionalParameter(config.roiBlobSearchFullFrameInterval, root,
+                             "roiBlobSearchFullFrameInterval");
         getOptionalParameter(config.cameraMicrosecondsOffset, root,
                              "cameraMicrosecondsOffset");
         getOptionalParameter(config.streamBeaconDebugInfo, root,
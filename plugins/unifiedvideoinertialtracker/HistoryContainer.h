@@ -32,9 +32,15 @@
 #include <osvr/Util/TimeValue.h>
 
 // Standard includes
-#include <deque>
-#include <stdexcept>
+#include <algorithm>
+#include <cstddef>
 #include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace osvr {
 namespace vbtracker {
@@ -46,21 +52,6 @@ namespace vbtracker {
             template <typename ValueType>
             using full_value_type = std::pair<timestamp, ValueType>;
 
-            template <typename ValueType>
-            using inner_container_type = std::deque<full_value_type<ValueType>>;
-
-            template <typename ValueType>
-            using container_size_type =
-                typename inner_container_type<ValueType>::size_type;
-
-            template <typename ValueType>
-            using iterator =
-                typename inner_container_type<ValueType>::const_iterator;
-
-            template <typename ValueType>
-            using nonconst_iterator =
-                typename inner_container_type<ValueType>::iterator;
-
             /// Comparison functor for std algorithms usage with
             /// HistoryContainer and related containers.
             template <typename ValueType> class TimestampPairLessThan {
@@ -75,13 +66,114 @@ namespace vbtracker {
                     return lhs.first < rhs;
                 }
             };
+
+            /// Smallest power of two no smaller than n (and at least 1).
+            inline std::size_t roundUpToPowerOfTwo(std::size_t n) {
+                std::size_t ret = 1;
+                while (ret < n) {
+                    ret <<= 1;
+                }
+                return ret;
+            }
+
+            /// Random-access const iterator over the entries of a
+            /// HistoryContainer, oldest to newest, by position in the
+            /// container rather than in its ring storage.
+            template <typename Container> class HistoryIterator {
+              public:
+                using iterator_category = std::random_access_iterator_tag;
+                using value_type = typename Container::full_value_type;
+                using difference_type = std::ptrdiff_t;
+                using pointer = value_type const *;
+                using reference = value_type const &;
+                using size_type = typename Container::size_type;
+
+                HistoryIterator() = default;
+                HistoryIterator(Container const &container, size_type index)
+                    : m_container(&container), m_index(index) {}
+
+                reference operator*() const {
+                    return m_container->m_entry(m_index);
+                }
+                pointer operator->() const { return &(**this); }
+                reference operator[](difference_type n) const {
+                    return *(*this + n);
+                }
+
+                HistoryIterator &operator++() {
+                    ++m_index;
+                    return *this;
+                }
+                HistoryIterator operator++(int) {
+                    auto ret = *this;
+                    ++m_index;
+                    return ret;
+                }
+                HistoryIterator &operator--() {
+                    --m_index;
+                    return *this;
+                }
+                HistoryIterator operator--(int) {
+                    auto ret = *this;
+                    --m_index;
+                    return ret;
+                }
+                HistoryIterator &operator+=(difference_type n) {
+                    m_index = static_cast<size_type>(
+                        static_cast<difference_type>(m_index) + n);
+                    return *this;
+                }
+                HistoryIterator &operator-=(difference_type n) {
+                    return *this += -n;
+                }
+                HistoryIterator operator+(difference_type n) const {
+                    auto ret = *this;
+                    return ret += n;
+                }
+                friend HistoryIterator operator+(difference_type n,
+                                                 HistoryIterator const &it) {
+                    return it + n;
+                }
+                HistoryIterator operator-(difference_type n) const {
+                    auto ret = *this;
+                    return ret -= n;
+                }
+                difference_type operator-(HistoryIterator const &other) const {
+                    return static_cast<difference_type>(m_index) -
+                           static_cast<difference_type>(other.m_index);
+                }
+
+                bool operator==(HistoryIterator const &other) const {
+                    return m_index == other.m_index;
+                }
+                bool operator!=(HistoryIterator const &other) const {
+                    return m_index != other.m_index;
+                }
+                bool operator<(HistoryIterator const &other) const {
+                    return m_index < other.m_index;
+                }
+                bool operator>(HistoryIterator const &other) const {
+                    return other < *this;
+                }
+                bool operator<=(HistoryIterator const &other) const {
+                    return !(other < *this);
+                }
+                bool operator>=(HistoryIterator const &other) const {
+                    return !(*this < other);
+                }
+
+              private:
+                Container const *m_container = nullptr;
+                size_type m_index = 0;
+            };
+
             /// Convenience class to refer to a subset of the range of history,
             /// primarily for use in range-for loops. Note that all iterators
             /// are const iterators.
-            template <typename ValueType> class HistorySubsetRange {
+            template <typename Iterator> class HistorySubsetRange {
               public:
-                using iterator = detail::iterator<ValueType>;
-                using const_iterator = detail::iterator<ValueType>;
+                using iterator = Iterator;
+                using const_iterator = Iterator;
                 HistorySubsetRange(iterator begin_, iterator end_)
                     : m_begin(begin_), m_end(end_) {
                     /// @todo consistency checks on the iterators...
@@ -98,8 +190,15 @@ namespace vbtracker {
             };
         } // namespace detail
 
-        /// Stores values over time, in chronological order, in a deque for
-        /// two-ended access.
+        /// Stores values over time, in chronological order, in a ring buffer
+        /// for two-ended access.
+        ///
+        /// The ring's capacity is a power of two, allocated up front and
+        /// doubled only if the history ever outgrows it, so once a tracker
+        /// has reached its working history length, pushing and popping never
+        /// allocate. Timestamps are also kept in their own packed array
+        /// (parallel to the entries) so that searching by time only touches
+        /// them.
         template <typename ValueType, bool AllowDuplicateTimes_ = true>
         class HistoryContainer {
           public:
@@ -107,28 +206,68 @@ namespace vbtracker {
 
             using timestamp_type = detail::timestamp;
             using full_value_type = detail::full_value_type<value_type>;
-            using container_type = detail::inner_container_type<value_type>;
-            using size_type = detail::container_size_type<value_type>;
+            using size_type = std::size_t;
 
-            using iterator = detail::iterator<value_type>;
+            using iterator = detail::HistoryIterator<HistoryContainer>;
             using const_iterator = iterator;
 
             using comparator_type = detail::TimestampPairLessThan<value_type>;
 
-            using subset_range_type = detail::HistorySubsetRange<value_type>;
+            using subset_range_type = detail::HistorySubsetRange<iterator>;
 
             /// Whether multiple entries with the same timestamp are permitted
             /// to be pushed.
             static const bool AllowDuplicateTimes = AllowDuplicateTimes_;
 
+            /// Default number of entries to allocate room for.
+            static const size_type DefaultCapacity = 64;
+
+            /// Constructor
+            /// @param initialCapacity Number of entries to allocate room for
+            /// (rounded up to a power of two).
+            explicit HistoryContainer(
+                size_type initialCapacity = DefaultCapacity) {
+                m_allocate(detail::roundUpToPowerOfTwo(initialCapacity));
+            }
+
+            HistoryContainer(HistoryContainer const &other)
+                : HistoryContainer(other.capacity()) {
+                m_sizeHighWaterMark = other.m_sizeHighWaterMark;
+                for (auto const &entry : other) {
+                    m_emplaceNewest(entry.first, entry.second);
+                }
+            }
+
+            HistoryContainer(HistoryContainer &&other) { swap(other); }
+
+            HistoryContainer &operator=(HistoryContainer other) {
+                swap(other);
+                return *this;
+            }
+
+            ~HistoryContainer() { clear(); }
+
+            void swap(HistoryContainer &other) {
+                using std::swap;
+                swap(m_timestamps, other.m_timestamps);
+                swap(m_entries, other.m_entries);
+                swap(m_mask, other.m_mask);
+                swap(m_head, other.m_head);
+                swap(m_size, other.m_size);
+                swap(m_sizeHighWaterMark, other.m_sizeHighWaterMark);
+            }
+
             /// Get number of entries in history.
-            size_type size() const { return m_history.size(); }
+            size_type size() const { return m_size; }
+
+            /// Get the number of entries that can be held without allocating.
+            size_type capacity() const { return m_timestamps.size(); }
 
             /// Get the maximum number of entries ever recorded.
             size_type highWaterMark() const { return m_sizeHighWaterMark; }
 
             /// Gets whether history is empty or not.
-            bool empty() const { return m_history.empty(); }
+            bool empty() const { return m_size == 0; }
 
             timestamp_type const &oldest_timestamp() const {
                 if (empty()) {
@@ -136,7 +275,7 @@ namespace vbtracker {
                         "Can't get time of oldest entry in an "
                         "empty history container!");
                 }
-                return m_history.front().first;
+                return m_timestamps[m_head];
             }
 
             value_type const &oldest() const {
@@ -144,7 +283,7 @@ namespace vbtracker {
                     throw std::logic_error("Can't get oldest entry in an "
                                            "empty history container!");
                 }
-                return m_history.front().first;
+                return m_entry(0).second;
             }
 
             /// Returns the newest timestamp in the container. Caveat: throws an
@@ -160,7 +299,7 @@ namespace vbtracker {
                         "empty history container!");
                 }
 
-                return m_history.back().first;
+                return m_timestamps[m_slot(m_size - 1)];
             }
 
             value_type const &newest() const {
@@ -169,32 +308,35 @@ namespace vbtracker {
                                            "empty history container!");
                 }
 
-                return m_history.back().second;
+                return m_entry(m_size - 1).second;
             }
 
             /// Returns a comparison functor (comparing timestamps) for use with
             /// standard algorithms like lower_bound and upper_bound
             static comparator_type comparator() { return comparator_type{}; }
 
-            void pop_oldest() { m_history.pop_front(); }
-            void pop_newest() { m_history.pop_back(); }
-
-            const_iterator begin() const { return m_history.cbegin(); }
-            const_iterator cbegin() const { return m_history.cbegin(); }
-            const_iterator end() const { return m_history.cend(); }
-            const_iterator cend() const { return m_history.cend(); }
-
-            void clear() { m_history.clear(); }
+            void pop_oldest() {
+                m_destroy(m_head);
+                m_head = m_slot(1);
+                --m_size;
+            }
+            void pop_newest() {
+                m_destroy(m_slot(m_size - 1));
+                --m_size;
+            }
 
-          private:
-            /// Needed due to some pre-modern-C++ library differences (like
-            /// containter_type::erase)
-            using nonconst_iterator = detail::nonconst_iterator<value_type>;
+            const_iterator begin() const { return iterator(*this, 0); }
+            const_iterator cbegin() const { return begin(); }
+            const_iterator end() const { return iterator(*this, m_size); }
+            const_iterator cend() const { return end(); }
 
-            nonconst_iterator ncbegin() { return m_history.begin(); }
-            nonconst_iterator ncend() { return m_history.end(); }
+            void clear() {
+                while (!empty()) {
+                    pop_newest();
+                }
+                m_head = 0;
+            }
 
-          public:
             /// Returns true if the given timestamp is strictly newer than the
             /// newest timestamp in the container, or if the container is empty
             /// (thus making the timestamp trivially newest)
@@ -217,38 +359,17 @@ namespace vbtracker {
                        (AllowDuplicateTimes && newest_timestamp() == tv);
             }
 
-            /// Wrapper around std::upper_bound: returns iterator to first
-            /// element newer than timestamp given or end() if none.
+            /// Like std::upper_bound: returns iterator to first element newer
+            /// than timestamp given or end() if none.
             const_iterator upper_bound(timestamp_type const &tv) const {
-                return std::upper_bound(begin(), end(), tv, comparator());
+                return begin() + m_upperBoundIndex(tv);
             }
-            /// Wrapper around std::lower_bound: returns iterator to first
-            /// element with timestamp equal or newer than timestamp given or
-            /// end() if none.
+            /// Like std::lower_bound: returns iterator to first element with
+            /// timestamp equal or newer than timestamp given or end() if none.
             const_iterator lower_bound(timestamp_type const &tv) const {
-                return std::lower_bound(begin(), end(), tv, comparator());
+                return begin() + m_lowerBoundIndex(tv);
             }
 
-          private:
-            /// Wrapper around std::upper_bound: returns iterator to first
-            /// element newer than timestamp given or end() if none.
-            ///
-            /// Returns a non-const iterator, for older C++ standard library
-            /// implementations that require one for erase and similar.
-            nonconst_iterator nc_upper_bound(timestamp_type const &tv) {
-                return std::upper_bound(ncbegin(), ncend(), tv, comparator());
-            }
-            /// Wrapper around std::lower_bound: returns iterator to first
-            /// element with timestamp equal or newer than timestamp given or
-            /// end() if none.
-            ///
-            /// Returns a non-const iterator, for older C++ standard library
-            /// implementations that require one for erase and similar.
-            nonconst_iterator nc_lower_bound(timestamp_type const &tv) {
-                return std::lower_bound(ncbegin(), ncend(), tv, comparator());
-            }
-
-          public:
             /// Return an iterator to the newest, last pair of timestamp and
             /// value that is not newer than the given timestamp. If none meet
             /// this criteria, returns end().
@@ -276,19 +397,6 @@ namespace vbtracker {
                 return subset_range_type(upper_bound(tv), end());
             }
 
-#if 0
-            /// Remove all entries in history with timestamps strictly older than
-            /// the given timestamp.
-            /// @return number of elements removed.
-            size_type pop_before(timestamp_type const &tv) {
-                auto count = size_type{0};
-                while (!empty() && oldest_timestamp() < tv) {
-                    pop_oldest();
-                    ++count;
-                }
-                return count;
-            }
-#else
             /// Remove all entries in history with timestamps strictly older
             /// than the given timestamp.
             /// @return number of elements removed.
@@ -296,36 +404,19 @@ namespace vbtracker {
                 if (empty()) {
                     return 0;
                 }
-                auto lastIt = nc_lower_bound(tv);
-                if (ncend() == lastIt) {
-                    // If we got end() back, that's ambiguous: is the last entry
-                    // really >= our timestamp?
+                auto count = m_lowerBoundIndex(tv);
+                if (m_size == count && is_strictly_newest(tv)) {
+                    /// Every entry is older: as before, leave the history be
+                    /// rather than emptying it.
                     /// @todo is this right?
-                    if (is_strictly_newest(tv)) {
-                        // It's not - lower_bound couldn't find anything.
-                        return 0;
-                    }
+                    return 0;
                 }
-                auto count = std::distance(ncbegin(), lastIt);
-                m_history.erase(ncbegin(), lastIt);
-                return count;
-            }
-#endif
-
-#if 0
-
-            /// Remove all entries in history with timestamps strictly newer than
-            /// the given timestamp.
-            /// @return number of elements removed.
-            size_type pop_after(timestamp_type const &tv) {
-                auto count = size_type{0};
-                while (!empty() && tv < newest_timestamp()) {
-                    pop_newest();
-                    ++count;
+                for (size_type i = 0; i < count; ++i) {
+                    pop_oldest();
                 }
                 return count;
             }
-#else
+
             /// Remove all entries in history with timestamps strictly newer
             /// than the given timestamp.
             /// @return number of elements removed.
@@ -333,16 +424,12 @@ namespace vbtracker {
                 if (empty()) {
                     return 0;
                 }
-                auto firstIt = nc_upper_bound(tv);
-                if (ncend() == firstIt) {
-                    // If we got end() back, nothing found after our timestamp.
-                    return 0;
+                auto count = m_size - m_upperBoundIndex(tv);
+                for (size_type i = 0; i < count; ++i) {
+                    pop_newest();
                 }
-                auto count = std::distance(firstIt, ncend());
-                m_history.erase(firstIt, ncend());
                 return count;
             }
-#endif
 
             /// Adds a new value to history. It must be newer (or equal time,
             /// based on template parameters) than the newest (or the history
@@ -350,7 +437,12 @@ namespace vbtracker {
             void push_newest(osvr::util::time::TimeValue const &tv,
                              value_type const &value) {
                 if (is_valid_to_push_newest(tv)) {
-                    m_history.emplace_back(tv, value);
+                    if (m_size == capacity()) {
+                        /// Only until we reach our working history length
+                        /// (or after being moved from).
+                        m_reallocate((std::max)(capacity() * 2, size_type(1)));
+                    }
+                    m_emplaceNewest(tv, value);
                     updateSizeHighWaterMark();
                 } else {
                     throw std::logic_error(
@@ -360,13 +452,113 @@ namespace vbtracker {
             }
 
           private:
+            template <typename> friend class detail::HistoryIterator;
+            using storage_type =
+                typename std::aligned_storage<sizeof(full_value_type),
+                                              alignof(full_value_type)>::type;
+
+            /// Index in the ring storage of the entry at the given position.
+            size_type m_slot(size_type position) const {
+                return (m_head + position) & m_mask;
+            }
+
+            full_value_type const &m_entry(size_type position) const {
+                return *reinterpret_cast<full_value_type const *>(
+                    &m_entries[m_slot(position)]);
+            }
+
+            /// Position of the first entry for which pred(timestamp) is false,
+            /// given that it is true for all entries before and false for all
+            /// entries after. The occupied slots are at most two contiguous
+            /// runs of the timestamp array, searched in order.
+            template <typename Pred>
+            size_type m_partitionPoint(Pred &&pred) const {
+                auto const firstLen = (std::min)(m_size, capacity() - m_head);
+                auto const first = m_timestamps.data() + m_head;
+                auto const firstEnd = first + firstLen;
+                auto it = std::partition_point(first, firstEnd, pred);
+                if (it != firstEnd) {
+                    return static_cast<size_type>(it - first);
+                }
+                auto const second = m_timestamps.data();
+                auto const secondEnd = second + (m_size - firstLen);
+                return firstLen + static_cast<size_type>(std::partition_point(
+                                                             second, secondEnd,
+                                                             pred) -
+                                                         second);
+            }
+
+            size_type m_lowerBoundIndex(timestamp_type const &tv) const {
+                return m_partitionPoint(
+                    [&](timestamp_type const &entryTime) {
+                        return entryTime < tv;
+                    });
+            }
+
+            size_type m_upperBoundIndex(timestamp_type const &tv) const {
+                return m_partitionPoint(
+                    [&](timestamp_type const &entryTime) {
+                        return !(tv < entryTime);
+                    });
+            }
+
+            /// Constructs a new entry after the newest: there must be room.
+            void m_emplaceNewest(timestamp_type const &tv,
+                                 value_type const &value) {
+                auto slot = m_slot(m_size);
+                new (&m_entries[slot]) full_value_type(tv, value);
+                m_timestamps[slot] = tv;
+                ++m_size;
+            }
+
+            void m_destroy(size_type slot) {
+                reinterpret_cast<full_value_type *>(&m_entries[slot])
+                    ->~full_value_type();
+            }
+
+            /// Sets up empty storage of the given power-of-two capacity.
+            void m_allocate(size_type newCapacity) {
+                m_timestamps.resize(newCapacity);
+                m_entries.reset(new storage_type[newCapacity]);
+                m_mask = newCapacity - 1;
+                m_head = 0;
+            }
+
+            /// Moves the entries into new storage of the given power-of-two
+            /// capacity, oldest first.
+            void m_reallocate(size_type newCapacity) {
+                HistoryContainer bigger(newCapacity);
+                for (size_type i = 0; i < m_size; ++i) {
+                    auto slot = m_slot(i);
+                    auto &entry =
+                        *reinterpret_cast<full_value_type *>(&m_entries[slot]);
+                    new (&bigger.m_entries[i])
+                        full_value_type(std::move(entry));
+                    bigger.m_timestamps[i] = m_timestamps[slot];
+                    ++bigger.m_size;
+                }
+                bigger.m_sizeHighWaterMark = m_sizeHighWaterMark;
+                swap(bigger);
+            }
+
             void updateSizeHighWaterMark() {
-                m_sizeHighWaterMark =
-                    (std::max)(m_history.size(), m_sizeHighWaterMark);
+                m_sizeHighWaterMark = (std::max)(m_size, m_sizeHighWaterMark);
             }
-            container_type m_history;
+            std::vector<timestamp_type> m_timestamps;
+            std::unique_ptr<storage_type[]> m_entries;
+            size_type m_mask = 0;
+            /// Slot of the oldest entry.
+            size_type m_head = 0;
+            size_type m_size = 0;
             size_type m_sizeHighWaterMark = 0;
         };
+
+        template <typename ValueType, bool AllowDuplicateTimes>
+        inline void
+        swap(HistoryContainer<ValueType, AllowDuplicateTimes> &lhs,
+             HistoryContainer<ValueType, AllowDuplicateTimes> &rhs) {
+            lhs.swap(rhs);
+        }
     } // namespace history
 
     using history::HistoryContainer;
@@ -30,7 +30,7 @@
 #include "ImageSources/ImageSource.h"
 
 // Library/third-party includes
-#include <osvr/Util/Finally.h>
+// - none
 
 // Standard includes
 #include <iostream>
@@ -40,11 +40,12 @@ namespace vbtracker {
     ImageProcessingThread::ImageProcessingThread(
         TrackingSystem &trackingSystem, ImageSource &cam,
         TrackerThread &trackerThread, CameraParameters const &camParams,
-        std::int32_t cameraUsecOffset)
+        std::int32_t cameraUsecOffset, std::size_t pipelineDepth)
         : trackingSystem_(trackingSystem), cam_(cam),
           trackerThreadObj_(trackerThread), camParams_(camParams),
           cameraUsecOffset_(cameraUsecOffset),
-          logBlobs_(trackingSystem_.getParams().logRawBlobs) {
+          logBlobs_(trackingSystem_.getParams().logRawBlobs),
+          freeFrames_(pipelineDepth), capturedFrames_(pipelineDepth) {
         if (logBlobs_) {
             blobFile_.open("blobs.csv");
             if (blobFile_) {
@@ -54,65 +55,79 @@ namespace vbtracker {
                 logBlobs_ = false;
             }
         }
+        /// Fill the pool of frame buffers: their contents get allocated on
+        /// first capture.
+        for (std::size_t i = 0; i < pipelineDepth; ++i) {
+            freeFrames_.push(CapturedFrame{});
+        }
     }
 
-    void ImageProcessingThread::signalDoFrame() {
-        {
-            std::lock_guard<std::mutex> lock{stateMutex_};
-            next_ = NextOp::DoFrame;
+    ImageProcessingThread::~ImageProcessingThread() {
+        signalExit();
+        if (captureThread_.joinable()) {
+            captureThread_.join();
         }
-        stateCondVar_.notify_all();
+    }
+
+    void ImageProcessingThread::recycleFrame(cv::Mat const &frame,
+                                             cv::Mat const &frameGray) {
+        /// There's always room: the pool never holds more buffers than it
+        /// started with.
+        freeFrames_.push(
+            CapturedFrame{util::time::TimeValue{}, frame, frameGray});
     }
 
     void ImageProcessingThread::signalExit() {
-        {
-            std::lock_guard<std::mutex> lock{stateMutex_};
-            next_ = NextOp::Exit;
-        }
-        stateCondVar_.notify_all();
+        freeFrames_.close();
+        capturedFrames_.close();
     }
 
     void ImageProcessingThread::threadAction() {
-        while (1) {
-            {
-                std::unique_lock<std::mutex> lock(stateMutex_);
-
-                if (NextOp::Waiting == next_) {
-                    /// Wait until we're notified and next_ isn't just "waiting"
-                    stateCondVar_.wait(
-                        lock, [&] { return next_ != NextOp::Waiting; });
-                }
-
-                /// OK, we're not supposed to wait anymore. What do we do?
-                if (NextOp::Exit == next_) {
-                    // we are all done.
-                    exiting_ = true;
-                    return;
-                }
-                /// Otherwise, we should do a frame.
-                /// Re-set the next op while we still hold the mutex.
-                next_ = NextOp::Waiting;
+        captureThread_ = std::thread{[&] { captureThreadAction(); }};
+        CapturedFrame captured;
+        while (capturedFrames_.pop(captured)) {
+            processFrame(captured);
+        }
+        /// The queues were closed: we are all done.
+        exiting_ = true;
+    }
+
+    void ImageProcessingThread::captureThreadAction() {
+        CapturedFrame captured;
+        /// Wait for a free set of buffers, fill it, and pass it on, until
+        /// the queues are closed.
+        while (freeFrames_.pop(captured)) {
+            bool success = captureFrame(captured);
+            auto &destination = success ? capturedFrames_ : freeFrames_;
+            if (!destination.push(std::move(captured))) {
+                return;
             }
-            doFrame();
         }
     }
 
-    void ImageProcessingThread::doFrame() {
-        ImageOutputDataPtr data;
-        /// On scope exit, no matter how, signal to the tracker thread that
-        /// we're done.
-        auto signalCompletion = util::finally([&] {
-            trackerThreadObj_.signalImageProcessingComplete(std::move(data),
-                                                            frame_, gray_);
-        });
-
-        // Pull the image into an OpenCV matrix named m_frame.
-        util::time::TimeValue frameTime;
-        cam_.retrieve(frame_, gray_, frameTime);
-        if (!frame_.data || !gray_.data) {
-            // let the tracker thread warn if it wants to, we'll just get
-            // out.
-            return;
+    bool ImageProcessingThread::captureFrame(CapturedFrame &captured) {
+        // Check camera status.
+        if (!cam_.ok()) {
+            // Hmm, camera seems bad. Might regain it? Skip for now...
+            warn() << "Camera is reporting it is not OK." << std::endl;
+            return false;
+        }
+        // Trigger a grab.
+        if (!cam_.grab()) {
+            // Again failing without quitting, in hopes we get better luck
+            // next time...
+            warn() << "Camera grab failed." << std::endl;
+            return false;
+        }
+
+        // Pull the image into the OpenCV matrices we were handed, re-using
+        // their buffers if possible.
+        cam_.retrieve(captured.frame, captured.gray, captured.tv);
+        if (!captured.frame.data || !captured.gray.data) {
+            warn() << "Camera retrieve appeared to fail: frames had null "
+                      "pointers!"
+                   << std::endl;
+            return false;
         }
 
         /// We retrieved a timestamp with that frame...
@@ -123,30 +138,39 @@ namespace vbtracker {
         if (cameraUsecOffset_ != 0) {
             // apply offset, if non-zero.
             const util::time::TimeValue offset{0, cameraUsecOffset_};
-            osvrTimeValueSum(&frameTime, &offset);
+            osvrTimeValueSum(&captured.tv, &offset);
         }
+        return true;
+    }
 
+    void ImageProcessingThread::processFrame(CapturedFrame &captured) {
         // Do the slow, but intentionally async-able part of the image
         // processing.
-        data = trackingSystem_.performInitialImageProcessing(frameTime, frame_,
-                                                             gray_, camParams_);
+        auto data = trackingSystem_.performInitialImageProcessing(
+            captured.tv, captured.frame, captured.gray, camParams_);
         // Log blobs, if applicable
         if (logBlobs_) {
-            if (!blobFile_) {
-                // Oh dear, the file went bad.
-                logBlobs_ = false;
-                return;
-            }
-            blobFile_ << data->tv.seconds << "," << data->tv.microseconds;
-            for (auto &measurement : data->ledMeasurements) {
-                blobFile_ << "," << measurement.loc.x << ","
-                          << measurement.loc.y << "," << measurement.diameter;
-            }
-            blobFile_ << "\n";
+            writeBlobLog(*data);
         }
 
-        // On return, we'll automatically notify the tracker thread that its
-        // results are ready for pickup at the second window.
+        // Hand the results to the tracker thread: it returns the buffers to
+        // us when it is done with them.
+        trackerThreadObj_.signalImageProcessingComplete(std::move(data));
+    }
+
+    void
+    ImageProcessingThread::writeBlobLog(ImageProcessingOutput const &data) {
+        if (!blobFile_) {
+            // Oh dear, the file went bad.
+            logBlobs_ = false;
+            return;
+        }
+        blobFile_ << data.tv.seconds << "," << data.tv.microseconds;
+        for (auto &measurement : data.ledMeasurements) {
+            blobFile_ << "," << measurement.loc.x << "," << measurement.loc.y
+                      << "," << measurement.diameter;
+        }
+        blobFile_ << "\n";
     }
 
     std::ostream &ImageProcessingThread::msg() const {
@@ -26,17 +26,21 @@
 #define INCLUDED_ImageProcessingThread_h_GUID_307E6652_D346_43B4_291A_5BAAEF4BA909
 
 // Internal Includes
+#include "BoundedQueue.h"
+#include "ImageProcessing.h"
 #include <CameraParameters.h>
 
 // Library/third-party includes
 #include <opencv2/core/core.hpp>
+#include <osvr/Util/TimeValue.h>
 
 // Standard includes
-#include <condition_variable>
+#include <atomic>
+#include <cstddef>
 #include <cstdint>
 #include <fstream>
 #include <iosfwd>
-#include <mutex>
+#include <thread>
 
 namespace osvr {
 namespace vbtracker {
@@ -44,19 +48,33 @@ namespace vbtracker {
     class TrackingSystem;
     class ImageSource;
 
+    /// Runs the first two stages of the video tracking pipeline: capturing
+    /// frames from the camera (on a thread of its own) and the initial image
+    /// processing (on the thread calling threadAction()), handing the results
+    /// to the TrackerThread for the pose update.
+    ///
+    /// The stages are connected by bounded queues and share a fixed pool of
+    /// frame buffers, recycled by the TrackerThread once it is done with each
+    /// frame, so at most pipelineDepth frames are in flight at once. With a
+    /// depth of 1, the stages run in lock-step; more lets capture and blob
+    /// extraction of the next frames overlap the pose update of the current
+    /// one. Either way, frames are delivered in the order they were captured.
     class ImageProcessingThread {
       public:
         explicit ImageProcessingThread(TrackingSystem &trackingSystem,
                                        ImageSource &cam,
                                        TrackerThread &trackerThread,
                                        CameraParameters const &camParams,
-                                       std::int32_t cameraUsecOffset);
+                                       std::int32_t cameraUsecOffset,
+                                       std::size_t pipelineDepth = 1);
+        ~ImageProcessingThread();
 
         /// non-assignable.
         ImageProcessingThread &operator=(ImageProcessingThread &) = delete;
 
-        /// called by TrackerThread
-        void signalDoFrame();
+        /// called by TrackerThread once it is done with a frame's images, to
+        /// return their buffers to the pool for re-use.
+        void recycleFrame(cv::Mat const &frame, cv::Mat const &frameGray);
         /// called by TrackerThread
         void signalExit();
 
@@ -67,12 +85,25 @@ namespace vbtracker {
         bool exiting() const { return exiting_; }
 
       private:
+        /// A frame as it moves from capture to initial image processing.
+        struct CapturedFrame {
+            util::time::TimeValue tv;
+            cv::Mat frame;
+            cv::Mat gray;
+        };
         /// Helper providing a prefixed output stream for normal messages.
         std::ostream &msg() const;
         /// Helper providing a prefixed output stream for warning messages.
         std::ostream &warn() const;
-        /// Performs the retrieval and processing of a single frame.
-        void doFrame();
+        /// Entry point for the capture thread.
+        void captureThreadAction();
+        /// Performs the retrieval of a single frame into the given buffers.
+        /// @return false if it failed.
+        bool captureFrame(CapturedFrame &captured);
+        /// Performs the initial image processing of a single frame.
+        void processFrame(CapturedFrame &captured);
+        /// Writes a frame's blobs to the blob log.
+        void writeBlobLog(ImageProcessingOutput const &data);
 
         TrackingSystem &trackingSystem_;
         ImageSource &cam_;
@@ -84,16 +115,13 @@ namespace vbtracker {
         bool logBlobs_ = false;
         std::ofstream blobFile_;
 
-        enum class NextOp { Waiting, DoFrame, Exit };
-
-        std::mutex stateMutex_;
-        std::condition_variable stateCondVar_;
-        NextOp next_ = NextOp::Waiting;
-
-        cv::Mat frame_;
-        cv::Mat gray_;
+        /// Frame buffers available for capture.
+        BoundedQueue<CapturedFrame> freeFrames_;
+        /// Frames captured, awaiting initial image processing.
+        BoundedQueue<CapturedFrame> capturedFrames_;
 
-        bool exiting_ = false;
+        std::thread captureThread_;
+        std::atomic<bool> exiting_{false};
     };
 
 } // namespace vbtracker
@@ -0,0 +1,192 @@
+/** @file
+    @brief Implementation
+
+    @date 2017
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2017 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include "TaskPool.h"
+
+// Library/third-party includes
+// - none
+
+// Standard includes
+#include <utility>
+
+namespace osvr {
+namespace vbtracker {
+    TaskPool::TaskPool(std::size_t numWorkers) {
+        m_lanes.reserve(numWorkers + 1);
+        for (std::size_t i = 0; i < numWorkers + 1; ++i) {
+            m_lanes.emplace_back(new Lane);
+        }
+        m_workers.reserve(numWorkers);
+        for (std::size_t i = 0; i < numWorkers; ++i) {
+            /// Lane 0 belongs to the thread calling parallelFor()
+            auto laneIndex = i + 1;
+            m_workers.emplace_back([this, laneIndex] {
+                m_workerThread(laneIndex);
+            });
+        }
+    }
+
+    TaskPool::~TaskPool() {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_exiting = true;
+        }
+        m_batchReady.notify_all();
+        for (auto &worker : m_workers) {
+            worker.join();
+        }
+    }
+
+    void TaskPool::m_run(std::size_t n, TaskFunction fn, void *functor) {
+        if (m_workers.empty() || n < 2) {
+            /// Not worth waking anybody up.
+            std::exception_ptr exception;
+            for (std::size_t i = 0; i < n; ++i) {
+                try {
+                    fn(functor, i);
+                } catch (...) {
+                    if (!exception) {
+                        exception = std::current_exception();
+                    }
+                }
+            }
+            if (exception) {
+                std::rethrow_exception(exception);
+            }
+            return;
+        }
+
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            /// Wait for any workers still finishing up the last batch.
+            m_batchDone.wait(lock, [&] { return m_busyWorkers == 0; });
+            m_fn = fn;
+            m_functor = functor;
+            m_exception = nullptr;
+            m_remaining = n;
+            /// No worker touches the lanes without first registering as busy
+            /// under the mutex we hold, so we can deal out the tasks freely.
+            auto const numLanes = m_lanes.size();
+            for (std::size_t i = 0; i < numLanes; ++i) {
+                m_lanes[i]->begin = n * i / numLanes;
+                m_lanes[i]->end = n * (i + 1) / numLanes;
+            }
+            ++m_generation;
+        }
+        m_batchReady.notify_all();
+
+        m_work(0, fn, functor);
+
+        std::exception_ptr exception;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_batchDone.wait(lock, [&] { return m_remaining == 0; });
+            std::swap(exception, m_exception);
+        }
+        if (exception) {
+            std::rethrow_exception(exception);
+        }
+    }
+
+    void TaskPool::m_workerThread(std::size_t laneIndex) {
+        std::size_t seenGeneration = 0;
+        while (true) {
+            TaskFunction fn = nullptr;
+            void *functor = nullptr;
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_batchReady.wait(lock, [&] {
+                    return m_exiting || m_generation != seenGeneration;
+                });
+                if (m_exiting) {
+                    return;
+                }
+                seenGeneration = m_generation;
+                fn = m_fn;
+                functor = m_functor;
+                ++m_busyWorkers;
+            }
+            m_work(laneIndex, fn, functor);
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                --m_busyWorkers;
+            }
+            m_batchDone.notify_all();
+        }
+    }
+
+    void TaskPool::m_work(std::size_t laneIndex, TaskFunction fn,
+                          void *functor) {
+        auto const numLanes = m_lanes.size();
+        std::size_t task = 0;
+        while (true) {
+            bool gotTask = m_takeOwn(*m_lanes[laneIndex], task);
+            for (std::size_t i = 1; !gotTask && i < numLanes; ++i) {
+                gotTask =
+                    m_steal(*m_lanes[(laneIndex + i) % numLanes], task);
+            }
+            if (!gotTask) {
+                /// Lanes only ever shrink during a batch, so we're done.
+                return;
+            }
+            try {
+                fn(functor, task);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if (!m_exception) {
+                    m_exception = std::current_exception();
+                }
+            }
+            if (--m_remaining == 0) {
+                /// Notify with the lock held so the caller can't miss it
+                /// between checking the count and going to sleep.
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_batchDone.notify_all();
+            }
+        }
+    }
+
+    bool TaskPool::m_takeOwn(Lane &lane, std::size_t &task) {
+        std::lock_guard<std::mutex> lock(lane.mutex);
+        if (lane.begin == lane.end) {
+            return false;
+        }
+        task = lane.begin;
+        ++lane.begin;
+        return true;
+    }
+
+    bool TaskPool::m_steal(Lane &lane, std::size_t &task) {
+        std::lock_guard<std::mutex> lock(lane.mutex);
+        if (lane.begin == lane.end) {
+            return false;
+        }
+        --lane.end;
+        task = lane.end;
+        return true;
+    }
+
+} // namespace vbtracker
+} // namespace osvr
@@ -0,0 +1,124 @@
+/** @file
+    @brief Header
+
+    @date 2017
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2017 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_TaskPool_h_GUID_2A385CA6_A807_4125_8FE9_4E8935B7523C
+#define INCLUDED_TaskPool_h_GUID_2A385CA6_A807_4125_8FE9_4E8935B7523C
+
+// Internal Includes
+// - none
+
+// Library/third-party includes
+#include <boost/noncopyable.hpp>
+
+// Standard includes
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace osvr {
+namespace vbtracker {
+    /// A small fork-join pool of worker threads for running a batch of
+    /// independent tasks, indexed 0 through n-1, to completion.
+    ///
+    /// Each batch is dealt out in contiguous chunks to one lane per thread
+    /// (the calling thread included): a thread works through its own lane
+    /// from the front, then steals single tasks from the back of the others,
+    /// so uneven tasks still balance out. Everything is allocated up front, so
+    /// running a batch does not allocate.
+    class TaskPool : boost::noncopyable {
+      public:
+        /// @param numWorkers Number of threads to start in addition to the
+        /// calling thread: 0 runs every batch serially on the calling thread.
+        explicit TaskPool(std::size_t numWorkers);
+        ~TaskPool();
+
+        /// Number of threads (including the caller) that run a batch.
+        std::size_t concurrency() const { return m_lanes.size(); }
+
+        /// Calls f(i) for each i in [0, n), returning once all calls are
+        /// complete. Calls may run in any order and concurrently, so results
+        /// should be written to per-index storage. If any call throws, the
+        /// remaining ones still run, then the first exception is rethrown
+        /// here.
+        ///
+        /// Only one thread at a time may run batches on a given pool.
+        template <typename F> void parallelFor(std::size_t n, F &&f) {
+            using FunctorType = typename std::remove_reference<F>::type;
+            m_run(n, &callTask<FunctorType>, &f);
+        }
+
+      private:
+        using TaskFunction = void (*)(void *, std::size_t);
+        template <typename FunctorType>
+        static void callTask(void *functor, std::size_t i) {
+            (*static_cast<FunctorType *>(functor))(i);
+        }
+
+        /// A range of task indices belonging to one thread.
+        struct Lane {
+            std::mutex mutex;
+            std::size_t begin = 0;
+            std::size_t end = 0;
+        };
+
+        void m_run(std::size_t n, TaskFunction fn, void *functor);
+        void m_workerThread(std::size_t laneIndex);
+        /// Runs tasks from our own lane, then from the others, until none
+        /// are left.
+        void m_work(std::size_t laneIndex, TaskFunction fn, void *functor);
+        bool m_takeOwn(Lane &lane, std::size_t &task);
+        bool m_steal(Lane &lane, std::size_t &task);
+
+        std::vector<std::unique_ptr<Lane>> m_lanes;
+        std::vector<std::thread> m_workers;
+
+        /// @name Batch state, protected by m_mutex
+        /// @{
+        std::mutex m_mutex;
+        std::condition_variable m_batchReady;
+        std::condition_variable m_batchDone;
+        std::size_t m_generation = 0;
+        TaskFunction m_fn = nullptr;
+        void *m_functor = nullptr;
+        /// Workers currently looking at the lanes: a new batch waits for
+        /// these to drop to zero, so nobody runs a task with a stale function.
+        std::size_t m_busyWorkers = 0;
+        std::exception_ptr m_exception;
+        bool m_exiting = false;
+        /// @}
+
+        /// Tasks in the current batch not yet complete.
+        std::atomic<std::size_t> m_remaining{0};
+    };
+
+} // namespace vbtracker
+} // namespace osvr
+
+#endif // INCLUDED_TaskPool_h_GUID_2A385CA6_A807_4125_8FE9_4E8935B7523C
@@ -0,0 +1,164 @@
+/** @file
+    @brief Implementation
+
+    @date 2017
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2017 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#define CATCH_CONFIG_MAIN
+
+// Internal Includes
+#include <BlobParams.h>
+#include <FusedEdgeDetection.h>
+
+// Library/third-party includes
+#include <catch.hpp>
+#include <opencv2/core/core.hpp>
+#include <opencv2/highgui/highgui.hpp>
+#include <opencv2/imgproc/imgproc.hpp>
+
+// Standard includes
+#include <string>
+#include <vector>
+
+using osvr::vbtracker::EdgeHoleParams;
+using osvr::vbtracker::FusedEdgeDetector;
+
+namespace {
+/// The sequence of OpenCV calls made by EdgeHoleBasedLedExtractor, which the
+/// fused kernel must match exactly.
+inline void referenceEdgeDetection(cv::Mat const &gray,
+                                   EdgeHoleParams const &params,
+                                   cv::Mat &edge, cv::Mat &edgeBinary) {
+    cv::Mat blurred;
+    cv::GaussianBlur(gray, blurred,
+                     cv::Size(params.preEdgeDetectionBlurSize,
+                              params.preEdgeDetectionBlurSize),
+                     0, 0);
+    cv::Laplacian(blurred, edge, CV_8U, params.laplacianKSize,
+                  params.laplacianScale);
+    if (params.edgeDetectErosion) {
+        cv::Mat kernel = cv::Mat::ones(cv::Size(3, 3), CV_8U) *
+                         static_cast<std::uint8_t>(params.erosionKernelValue);
+        cv::erode(edge, edge, kernel);
+    }
+    if (params.postEdgeDetectionBlur) {
+        cv::Mat edgeTemp;
+        cv::GaussianBlur(edge, edgeTemp,
+                         cv::Size(params.postEdgeDetectionBlurSize,
+                                  params.postEdgeDetectionBlurSize),
+                         0, 0);
+        cv::threshold(edgeTemp, edgeBinary,
+                      params.postEdgeDetectionBlurThreshold, 255,
+                      cv::THRESH_BINARY);
+    } else {
+        cv::threshold(edge, edgeBinary, params.postEdgeDetectionBlurThreshold,
+                      255, cv::THRESH_BINARY);
+    }
+}
+
+inline bool identical(cv::Mat const &a, cv::Mat const &b) {
+    return a.size() == b.size() && a.type() == b.type() &&
+           cv::countNonZero(a != b) == 0;
+}
+
+inline void checkMatchesReference(cv::Mat const &gray,
+                                  EdgeHoleParams const &params) {
+    FusedEdgeDetector fused{params};
+    REQUIRE(fused.supports(gray));
+    cv::Mat edge, edgeBinary, refEdge, refEdgeBinary;
+    fused(gray, edge, edgeBinary);
+    referenceEdgeDetection(gray, params, refEdge, refEdgeBinary);
+    REQUIRE(identical(edge, refEdge));
+    REQUIRE(identical(edgeBinary, refEdgeBinary));
+}
+
+/// A few variations on the default parameters, all of which the fused kernel
+/// claims to support.
+inline std::vector<EdgeHoleParams> getParamVariations() {
+    std::vector<EdgeHoleParams> ret;
+    ret.emplace_back();
+    {
+        EdgeHoleParams p;
+        p.edgeDetectErosion = true;
+        ret.push_back(p);
+    }
+    {
+        EdgeHoleParams p;
+        p.postEdgeDetectionBlur = false;
+        ret.push_back(p);
+    }
+    {
+        EdgeHoleParams p;
+        p.laplacianKSize = 1;
+        p.laplacianScale = 16;
+        p.postEdgeDetectionBlurThreshold = 20;
+        ret.push_back(p);
+    }
+    return ret;
+}
+} // namespace
+
+TEST_CASE("FusedEdgeDetection-HDK-sample-images") {
+    for (int i = 1; i <= 8; ++i) {
+        auto fn = std::string(OSVR_HDK_IMAGE_DIR) + "/000" +
+                  std::to_string(i) + ".tif";
+        CAPTURE(fn);
+        cv::Mat color = cv::imread(fn, cv::IMREAD_COLOR);
+        REQUIRE_FALSE(color.empty());
+        cv::Mat gray;
+        cv::cvtColor(color, gray, cv::COLOR_BGR2GRAY);
+        for (auto const &params : getParamVariations()) {
+            checkMatchesReference(gray, params);
+        }
+    }
+}
+
+TEST_CASE("FusedEdgeDetection-synthetic-images") {
+    cv::RNG rng(0x05b12);
+    /// Odd sizes exercise the scalar tails and the borders.
+    for (auto const &size : {cv::Size(2, 2), cv::Size(3, 7), cv::Size(17, 5),
+                             cv::Size(33, 33), cv::Size(640, 480)}) {
+        CAPTURE(size.width);
+        CAPTURE(size.height);
+        cv::Mat gray(size, CV_8UC1);
+        rng.fill(gray, cv::RNG::UNIFORM, 0, 256);
+        for (auto const &params : getParamVariations()) {
+            checkMatchesReference(gray, params);
+        }
+    }
+}
+
+TEST_CASE("FusedEdgeDetection-unsupported-params") {
+    cv::Mat gray(cv::Size(16, 16), CV_8UC1, cv::Scalar(0));
+    {
+        EdgeHoleParams p;
+        p.laplacianScale = 2.5;
+        REQUIRE_FALSE(FusedEdgeDetector{p}.supports(gray));
+    }
+    {
+        EdgeHoleParams p;
+        p.preEdgeDetectionBlurSize = 5;
+        REQUIRE_FALSE(FusedEdgeDetector{p}.supports(gray));
+    }
+    REQUIRE_FALSE(FusedEdgeDetector{EdgeHoleParams{}}.supports(
+        cv::Mat(cv::Size(1, 16), CV_8UC1)));
+}
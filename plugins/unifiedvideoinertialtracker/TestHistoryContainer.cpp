@@ -0,0 +1,161 @@
+/** @file
+    @brief Implementation
+
+    @date 2017
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2017 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#define CATCH_CONFIG_MAIN
+
+// Internal Includes
+#include "HistoryContainer.h"
+
+// Library/third-party includes
+#include <catch.hpp>
+
+// Standard includes
+#include <deque>
+#include <utility>
+
+using osvr::vbtracker::HistoryContainer;
+using osvr::util::time::TimeValue;
+
+namespace {
+inline TimeValue makeTime(int ms) {
+    TimeValue ret;
+    ret.seconds = ms / 1000;
+    ret.microseconds = (ms % 1000) * 1000;
+    return ret;
+}
+using Reference = std::deque<std::pair<int, int>>;
+
+/// Checks the container against a reference list of (ms, value) pairs.
+inline void checkContents(HistoryContainer<int> const &history,
+                          Reference const &expected) {
+    REQUIRE(history.size() == expected.size());
+    REQUIRE(std::distance(history.begin(), history.end()) ==
+            static_cast<std::ptrdiff_t>(expected.size()));
+    auto it = history.begin();
+    for (auto const &entry : expected) {
+        REQUIRE(it->first == makeTime(entry.first));
+        REQUIRE(it->second == entry.second);
+        ++it;
+    }
+}
+} // namespace
+
+TEST_CASE("history container basics") {
+    HistoryContainer<int> history(4);
+    REQUIRE(history.empty());
+    REQUIRE(history.capacity() == 4);
+    REQUIRE(history.pop_before(makeTime(10)) == 0);
+    REQUIRE(history.pop_after(makeTime(10)) == 0);
+    REQUIRE(history.closest_not_newer(makeTime(10)) == history.end());
+
+    history.push_newest(makeTime(10), 1);
+    history.push_newest(makeTime(20), 2);
+    history.push_newest(makeTime(20), 3);
+    REQUIRE_THROWS(history.push_newest(makeTime(15), 4));
+    checkContents(history, {{10, 1}, {20, 2}, {20, 3}});
+    REQUIRE(history.oldest() == 1);
+    REQUIRE(history.newest() == 3);
+    REQUIRE(history.oldest_timestamp() == makeTime(10));
+    REQUIRE(history.newest_timestamp() == makeTime(20));
+
+    REQUIRE(history.closest_not_newer(makeTime(5)) == history.end());
+    REQUIRE(history.closest_not_newer(makeTime(15))->second == 1);
+    REQUIRE(history.closest_not_newer(makeTime(25))->second == 3);
+
+    auto count = 0;
+    for (auto const &entry : history.get_range_newer_than(makeTime(10))) {
+        REQUIRE(entry.first == makeTime(20));
+        ++count;
+    }
+    REQUIRE(count == 2);
+}
+
+TEST_CASE("history container pops and searches across wraparound") {
+    HistoryContainer<int> history(8);
+    Reference expected;
+    int t = 0;
+    /// Slide a window of about 5 entries through a ring of 8 several times.
+    for (int i = 0; i < 50; ++i) {
+        t += 10;
+        history.push_newest(makeTime(t), i);
+        expected.emplace_back(t, i);
+        if (expected.size() > 5) {
+            auto cutoff = expected[expected.size() - 5].first;
+            auto popped = history.pop_before(makeTime(cutoff));
+            REQUIRE(popped == expected.size() - 5);
+            expected.erase(expected.begin(), expected.end() - 5);
+        }
+        checkContents(history, expected);
+
+        auto middle = expected[expected.size() / 2];
+        REQUIRE(history.lower_bound(makeTime(middle.first))->second ==
+                middle.second);
+        REQUIRE(history.upper_bound(makeTime(middle.first - 5))->second ==
+                middle.second);
+    }
+    REQUIRE(history.capacity() == 8);
+    REQUIRE(history.highWaterMark() == 6);
+
+    /// pop_after removes the newest entries.
+    auto cutoff = expected[1].first;
+    REQUIRE(history.pop_after(makeTime(cutoff)) == expected.size() - 2);
+    expected.erase(expected.begin() + 2, expected.end());
+    checkContents(history, expected);
+
+    /// pop_before a time newer than everything leaves the history as-is.
+    REQUIRE(history.pop_before(makeTime(t + 100)) == 0);
+    checkContents(history, expected);
+}
+
+TEST_CASE("history container grows when full") {
+    HistoryContainer<int> history(4);
+    Reference expected;
+    /// Wrap first, so growing has to unwrap the entries.
+    for (int i = 0; i < 3; ++i) {
+        history.push_newest(makeTime(i), i);
+    }
+    history.pop_before(makeTime(2));
+    expected.emplace_back(2, 2);
+    for (int i = 3; i < 20; ++i) {
+        history.push_newest(makeTime(i), i);
+        expected.emplace_back(i, i);
+    }
+    REQUIRE(history.capacity() == 32);
+    checkContents(history, expected);
+
+    auto copy = history;
+    checkContents(copy, expected);
+
+    auto moved = std::move(copy);
+    checkContents(moved, expected);
+    moved.push_newest(makeTime(100), 100);
+    expected.emplace_back(100, 100);
+    checkContents(moved, expected);
+
+    history.clear();
+    REQUIRE(history.empty());
+    history.push_newest(makeTime(1), 1);
+    checkContents(history, {{1, 1}});
+}
@@ -0,0 +1,129 @@
+/** @file
+    @brief Implementation
+
+    @date 2017
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2017 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#define CATCH_CONFIG_MAIN
+
+// Internal Includes
+#include <BlobParams.h>
+#include <EdgeHoleBlobExtractor.h>
+#include <LedMeasurement.h>
+
+// Library/third-party includes
+#include <catch.hpp>
+#include <opencv2/core/core.hpp>
+#include <opencv2/imgproc/imgproc.hpp>
+
+// Standard includes
+#include <vector>
+
+using namespace osvr::vbtracker;
+
+namespace {
+/// Black frame with a grid of bright disks, so every region around a disk
+/// spans the same pixel value range as the whole frame.
+inline cv::Mat makeDiskImage(std::vector<cv::Point> &centers) {
+    cv::Mat gray(cv::Size(640, 480), CV_8UC1, cv::Scalar(0));
+    for (int y = 60; y < 480; y += 120) {
+        for (int x = 50; x < 640; x += 90) {
+            centers.emplace_back(x, y);
+            cv::circle(gray, centers.back(), 5, cv::Scalar(255), -1);
+        }
+    }
+    return gray;
+}
+
+inline BlobExtractorPtr makeExtractor() {
+    return makeBlobExtractor(BlobParams{}, EdgeHoleParams{});
+}
+
+inline bool contains(std::vector<cv::Rect> const &regions,
+                     cv::Point2f const &pt) {
+    for (auto const &region : regions) {
+        if (region.contains(pt)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+inline void requireSameMeasurement(LedMeasurement const &a,
+                                   LedMeasurement const &b) {
+    REQUIRE(a.loc.x == Approx(b.loc.x).epsilon(1e-4));
+    REQUIRE(a.loc.y == Approx(b.loc.y).epsilon(1e-4));
+    REQUIRE(a.area == Approx(b.area));
+    REQUIRE(a.imageSize == b.imageSize);
+}
+} // namespace
+
+TEST_CASE("RegionBlobExtraction-matches-full-frame") {
+    std::vector<cv::Point> centers;
+    cv::Mat gray = makeDiskImage(centers);
+    auto fullExtractor = makeExtractor();
+    LedMeasurementVec full = fullExtractor->extractBlobs(gray);
+    REQUIRE(full.size() == centers.size());
+
+    /// Search around every other disk, plus one more region hanging off the
+    /// edge of the frame around the first disk of the second row.
+    std::vector<cv::Rect> regions;
+    for (std::size_t i = 0; i < centers.size(); i += 2) {
+        regions.emplace_back(centers[i] - cv::Point(20, 20), cv::Size(41, 41));
+    }
+    regions.emplace_back(cv::Point(-30, 150), cv::Size(100, 60));
+
+    auto regionExtractor = makeExtractor();
+    LedMeasurementVec const &inRegions =
+        regionExtractor->extractBlobsInRegions(gray, regions);
+
+    std::size_t expected = 0;
+    for (auto const &meas : full) {
+        if (contains(regions, meas.loc)) {
+            ++expected;
+        }
+    }
+    REQUIRE(expected < full.size());
+    REQUIRE(inRegions.size() == expected);
+    for (auto const &meas : inRegions) {
+        CAPTURE(meas.loc.x);
+        CAPTURE(meas.loc.y);
+        REQUIRE(contains(regions, meas.loc));
+        LedMeasurement const *match = nullptr;
+        for (auto const &candidate : full) {
+            if (cv::norm(candidate.loc - meas.loc) < 1.f) {
+                match = &candidate;
+            }
+        }
+        REQUIRE(match != nullptr);
+        requireSameMeasurement(meas, *match);
+    }
+}
+
+TEST_CASE("RegionBlobExtraction-no-usable-regions") {
+    std::vector<cv::Point> centers;
+    cv::Mat gray = makeDiskImage(centers);
+    auto extractor = makeExtractor();
+    std::vector<cv::Rect> regions;
+    REQUIRE(extractor->extractBlobsInRegions(gray, regions).empty());
+    regions.emplace_back(cv::Point(700, 10), cv::Size(40, 40));
+    REQUIRE(extractor->extractBlobsInRegions(gray, regions).empty());
+}
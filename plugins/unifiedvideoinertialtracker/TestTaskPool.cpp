@@ -0,0 +1,100 @@
+/** @file
+    @brief Implementation
+
+    @date 2017
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2017 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#define CATCH_CONFIG_MAIN
+
+// Internal Includes
+#include "TaskPool.h"
+
+// Library/third-party includes
+#include <catch.hpp>
+
+// Standard includes
+#include <atomic>
+#include <chrono>
+#include <numeric>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using osvr::vbtracker::TaskPool;
+
+TEST_CASE("TaskPool-serial") {
+    TaskPool pool(0);
+    REQUIRE(pool.concurrency() == 1);
+    std::vector<std::size_t> order;
+    pool.parallelFor(5, [&](std::size_t i) { order.push_back(i); });
+    REQUIRE(order == (std::vector<std::size_t>{0, 1, 2, 3, 4}));
+}
+
+TEST_CASE("TaskPool-every-task-runs-once") {
+    TaskPool pool(3);
+    REQUIRE(pool.concurrency() == 4);
+    for (std::size_t n : {0, 1, 2, 3, 4, 7, 64, 1000}) {
+        CAPTURE(n);
+        std::vector<std::atomic<int>> counts(n);
+        for (auto &count : counts) {
+            count = 0;
+        }
+        for (int batch = 0; batch < 20; ++batch) {
+            pool.parallelFor(n, [&](std::size_t i) { ++counts[i]; });
+        }
+        for (auto &count : counts) {
+            REQUIRE(count == 20);
+        }
+    }
+}
+
+TEST_CASE("TaskPool-uneven-tasks") {
+    TaskPool pool(3);
+    std::vector<int> results(16, 0);
+    /// Front-loaded: the first lane's tasks are slow, so the other threads
+    /// should end up stealing them.
+    pool.parallelFor(results.size(), [&](std::size_t i) {
+        if (i < 4) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        }
+        results[i] = static_cast<int>(i) + 1;
+    });
+    REQUIRE(std::accumulate(results.begin(), results.end(), 0) == 136);
+}
+
+TEST_CASE("TaskPool-exceptions") {
+    TaskPool pool(2);
+    std::atomic<int> ran{0};
+    REQUIRE_THROWS_AS(pool.parallelFor(10,
+                                       [&](std::size_t i) {
+                                           ++ran;
+                                           if (i == 3) {
+                                               throw std::runtime_error("x");
+                                           }
+                                       }),
+                      std::runtime_error);
+    /// The rest of the batch still ran, and the pool is still usable.
+    REQUIRE(ran == 10);
+    ran = 0;
+    pool.parallelFor(10, [&](std::size_t) { ++ran; });
+    REQUIRE(ran == 10);
+}
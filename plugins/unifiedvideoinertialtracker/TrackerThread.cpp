@@ -37,6 +37,7 @@
 #include <osvr/Util/Finally.h>
 
 // Standard includes
+#include <algorithm>
 #include <future>
 #include <iostream>
 #include <type_traits>
@@ -88,10 +89,23 @@ namespace vbtracker {
         m_numBodies = m_trackingSystem.getNumBodies();
         setupReportingVectorProcessModels();
 
-        /// Launch the image proc thread in a waiting state.
+        /// Figure out how many frames may be in flight between capture and
+        /// pose update at once.
+        auto pipelineDepth = (std::max)(
+            m_trackingSystem.getParams().imageProcessingPipelineDepth, 1);
+        if (pipelineDepth > 1 && m_trackingSystem.getParams().debug) {
+            /// The debug display reads images owned by the blob extractor,
+            /// which would be busy with a later frame.
+            msg() << "Debug display enabled: limiting image processing "
+                     "pipeline depth to 1."
+                  << std::endl;
+            pipelineDepth = 1;
+        }
 
+        /// Launch the image proc thread: it starts capturing right away.
         ImageProcessingThread imageProcThreadObj{
-            m_trackingSystem, m_cam, *this, m_camParams, m_cameraUsecOffset};
+            m_trackingSystem, m_cam, *this, m_camParams, m_cameraUsecOffset,
+            static_cast<std::size_t>(pipelineDepth)};
         imageProcThreadObj_ = &imageProcThreadObj;
         m_imageThread = std::thread{[&] { imageProcThreadObj.threadAction(); }};
 
@@ -141,8 +155,16 @@ namespace vbtracker {
     void TrackerThread::triggerStop() {
         /// Main thread method!
         msg() << "Tracker thread object: triggerStop() called" << std::endl;
-        std::lock_guard<std::mutex> lock(m_runMutex);
-        m_run = false;
+        {
+            std::lock_guard<std::mutex> lock(m_runMutex);
+            m_run = false;
+        }
+        {
+            /// Wake the tracker thread in case it's waiting on a frame.
+            std::lock_guard<std::mutex> lock(m_messageMutex);
+            m_stopRequested = true;
+        }
+        m_messageCondVar.notify_one();
     }
 
     bool TrackerThread::submitIMUReport(TrackedBodyIMU &imu,
@@ -175,16 +197,11 @@ namespace vbtracker {
         return m_debugDataMessages.read(data);
     }
 
-    void
-    TrackerThread::signalImageProcessingComplete(ImageOutputDataPtr &&imageData,
-                                                 cv::Mat const &frame,
-                                                 cv::Mat const &frameGray) {
-        m_imageData = std::move(imageData);
-        m_frame = frame;
-        m_frameGray = frameGray;
+    void TrackerThread::signalImageProcessingComplete(
+        ImageOutputDataPtr &&imageData) {
         {
             std::lock_guard<std::mutex> lock{m_messageMutex};
-            m_timeConsumingImageStepComplete = true;
+            m_processedFrames.push_back(std::move(imageData));
         }
         m_messageCondVar.notify_one();
     }
@@ -196,53 +213,38 @@ namespace vbtracker {
     std::ostream &TrackerThread::warn() const { return msg() << "Warning: "; }
 
     void TrackerThread::doFrame() {
-        // Check camera status.
-        if (!m_cam.ok()) {
-            // Hmm, camera seems bad. Might regain it? Skip for now...
-            warn() << "Camera is reporting it is not OK." << std::endl;
-            return;
-        }
-        // Trigger a grab.
-        if (!m_cam.grab()) {
-            // Again failing without quitting, in hopes we get better luck
-            // next time...
-            warn() << "Camera grab failed." << std::endl;
-            return;
-        }
-        // When we triggered the grab was a good guess of the time
-        // for the image before that got moved upstream into the ImageSource
-        // library.
-
-        /// Launch an asynchronous task to perform the image retrieval and
-        /// initial image processing.
-        launchTimeConsumingImageStep();
         if (m_bufferImu) {
             setImuOverrideClock();
         }
         /// only used if m_bufferImu
         UpdatedBodyIndices imuIndices;
 
-        bool finishedImage = false;
+        ImageOutputDataPtr imageData;
         do {
 
             {
-                /// Wait for something to do (Completion of image, IMU reports)
+                /// Wait for something to do (a processed frame, IMU reports,
+                /// or a request to stop)
                 std::unique_lock<std::mutex> lock(m_messageMutex);
                 m_messageCondVar.wait(lock, [&] {
-                    return m_timeConsumingImageStepComplete ||
-                           !m_imuMessages.isEmpty();
+                    return !m_processedFrames.empty() ||
+                           !m_imuMessages.isEmpty() || m_stopRequested;
                 });
-                if (m_timeConsumingImageStepComplete) {
-                    /// Set a flag to get us out of this innermost loop - we'll
-                    /// finish up processing this frame and trigger another grab
-                    /// before we look at more IMU data.
-                    finishedImage = true;
+                if (m_stopRequested) {
+                    return;
+                }
+                if (!m_processedFrames.empty()) {
+                    /// Take the oldest frame - this gets us out of this
+                    /// innermost loop, and we'll finish up processing this
+                    /// frame before we look at more IMU data.
+                    imageData = std::move(m_processedFrames.front());
+                    m_processedFrames.pop_front();
                 }
                 // Otherwise we have some IMU reports to keep us busy in the
                 // meantime.
             } // unlock
 
-            if (!finishedImage) {
+            if (!imageData) {
                 /// This means we got out of waiting on the condition variable
                 /// because of an IMU message. Handle one.
 
@@ -277,27 +279,18 @@ namespace vbtracker {
                     updateReportingVector(id);
                 }
             }
-        } while (!finishedImage);
-
-        // OK, once we get here, we know the timeConsumingImageStep is complete.
-        if (!m_frame.data || !m_frameGray.data) {
-            // but it ended early due to error.
-            warn() << "Camera retrieve appeared to fail: frames had null "
-                      "pointers!"
-                   << std::endl;
-            return;
-        }
+        } while (!imageData);
 
-        if (!m_imageData) {
-            // but it failed to set the pointer? this is very strange...
-            warn() << "Initial image processing failed somehow!" << std::endl;
-            return;
-        }
+        /// Hang on to the image buffers: once the tracking system is done
+        /// with this frame, they go back to the image processing thread for
+        /// reuse.
+        cv::Mat frame = imageData->frame;
+        cv::Mat frameGray = imageData->frameGray;
 
         // Submit initial image data to the tracking system.
         auto bodyIds =
-            m_trackingSystem.updateBodiesFromVideoData(std::move(m_imageData));
-        m_imageData.reset();
+            m_trackingSystem.updateBodiesFromVideoData(std::move(imageData));
+        imageProcThreadObj_->recycleFrame(frame, frameGray);
 
         // Sort those body IDs so we can merge them with the body IDs from any
         // IMU messages we're about to process.
@@ -527,14 +520,5 @@ namespace vbtracker {
             m_debugDataMessages.write(newDebugArray);
         }
     }
-
-    void TrackerThread::launchTimeConsumingImageStep() {
-        /// Our thread would be the only one reading or writing this flag at
-        /// this point, so it's OK now to write this without protection.
-        m_timeConsumingImageStepComplete = false;
-
-        /// Release the thread from waiting.
-        imageProcThreadObj_->signalDoFrame();
-    }
 } // namespace vbtracker
 } // namespace osvr
@@ -48,6 +48,7 @@
 #include <chrono>
 #include <condition_variable>
 #include <cstdint>
+#include <deque>
 #include <future>
 #include <iosfwd>
 #include <mutex>
@@ -112,10 +113,8 @@ namespace vbtracker {
         /// @}
 
         /// Call from image processing thread to signal completion of frame
-        /// processing.
-        void signalImageProcessingComplete(ImageOutputDataPtr &&imageData,
-                                           cv::Mat const &frame,
-                                           cv::Mat const &frameGray);
+        /// processing. Frames are queued and handled in the order submitted.
+        void signalImageProcessingComplete(ImageOutputDataPtr &&imageData);
 
       private:
         /// Helper providing a prefixed output stream for normal messages.
@@ -142,10 +141,6 @@ namespace vbtracker {
         /// - just reports the single body.
         void updateReportingVector(BodyId const bodyId);
 
-        /// This function is responsible for triggering the image capture and
-        /// processing asynchronously in a separate thread.
-        void launchTimeConsumingImageStep();
-
         std::pair<BodyId, ImuMessageCategory>
         processIMUMessage(IMUMessage const &m);
 
@@ -199,13 +194,6 @@ namespace vbtracker {
 
         bool m_setCameraPose = false;
 
-        /// @name Updated asynchronously by timeConsumingImageStep()
-        /// @{
-        cv::Mat m_frame;
-        cv::Mat m_frameGray;
-        ImageOutputDataPtr m_imageData;
-        /// @}
-
         /// @name Run flag
         /// @{
         std::mutex m_runMutex;
@@ -217,7 +205,10 @@ namespace vbtracker {
         /// @{
         std::condition_variable m_messageCondVar;
         std::mutex m_messageMutex;
-        bool m_timeConsumingImageStepComplete = false;
+        /// Frames done with initial image processing, oldest first.
+        std::deque<ImageOutputDataPtr> m_processedFrames;
+        /// Set by triggerStop() so a waiting doFrame() returns promptly.
+        bool m_stopRequested = false;
         folly::ProducerConsumerQueue<IMUMessage> m_imuMessages;
         /// @}
 
@@ -225,7 +216,8 @@ namespace vbtracker {
 
         ImageProcessingThread *imageProcThreadObj_ = nullptr;
 
-        /// The thread used by timeConsumingImageStep()
+        /// The thread running the capture and initial image processing
+        /// pipeline.
         std::thread m_imageThread;
     };
 } // namespace vbtracker
@@ -25,12 +25,14 @@
 // Internal Includes
 #include "TrackingSystem.h"
 #include "ForEachTracked.h"
+#include "ProjectPoint.h"
 #include "RoomCalibration.h"
 #include "SBDBlobExtractor.h"
 #include "TrackedBody.h"
 #include "TrackedBodyTarget.h"
 #include "TrackingSystem_Impl.h"
 #include "UndistortMeasurements.h"
+#include "cvToEigen.h"
 
 // Library/third-party includes
 #include <boost/assert.hpp>
@@ -41,8 +43,10 @@
 #include <algorithm>
 #include <iostream>
 #include <iterator>
+#include <mutex>
 #include <stdexcept>
 #include <string>
+#include <utility>
 
 static const auto ROOM_CALIBRATION_SKIP_BRIGHTS_CUTOFF = 4;
 static const auto CALIBRATION_RANSAC_ITERATIONS = 8;
@@ -80,8 +84,13 @@ namespace vbtracker {
         ret->frame = frame;
         ret->frameGray = frameGray;
         ret->camParams = camParams.createUndistortedVariant();
+        auto const &regions =
+            m_impl->getBlobSearchRegions(camParams, frameGray.size());
         auto rawMeasurements =
-            m_impl->blobExtractor->extractBlobs(ret->frameGray);
+            regions.empty()
+                ? m_impl->blobExtractor->extractBlobs(ret->frameGray)
+                : m_impl->blobExtractor->extractBlobsInRegions(ret->frameGray,
+                                                               regions);
         ret->ledMeasurements = undistortLeds(rawMeasurements, camParams);
         return ret;
     }
@@ -119,6 +128,9 @@ namespace vbtracker {
         /// Do the third phase of tracking.
         updatePoseEstimates();
 
+        /// Tell the image processing where to look next.
+        updateBlobSearchHint();
+
         /// Trigger debug display, if activated.
         m_impl->triggerDebugDisplay(*this);
 
@@ -144,33 +156,50 @@ namespace vbtracker {
             return;
         }
 
-        auto const &updateCount = m_impl->updateCount;
-        for (auto &bodyTargetWithMeasurements : updateCount) {
+        /// Gather the targets to update, in a deterministic order.
+        auto &tasks = m_impl->poseEstimationTasks;
+        tasks.clear();
+        for (auto &bodyTargetWithMeasurements : m_impl->updateCount) {
             auto targetPtr = getTarget(bodyTargetWithMeasurements.first);
             validateTargetPointerFromUpdateList(targetPtr);
-            auto &target = *targetPtr;
-
-            /// @todo right now assumes one target per body here!
-            auto &body = target.getBody();
-            util::time::TimeValue stateTime = {};
-            BodyState state;
-            auto newTime = m_impl->lastFrame;
-            auto validState =
-                body.getStateAtOrBefore(newTime, stateTime, state);
-            auto initialTime = stateTime;
-
-            auto gotPose = target.updatePoseEstimateFromLeds(
-                m_impl->camParams, newTime, state, stateTime, validState);
-            if (gotPose) {
-                body.replaceStateSnapshot(initialTime, newTime, state);
-#if 0
-                static auto s = ::util::Stride{101};
-                if (++s) {
-                    std::cout << body.getState().position().transpose() << "\n";
+            tasks.push_back(PoseEstimationTask{bodyTargetWithMeasurements.first,
+                                               targetPtr, false});
+        }
+        std::sort(begin(tasks), end(tasks),
+                  [](PoseEstimationTask const &a, PoseEstimationTask const &b) {
+                      return std::make_pair(a.id.first.value(),
+                                            a.id.second.value()) <
+                             std::make_pair(b.id.first.value(),
+                                            b.id.second.value());
+                  });
+
+        /// Each target only touches its own body's state, so the targets can
+        /// all be estimated at once.
+        /// @todo right now assumes one target per body here!
+        auto const &camParams = m_impl->camParams;
+        auto const newTime = m_impl->lastFrame;
+        m_impl->poseEstimationPool.parallelFor(
+            tasks.size(), [&](std::size_t i) {
+                auto &task = tasks[i];
+                auto &target = *task.target;
+                auto &body = target.getBody();
+                util::time::TimeValue stateTime = {};
+                BodyState state;
+                auto validState =
+                    body.getStateAtOrBefore(newTime, stateTime, state);
+                auto initialTime = stateTime;
+
+                task.gotPose = target.updatePoseEstimateFromLeds(
+                    camParams, newTime, state, stateTime, validState);
+                if (task.gotPose) {
+                    body.replaceStateSnapshot(initialTime, newTime, state);
                 }
-#endif
+            });
+
+        for (auto const &task : tasks) {
+            if (task.gotPose) {
                 /// @todo deduplicate in making this list.
-                m_updated.push_back(body.getId());
+                m_updated.push_back(task.id.first);
             }
         }
         /// Prune history after video update.
@@ -182,6 +211,61 @@ namespace vbtracker {
         }
     }
 
+    void TrackingSystem::updateBlobSearchHint() {
+        auto &impl = *m_impl;
+        if (!impl.roiBlobSearch) {
+            return;
+        }
+        auto &hint = impl.blobSearchHintNext;
+        hint.clear();
+        bool confident = isRoomCalibrationComplete();
+        bool sawTarget = false;
+        auto const &camParams = impl.camParams;
+        Eigen::Vector2d principalPoint = cvToVector(camParams.principalPoint());
+        forEachTarget(*this, [&](TrackedBodyTarget &target) {
+            sawTarget = true;
+            if (!confident) {
+                return;
+            }
+            /// Must be well within the error bounds that would trigger a
+            /// reset.
+            auto variance = target.getInternalStatusMeasurement(
+                TargetStatusMeasurement::MaxPosErrorVariance);
+            auto varianceLimit = target.getInternalStatusMeasurement(
+                TargetStatusMeasurement::PosErrorVarianceLimit);
+            if (!target.hasPoseEstimate() || variance * 2 > varianceLimit) {
+                confident = false;
+                return;
+            }
+            /// Same transform as the Kalman measurement model: the body state
+            /// applies directly to the beacon state vectors.
+            auto const &state = target.getBody().getState();
+            Eigen::Quaterniond rotation = state.getCombinedQuaternion();
+            Eigen::Vector3d translation = state.position();
+            auto numBeacons = target.getNumBeacons();
+            for (UnderlyingBeaconIdType i = 0; i < numBeacons; ++i) {
+                Eigen::Vector3d beacon =
+                    target.getBeaconAutocalibPosition(ZeroBasedBeaconId(i)) -
+                    target.getBeaconOffset();
+                Eigen::Vector3d camPoint = rotation * beacon + translation;
+                if (camPoint.z() <= 0) {
+                    /// Behind the camera.
+                    continue;
+                }
+                Eigen::Vector2d predicted = projectPoint(
+                    camParams.focalLength(), principalPoint, camPoint);
+                hint.emplace_back(predicted.x(), predicted.y());
+            }
+        });
+        confident = confident && sawTarget;
+
+        std::lock_guard<std::mutex> lock(impl.blobSearchHintMutex);
+        impl.haveBlobSearchHint = confident;
+        if (confident) {
+            impl.blobSearchHint.swap(hint);
+        }
+    }
+
     void TrackingSystem::calibrationVideoPhaseThree() {
         auto const &updateCount = m_impl->updateCount;
         for (auto &bodyTargetWithMeasurements : updateCount) {
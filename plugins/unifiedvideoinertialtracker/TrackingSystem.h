@@ -163,6 +163,11 @@ namespace vbtracker {
         /// calibration is incomplete.
         void calibrationVideoPhaseThree();
 
+        /// After pose estimation, predicts where each beacon will appear in
+        /// the next frame, for the region-of-interest blob search - or, if
+        /// any target isn't tracking confidently, requests a full search.
+        void updateBlobSearchHint();
+
         using BodyPtr = std::unique_ptr<TrackedBody>;
         ConfigParams m_params;
 
@@ -25,16 +25,48 @@
 // Internal Includes
 #include "TrackingSystem_Impl.h"
 #include "TrackingDebugDisplay.h"
+#include <CameraDistortionModel.h>
 #include <EdgeHoleBlobExtractor.h>
+#include <cvToEigen.h>
 
 // Library/third-party includes
 // - none
 
 // Standard includes
-// - none
+#include <thread>
 
 namespace osvr {
 namespace vbtracker {
+    /// Number of pool threads to start in addition to the tracker thread.
+    static std::size_t getPoseEstimationWorkers(ConfigParams const &p) {
+        auto threads = p.poseEstimationThreads;
+        if (threads <= 0) {
+            threads = static_cast<int>(std::thread::hardware_concurrency());
+        }
+        return threads > 1 ? static_cast<std::size_t>(threads - 1) : 0;
+    }
+
+    /// Replaces any regions that overlap with their bounding rectangle, until
+    /// none overlap, so no part of the image is searched (and no blob found)
+    /// twice.
+    static void mergeOverlappingRegions(std::vector<cv::Rect> &regions) {
+        bool merged = true;
+        while (merged) {
+            merged = false;
+            for (std::size_t i = 0; i < regions.size(); ++i) {
+                for (std::size_t j = i + 1; j < regions.size();) {
+                    if ((regions[i] & regions[j]).area() > 0) {
+                        regions[i] |= regions[j];
+                        regions[j] = regions.back();
+                        regions.pop_back();
+                        merged = true;
+                    } else {
+                        ++j;
+                    }
+                }
+            }
+        }
+    }
 
     TrackingSystem::Impl::Impl(ConfigParams const &params)
         : blobExtractor(
@@ -42,7 +74,12 @@ namespace vbtracker {
           debugDisplay(new TrackingDebugDisplay(params)),
           calib(Eigen::Vector3d(params.cameraPosition), params.cameraIsForward),
           cameraPose(Eigen::Isometry3d::Identity()),
-          cameraPoseInv(Eigen::Isometry3d::Identity()) {}
+          cameraPoseInv(Eigen::Isometry3d::Identity()),
+          poseEstimationPool(getPoseEstimationWorkers(params)),
+          roiBlobSearch(params.roiBlobSearch && !params.debug),
+          roiBlobSearchRadius(params.roiBlobSearchRadius),
+          roiBlobSearchFullFrameInterval(
+              params.roiBlobSearchFullFrameInterval) {}
 
     TrackingSystem::Impl::~Impl() {
         // out line to break circular dep with this and the debug display.
@@ -51,5 +88,60 @@ namespace vbtracker {
     void TrackingSystem::Impl::triggerDebugDisplay(TrackingSystem &tracking) {
         debugDisplay->triggerDisplay(tracking, *this);
     }
+
+    std::vector<cv::Rect> const &TrackingSystem::Impl::getBlobSearchRegions(
+        CameraParameters const &camParams, cv::Size const &imageSize) {
+        blobSearchRegions.clear();
+        if (!roiBlobSearch) {
+            return blobSearchRegions;
+        }
+        /// Periodically search the whole frame, to pick up targets and
+        /// beacons that have come into view.
+        if (++framesSinceFullBlobSearch >= roiBlobSearchFullFrameInterval) {
+            framesSinceFullBlobSearch = 0;
+            return blobSearchRegions;
+        }
+        {
+            std::lock_guard<std::mutex> lock(blobSearchHintMutex);
+            if (!haveBlobSearchHint) {
+                framesSinceFullBlobSearch = 0;
+                return blobSearchRegions;
+            }
+            blobSearchCenters = blobSearchHint;
+        }
+
+        /// The hint is in undistorted coordinates, the frame is not.
+        auto distortionModel = CameraDistortionModel{
+            Eigen::Vector2d{camParams.focalLengthX(), camParams.focalLengthY()},
+            cvToVector(camParams.principalPoint()),
+            Eigen::Vector3d{camParams.k1(), camParams.k2(), camParams.k3()}};
+        auto const imageRect = cv::Rect(cv::Point(0, 0), imageSize);
+        auto const size = 2 * roiBlobSearchRadius + 1;
+        for (auto const &center : blobSearchCenters) {
+            Eigen::Vector2d distorted =
+                distortionModel.distortPoint(cvToVector(center));
+            auto region =
+                cv::Rect(cvRound(distorted.x()) - roiBlobSearchRadius,
+                         cvRound(distorted.y()) - roiBlobSearchRadius, size,
+                         size) &
+                imageRect;
+            if (region.area() > 0) {
+                blobSearchRegions.push_back(region);
+            }
+        }
+        mergeOverlappingRegions(blobSearchRegions);
+
+        /// Past a point, searching the regions separately costs more than
+        /// searching the whole frame once.
+        int totalArea = 0;
+        for (auto const &region : blobSearchRegions) {
+            totalArea += region.area();
+        }
+        if (blobSearchRegions.empty() || totalArea * 2 > imageRect.area()) {
+            blobSearchRegions.clear();
+            framesSinceFullBlobSearch = 0;
+        }
+        return blobSearchRegions;
+    }
 } // namespace vbtracker
 } // namespace osvr
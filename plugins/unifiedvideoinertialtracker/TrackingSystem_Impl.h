@@ -28,6 +28,7 @@
 // Internal Includes
 #include "ConfigParams.h"
 #include "RoomCalibration.h"
+#include "TaskPool.h"
 #include "TrackingSystem.h"
 #include <CameraParameters.h>
 #include <GenericBlobExtractor.h>
@@ -39,11 +40,23 @@
 #include <osvr/Util/TimeValue.h>
 
 // Standard includes
+#include <cstddef>
 #include <memory>
+#include <mutex>
+#include <vector>
 
 namespace osvr {
 namespace vbtracker {
     class TrackingDebugDisplay;
+    class TrackedBodyTarget;
+
+    /// Per-target slot for the pose estimation phase, filled in by whichever
+    /// pool thread runs that target's estimation.
+    struct PoseEstimationTask {
+        BodyTargetId id;
+        TrackedBodyTarget *target;
+        bool gotPose;
+    };
 
     /// Private implementation structure for TrackingSystem
     struct TrackingSystem::Impl : private boost::noncopyable {
@@ -52,6 +65,16 @@ namespace vbtracker {
         EIGEN_MAKE_ALIGNED_OPERATOR_NEW
         void triggerDebugDisplay(TrackingSystem &tracking);
 
+        /// Called on the image processing thread: decides where to search the
+        /// next frame for blobs, based on the latest hint from the tracker.
+        /// @param camParams the (distorted) parameters of the raw frame.
+        /// @param imageSize size of the raw frame.
+        /// @return regions of the raw frame to search, or an empty vector for
+        /// the whole frame.
+        std::vector<cv::Rect> const &
+        getBlobSearchRegions(CameraParameters const &camParams,
+                             cv::Size const &imageSize);
+
         /// @name Cached data from the ImageProcessingOutput updated in phase 2
         /// @{
         /// Cached copy of the last grey frame
@@ -73,6 +96,38 @@ namespace vbtracker {
         LedUpdateCount updateCount;
         BlobExtractorPtr blobExtractor;
         std::unique_ptr<TrackingDebugDisplay> debugDisplay;
+
+        /// @name Pose estimation (phase 3)
+        /// @{
+        /// Runs each target's pose estimation on its own task.
+        TaskPool poseEstimationPool;
+        /// One slot per target with measurements this frame, sorted by ID so
+        /// results are applied in the same order no matter which thread
+        /// finished first. Cleared, not freed, between frames.
+        std::vector<PoseEstimationTask> poseEstimationTasks;
+        /// @}
+
+        /// @name Region-of-interest blob search
+        /// @{
+        /// Off in debug mode, since the debug display expects whole-frame
+        /// extractor output.
+        bool roiBlobSearch;
+        int roiBlobSearchRadius;
+        int roiBlobSearchFullFrameInterval;
+        /// Protects blobSearchHint and haveBlobSearchHint, which are written
+        /// by the tracker thread and read by the image processing thread.
+        std::mutex blobSearchHintMutex;
+        /// Predicted (undistorted) image locations of all beacons, valid only
+        /// if haveBlobSearchHint.
+        std::vector<cv::Point2d> blobSearchHint;
+        bool haveBlobSearchHint = false;
+        /// Tracker thread scratch space for building the next hint.
+        std::vector<cv::Point2d> blobSearchHintNext;
+        /// Image processing thread state and scratch space.
+        std::vector<cv::Point2d> blobSearchCenters;
+        std::vector<cv::Rect> blobSearchRegions;
+        int framesSinceFullBlobSearch = 0;
+        /// @}
     };
 
 } // namespace vbtracker
@@ -70,6 +70,8 @@ namespace vbtracker {
         explicit ImageRangeInfo(cv::InputArray img) {
             cv::minMaxIdx(img, &minVal, &maxVal);
         }
+        ImageRangeInfo(double minimum, double maximum)
+            : minVal(minimum), maxVal(maximum) {}
         double minVal;
         double maxVal;
         double lerp(double alpha) const {
@@ -55,6 +55,25 @@ namespace vbtracker {
             return undistorted;
         }
 
+        /// Approximate inverse of undistortPoint(), by fixed-point iteration:
+        /// good enough to locate a point in the raw image, not to measure it.
+        Eigen::Vector2d distortPoint(Eigen::Vector2d const &pointu,
+                                     int iterations = 5) const {
+            Eigen::Vector2d normalizedUndistorted =
+                ((pointu - m_c).array() / m_fl.array()).matrix();
+            Eigen::Vector2d normalizedDistorted = normalizedUndistorted;
+            for (int i = 0; i < iterations; ++i) {
+                double r2 = normalizedDistorted.squaredNorm();
+                normalizedDistorted =
+                    normalizedUndistorted /
+                    (1 + m_k[0] * r2 + m_k[1] * r2 * r2 +
+                     m_k[2] * r2 * r2 * r2);
+            }
+            Eigen::Vector2d distorted =
+                (normalizedDistorted.array() * m_fl.array()).matrix() + m_c;
+            return distorted;
+        }
+
       private:
         Eigen::Vector2d m_fl;
         /// assumes center of project is also center of distortion
@@ -56,7 +56,7 @@ namespace vbtracker {
 
     EdgeHoleBasedLedExtractor::EdgeHoleBasedLedExtractor(
         EdgeHoleParams const &extractorParams)
-        : extParams_(extractorParams)
+        : extParams_(extractorParams), fusedEdgeDetector_(extractorParams)
 #ifdef OSVR_USE_REALTIME_LAPLACIAN
           ,
           laplacianImpl_(new RealtimeLaplacian(EDGE_DETECT_DEST_DEPTH,
@@ -87,6 +87,12 @@ namespace vbtracker {
     LedMeasurementVec const &EdgeHoleBasedLedExtractor::
     operator()(cv::Mat const &gray, BlobParams const &p,
                bool verboseBlobOutput) {
+        return (*this)(gray, ImageRangeInfo(gray), p, verboseBlobOutput);
+    }
+
+    LedMeasurementVec const &EdgeHoleBasedLedExtractor::
+    operator()(cv::Mat const &gray, ImageRangeInfo const &rangeInfo,
+               BlobParams const &p, bool verboseBlobOutput) {
         reset();
 
 #ifdef OSVR_UVBI_CORE
@@ -98,7 +104,6 @@ namespace vbtracker {
         gray.copyTo(gray_);
 
         /// Set up the threshold parameters
-        auto rangeInfo = ImageRangeInfo(gray_);
         if (rangeInfo.maxVal < p.absoluteMinThreshold) {
             /// Early out - empty image!
             return measurements_;
@@ -108,6 +113,33 @@ namespace vbtracker {
         minBeaconCenterVal_ =
             static_cast<std::uint8_t>(thresholdInfo.minThreshold);
 
+#if OSVR_EDGEHOLE_UMAT
+        detectEdgesWithOpenCV();
+#else
+        if (fusedEdgeDetector_.supports(gray_)) {
+            /// Blur, edge detection, erosion, blur, and threshold in one
+            /// pass, without the full-frame intermediates.
+            fusedEdgeDetector_(gray_, edge_, edgeBinary_);
+        } else {
+            detectEdgesWithOpenCV();
+        }
+#endif
+
+        /// Extract beacons from the edge detection image
+
+        // The lambda ("continuation") is called with each "hole" in the edge
+        // detection image, it's up to us what to do with the contour we're
+        // given. We examine it for suitability as an LED, and if it passes our
+        // checks, add a derived measurement to our measurement vector and the
+        // contour itself to our list of contours for debugging display.
+        edgeBinary_.copyTo(binTemp_);
+        consumeHolesOfConnectedComponents(
+            binTemp_, contoursTempStorage_, hierarchyTempStorage_,
+            [&](ContourType &&contour) { checkBlob(std::move(contour), p); });
+        return measurements_;
+    }
+
+    void EdgeHoleBasedLedExtractor::detectEdgesWithOpenCV() {
         /// Used to do basic thresholding here first to reduce background noise,
         /// but turns out that actually produced worse results at the end of the
         /// process (presumably by producing very sharp edges)
@@ -151,20 +183,8 @@ namespace vbtracker {
                           extParams_.postEdgeDetectionBlurThreshold, 255,
                           cv::THRESH_BINARY);
         }
-
-        /// Extract beacons from the edge detection image
-
-        // The lambda ("continuation") is called with each "hole" in the edge
-        // detection image, it's up to us what to do with the contour we're
-        // given. We examine it for suitability as an LED, and if it passes our
-        // checks, add a derived measurement to our measurement vector and the
-        // contour itself to our list of contours for debugging display.
-        edgeBinary_.copyTo(binTemp_);
-        consumeHolesOfConnectedComponents(
-            binTemp_, contoursTempStorage_, hierarchyTempStorage_,
-            [&](ContourType &&contour) { checkBlob(std::move(contour), p); });
-        return measurements_;
     }
+
     /// out of line for unique_ptr-based pimpl.
     EdgeHoleBasedLedExtractor::~EdgeHoleBasedLedExtractor() = default;
 
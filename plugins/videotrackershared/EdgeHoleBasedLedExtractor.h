@@ -32,6 +32,7 @@
 // Internal Includes
 #include <BlobExtractor.h>
 #include <BlobParams.h>
+#include <FusedEdgeDetection.h>
 #include <LedMeasurement.h>
 #include <osvr/Util/OpenCVVersion.h>
 
@@ -82,6 +83,13 @@ namespace vbtracker {
         LedMeasurementVec const &operator()(cv::Mat const &gray,
                                             BlobParams const &p,
                                             bool verboseBlobOutput = false);
+        /// Like the other overload, but with the range of pixel values used
+        /// to derive the thresholds supplied by the caller: lets several
+        /// regions of one frame be processed separately yet consistently.
+        LedMeasurementVec const &operator()(cv::Mat const &gray,
+                                            ImageRangeInfo const &rangeInfo,
+                                            BlobParams const &p,
+                                            bool verboseBlobOutput = false);
         ~EdgeHoleBasedLedExtractor();
 
         using ContourId = std::size_t;
@@ -116,6 +124,9 @@ namespace vbtracker {
             return input;
         }
 #endif
+        /// Edge detection and binarization of gray_ as a sequence of OpenCV
+        /// calls, for when fusedEdgeDetector_ can't handle the parameters.
+        void detectEdgesWithOpenCV();
         void checkBlob(ContourType &&contour, BlobParams const &p);
         void addToRejectList(ContourId id, RejectReason reason,
                              BlobData const &data) {
@@ -125,6 +136,9 @@ namespace vbtracker {
         /// parameters
         const EdgeHoleParams extParams_;
 
+        /// Single-pass equivalent of detectEdgesWithOpenCV()
+        FusedEdgeDetector fusedEdgeDetector_;
+
         std::uint8_t minBeaconCenterVal_ = 127;
 
         /// @name Frames/intermediates someone might care about
@@ -30,7 +30,7 @@
 // - none
 
 // Standard includes
-// - none
+#include <algorithm>
 
 namespace osvr {
 namespace vbtracker {
@@ -52,6 +52,44 @@ namespace vbtracker {
         return m_extractor(getLatestGrayImage(), m_params);
     }
 
+    LedMeasurementVec EdgeHoleBlobExtractor::extractBlobsInRegions_(
+        std::vector<cv::Rect> const &regions) {
+        cv::Mat const &gray = getLatestGrayImage();
+        auto const imageRect = cv::Rect(cv::Point(0, 0), gray.size());
+        m_clippedRegions.clear();
+        for (auto const &region : regions) {
+            auto clipped = region & imageRect;
+            if (clipped.area() > 0) {
+                m_clippedRegions.push_back(clipped);
+            }
+        }
+        LedMeasurementVec ret;
+        if (m_clippedRegions.empty()) {
+            return ret;
+        }
+
+        /// Thresholds are relative to the pixel value range, so compute that
+        /// over all the regions together, as a single search of an image
+        /// containing just these regions would.
+        auto rangeInfo = ImageRangeInfo(255., 0.);
+        for (auto const &region : m_clippedRegions) {
+            auto regionRange = ImageRangeInfo(gray(region));
+            rangeInfo.minVal = std::min(rangeInfo.minVal, regionRange.minVal);
+            rangeInfo.maxVal = std::max(rangeInfo.maxVal, regionRange.maxVal);
+        }
+
+        for (auto const &region : m_clippedRegions) {
+            auto const offset = cv::Point2f(static_cast<float>(region.x),
+                                            static_cast<float>(region.y));
+            for (auto meas : m_extractor(gray(region), rangeInfo, m_params)) {
+                meas.loc += offset;
+                meas.imageSize = gray.size();
+                ret.push_back(meas);
+            }
+        }
+        return ret;
+    }
+
     BlobExtractorPtr
     makeEdgeHoleBlobExtractor(BlobParams const &blobParams,
                               EdgeHoleParams const &extParams) {
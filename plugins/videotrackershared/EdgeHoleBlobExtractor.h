@@ -35,7 +35,7 @@
 // - none
 
 // Standard includes
-// - none
+#include <vector>
 
 namespace osvr {
 namespace vbtracker {
@@ -49,10 +49,17 @@ namespace vbtracker {
         cv::Mat generateDebugThresholdImage_() const override;
         cv::Mat generateDebugBlobImage_() const override;
         LedMeasurementVec extractBlobs_() override;
+        /// Runs the extractor on each region separately, with thresholds
+        /// from the pixel range across all of them. Note that the debug
+        /// images then only reflect the last region processed.
+        LedMeasurementVec
+        extractBlobsInRegions_(std::vector<cv::Rect> const &regions) override;
 
       private:
         BlobParams m_params;
         EdgeHoleBasedLedExtractor m_extractor;
+        /// Regions clipped to the image, kept to avoid allocation per frame.
+        std::vector<cv::Rect> m_clippedRegions;
     };
 
     /// Factory for EdgeHoleBlobExtractor objects.
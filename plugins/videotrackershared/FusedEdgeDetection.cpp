@@ -0,0 +1,426 @@
+/** @file
+    @brief Implementation
+
+    @date 2017
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2017 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include "FusedEdgeDetection.h"
+
+// Library/third-party includes
+#if defined(__AVX2__)
+#define OSVR_FUSED_EDGE_AVX2
+#define OSVR_FUSED_EDGE_SIMD
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) ||                                  \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define OSVR_FUSED_EDGE_SSE2
+#define OSVR_FUSED_EDGE_SIMD
+#include <emmintrin.h>
+#endif
+
+// Standard includes
+#include <algorithm>
+#include <cmath>
+
+namespace osvr {
+namespace vbtracker {
+    namespace {
+        /// Largest Laplacian scale whose intermediate sums still fit in the
+        /// 16-bit lanes we use.
+        static const int MAX_LAPLACIAN_SCALE = 16;
+
+#if defined(OSVR_FUSED_EDGE_AVX2)
+        /// 16 lanes of 16-bit integers.
+        using Vec = __m256i;
+        static const int VEC_LANES = 16;
+        inline Vec widen(std::uint8_t const *p) {
+            return _mm256_cvtepu8_epi16(
+                _mm_loadu_si128(reinterpret_cast<__m128i const *>(p)));
+        }
+        inline Vec load(std::uint16_t const *p) {
+            return _mm256_loadu_si256(reinterpret_cast<__m256i const *>(p));
+        }
+        inline void store(std::uint16_t *p, Vec v) {
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(p), v);
+        }
+        /// The packs work within each 128-bit half, so gather the low
+        /// quarter of each half.
+        inline void storeBytes(std::uint8_t *p, Vec packed) {
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(p),
+                             _mm256_castsi256_si128(
+                                 _mm256_permute4x64_epi64(packed, 0x08)));
+        }
+        /// Stores with unsigned saturation to 8 bits.
+        inline void narrow(std::uint8_t *p, Vec v) {
+            storeBytes(p, _mm256_packus_epi16(v, v));
+        }
+        /// Stores a mask of all-zero/all-one lanes as 0/255 bytes.
+        inline void narrowMask(std::uint8_t *p, Vec v) {
+            storeBytes(p, _mm256_packs_epi16(v, v));
+        }
+        inline Vec splat(int x) {
+            return _mm256_set1_epi16(static_cast<short>(x));
+        }
+        inline Vec add(Vec a, Vec b) { return _mm256_add_epi16(a, b); }
+        inline Vec sub(Vec a, Vec b) { return _mm256_sub_epi16(a, b); }
+        inline Vec mul(Vec a, Vec b) { return _mm256_mullo_epi16(a, b); }
+        inline Vec shiftRight4(Vec a) { return _mm256_srli_epi16(a, 4); }
+        inline Vec minimum(Vec a, Vec b) { return _mm256_min_epi16(a, b); }
+        inline Vec greater(Vec a, Vec b) { return _mm256_cmpgt_epi16(a, b); }
+#elif defined(OSVR_FUSED_EDGE_SSE2)
+        /// 8 lanes of 16-bit integers.
+        using Vec = __m128i;
+        static const int VEC_LANES = 8;
+        inline Vec widen(std::uint8_t const *p) {
+            return _mm_unpacklo_epi8(
+                _mm_loadl_epi64(reinterpret_cast<__m128i const *>(p)),
+                _mm_setzero_si128());
+        }
+        inline Vec load(std::uint16_t const *p) {
+            return _mm_loadu_si128(reinterpret_cast<__m128i const *>(p));
+        }
+        inline void store(std::uint16_t *p, Vec v) {
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(p), v);
+        }
+        /// Stores with unsigned saturation to 8 bits.
+        inline void narrow(std::uint8_t *p, Vec v) {
+            _mm_storel_epi64(reinterpret_cast<__m128i *>(p),
+                             _mm_packus_epi16(v, v));
+        }
+        /// Stores a mask of all-zero/all-one lanes as 0/255 bytes.
+        inline void narrowMask(std::uint8_t *p, Vec v) {
+            _mm_storel_epi64(reinterpret_cast<__m128i *>(p),
+                             _mm_packs_epi16(v, v));
+        }
+        inline Vec splat(int x) {
+            return _mm_set1_epi16(static_cast<short>(x));
+        }
+        inline Vec add(Vec a, Vec b) { return _mm_add_epi16(a, b); }
+        inline Vec sub(Vec a, Vec b) { return _mm_sub_epi16(a, b); }
+        inline Vec mul(Vec a, Vec b) { return _mm_mullo_epi16(a, b); }
+        inline Vec shiftRight4(Vec a) { return _mm_srli_epi16(a, 4); }
+        inline Vec minimum(Vec a, Vec b) { return _mm_min_epi16(a, b); }
+        inline Vec greater(Vec a, Vec b) { return _mm_cmpgt_epi16(a, b); }
+#endif
+
+        /// Rows called "padded" have one extra element on each side, filled
+        /// by padRow() following OpenCV's default border mode
+        /// (BORDER_REFLECT_101), so element i + 1 holds pixel i.
+        template <typename T> inline void padRow(T *row, int width) {
+            row[0] = row[2];
+            row[width + 1] = row[width - 1];
+        }
+
+        inline std::uint8_t saturate(int x) {
+            return static_cast<std::uint8_t>(std::min(std::max(x, 0), 255));
+        }
+
+        /// Vertical pass of the 3x3 Gaussian: weights 1 2 1.
+        inline void columnSums(std::uint8_t const *up, std::uint8_t const *mid,
+                               std::uint8_t const *down, std::uint16_t *out,
+                               int width) {
+            int i = 0;
+#ifdef OSVR_FUSED_EDGE_SIMD
+            for (; i + VEC_LANES <= width; i += VEC_LANES) {
+                auto m = widen(mid + i);
+                store(out + i,
+                      add(add(widen(up + i), widen(down + i)), add(m, m)));
+            }
+#endif
+            for (; i < width; ++i) {
+                out[i] =
+                    static_cast<std::uint16_t>(up[i] + 2 * mid[i] + down[i]);
+            }
+        }
+
+        /// Horizontal pass of the 3x3 Gaussian, from padded column sums,
+        /// normalizing with the same round-half-up as OpenCV's fixed-point
+        /// 8-bit path.
+        inline void gaussianRow(std::uint16_t const *sums, std::uint8_t *out,
+                                int width) {
+            int i = 0;
+#ifdef OSVR_FUSED_EDGE_SIMD
+            auto const rounding = splat(8);
+            for (; i + VEC_LANES <= width; i += VEC_LANES) {
+                auto m = load(sums + i + 1);
+                auto total = add(add(load(sums + i), load(sums + i + 2)),
+                                 add(add(m, m), rounding));
+                narrow(out + i, shiftRight4(total));
+            }
+#endif
+            for (; i < width; ++i) {
+                out[i] = static_cast<std::uint8_t>(
+                    (sums[i] + 2 * sums[i + 1] + sums[i + 2] + 8) >> 4);
+            }
+        }
+
+        /// gaussianRow() followed by a binary threshold (strictly greater
+        /// than, to 255) - threshold must be in [-1, 255].
+        inline void gaussianThresholdRow(std::uint16_t const *sums,
+                                         std::uint8_t *out, int width,
+                                         int threshold) {
+            int i = 0;
+#ifdef OSVR_FUSED_EDGE_SIMD
+            auto const rounding = splat(8);
+            auto const thresh = splat(threshold);
+            for (; i + VEC_LANES <= width; i += VEC_LANES) {
+                auto m = load(sums + i + 1);
+                auto total = add(add(load(sums + i), load(sums + i + 2)),
+                                 add(add(m, m), rounding));
+                narrowMask(out + i, greater(shiftRight4(total), thresh));
+            }
+#endif
+            for (; i < width; ++i) {
+                auto blurred =
+                    (sums[i] + 2 * sums[i + 1] + sums[i + 2] + 8) >> 4;
+                out[i] = blurred > threshold ? 255 : 0;
+            }
+        }
+
+        /// Binary threshold alone, for when the post-blur is disabled.
+        inline void thresholdRow(std::uint8_t const *in, std::uint8_t *out,
+                                 int width, int threshold) {
+            int i = 0;
+#ifdef OSVR_FUSED_EDGE_SIMD
+            auto const thresh = splat(threshold);
+            for (; i + VEC_LANES <= width; i += VEC_LANES) {
+                narrowMask(out + i, greater(widen(in + i), thresh));
+            }
+#endif
+            for (; i < width; ++i) {
+                out[i] = in[i] > threshold ? 255 : 0;
+            }
+        }
+
+        /// cv::Laplacian with ksize 3 is a filter2D with the kernel
+        /// scale * [2 0 2; 0 -8 0; 2 0 2], saturated to 8 bits. Padded
+        /// inputs.
+        inline void laplacian3Row(std::uint8_t const *up,
+                                  std::uint8_t const *mid,
+                                  std::uint8_t const *down, std::uint8_t *out,
+                                  int width, int scale) {
+            int i = 0;
+#ifdef OSVR_FUSED_EDGE_SIMD
+            auto const cornerWeight = splat(2 * scale);
+            auto const centerWeight = splat(8 * scale);
+            for (; i + VEC_LANES <= width; i += VEC_LANES) {
+                auto corners = add(add(widen(up + i), widen(up + i + 2)),
+                                   add(widen(down + i), widen(down + i + 2)));
+                narrow(out + i, sub(mul(corners, cornerWeight),
+                                    mul(widen(mid + i + 1), centerWeight)));
+            }
+#endif
+            for (; i < width; ++i) {
+                auto corners = up[i] + up[i + 2] + down[i] + down[i + 2];
+                out[i] = saturate(2 * scale * corners - 8 * scale * mid[i + 1]);
+            }
+        }
+
+        /// cv::Laplacian with ksize 1 uses the kernel
+        /// scale * [0 1 0; 1 -4 1; 0 1 0]. Padded inputs.
+        inline void laplacian1Row(std::uint8_t const *up,
+                                  std::uint8_t const *mid,
+                                  std::uint8_t const *down, std::uint8_t *out,
+                                  int width, int scale) {
+            int i = 0;
+#ifdef OSVR_FUSED_EDGE_SIMD
+            auto const edgeWeight = splat(scale);
+            auto const centerWeight = splat(4 * scale);
+            for (; i + VEC_LANES <= width; i += VEC_LANES) {
+                auto sides = add(add(widen(up + i + 1), widen(down + i + 1)),
+                                 add(widen(mid + i), widen(mid + i + 2)));
+                narrow(out + i, sub(mul(sides, edgeWeight),
+                                    mul(widen(mid + i + 1), centerWeight)));
+            }
+#endif
+            for (; i < width; ++i) {
+                auto sides = up[i + 1] + down[i + 1] + mid[i] + mid[i + 2];
+                out[i] = saturate(scale * sides - 4 * scale * mid[i + 1]);
+            }
+        }
+
+        /// 3x3 erosion (minimum), from padded inputs. cv::erode ignores
+        /// pixels outside the image, but the reflected padding only repeats
+        /// pixels already in each window, so the result is the same.
+        inline void erodeRow(std::uint8_t const *up, std::uint8_t const *mid,
+                             std::uint8_t const *down, std::uint8_t *out,
+                             int width) {
+            int i = 0;
+#ifdef OSVR_FUSED_EDGE_SIMD
+            for (; i + VEC_LANES <= width; i += VEC_LANES) {
+                auto result = widen(mid + i + 1);
+                for (int dx = 0; dx < 3; ++dx) {
+                    auto column = minimum(widen(up + i + dx),
+                                          widen(mid + i + dx));
+                    result = minimum(result,
+                                     minimum(column, widen(down + i + dx)));
+                }
+                narrow(out + i, result);
+            }
+#endif
+            for (; i < width; ++i) {
+                auto result = mid[i + 1];
+                for (int dx = 0; dx < 3; ++dx) {
+                    auto column = std::min(up[i + dx], mid[i + dx]);
+                    result = std::min(result, std::min(column, down[i + dx]));
+                }
+                out[i] = result;
+            }
+        }
+
+        /// Row index with OpenCV's default border (BORDER_REFLECT_101).
+        inline int reflectRow(int row, int rows) {
+            return row < 0 ? -row : (row >= rows ? 2 * rows - 2 - row : row);
+        }
+    } // namespace
+
+    static bool isSupported(EdgeHoleParams const &params) {
+        auto scale = params.laplacianScale;
+        bool scaleOK = scale == std::floor(scale) && scale >= 1 &&
+                       scale <= MAX_LAPLACIAN_SCALE;
+        return params.preEdgeDetectionBlurSize == 3 &&
+               (params.laplacianKSize == 1 || params.laplacianKSize == 3) &&
+               scaleOK &&
+               (!params.edgeDetectErosion || params.erosionKernelValue != 0) &&
+               (!params.postEdgeDetectionBlur ||
+                params.postEdgeDetectionBlurSize == 3);
+    }
+
+    FusedEdgeDetector::FusedEdgeDetector(EdgeHoleParams const &params)
+        : supported_(isSupported(params)),
+          laplacianKSize_(params.laplacianKSize),
+          laplacianScale_(static_cast<int>(params.laplacianScale)),
+          erode_(params.edgeDetectErosion),
+          postBlur_(params.postEdgeDetectionBlur),
+          /// cv::threshold makes anything below 0 or at least 255 uniform,
+          /// as does this clamping for our comparisons.
+          threshold_(std::min(std::max(params.postEdgeDetectionBlurThreshold,
+                                       -1),
+                              255)) {}
+
+    bool FusedEdgeDetector::supports(cv::Mat const &gray) const {
+        return supported_ && gray.type() == CV_8UC1 && gray.rows >= 2 &&
+               gray.cols >= 2;
+    }
+
+    void FusedEdgeDetector::operator()(cv::Mat const &gray, cv::Mat &edge,
+                                       cv::Mat &edgeBinary) {
+        edge.create(gray.size(), CV_8UC1);
+        edgeBinary.create(gray.size(), CV_8UC1);
+        ensureRowBuffers(gray.cols);
+
+        auto const rows = gray.rows;
+        /// Each stage runs a row behind the one feeding it, since it needs
+        /// the row below.
+        auto const edgeLag = erode_ ? 2 : 1;
+        auto const binaryLag = edgeLag + 1;
+        for (int step = 0; step < rows + binaryLag; ++step) {
+            if (step < rows) {
+                blurRow(gray, step, ringRow(blurredRows_, step));
+            }
+
+            auto lapRow = step - 1;
+            if (lapRow >= 0 && lapRow < rows) {
+                auto out = erode_ ? ringRow(laplacianRows_, lapRow) + 1
+                                  : edge.ptr<std::uint8_t>(lapRow);
+                laplacianRow(
+                    ringRow(blurredRows_, reflectRow(lapRow - 1, rows)),
+                    ringRow(blurredRows_, lapRow),
+                    ringRow(blurredRows_, reflectRow(lapRow + 1, rows)), out);
+                if (erode_) {
+                    padRow(ringRow(laplacianRows_, lapRow), width_);
+                }
+            }
+
+            auto erodedRow = step - 2;
+            if (erode_ && erodedRow >= 0 && erodedRow < rows) {
+                erodeRow(
+                    ringRow(laplacianRows_, reflectRow(erodedRow - 1, rows)),
+                    ringRow(laplacianRows_, erodedRow),
+                    ringRow(laplacianRows_, reflectRow(erodedRow + 1, rows)),
+                    edge.ptr<std::uint8_t>(erodedRow), width_);
+            }
+
+            auto binaryRow = step - binaryLag;
+            if (binaryRow >= 0) {
+                auto out = edgeBinary.ptr<std::uint8_t>(binaryRow);
+                if (postBlur_) {
+                    blurThresholdRow(edge, binaryRow, out);
+                } else {
+                    thresholdRow(edge.ptr<std::uint8_t>(binaryRow), out,
+                                 width_, threshold_);
+                }
+            }
+        }
+    }
+
+    void FusedEdgeDetector::ensureRowBuffers(int width) {
+        if (width == width_) {
+            return;
+        }
+        width_ = width;
+        auto const padded = static_cast<std::size_t>(width + 2);
+        blurredRows_.assign(padded * 3, 0);
+        laplacianRows_.assign(erode_ ? padded * 3 : 0, 0);
+        columnSums_.assign(padded, 0);
+    }
+
+    void FusedEdgeDetector::blurRow(cv::Mat const &gray, int row,
+                                    std::uint8_t *out) {
+        auto const rows = gray.rows;
+        columnSums(gray.ptr<std::uint8_t>(reflectRow(row - 1, rows)),
+                   gray.ptr<std::uint8_t>(row),
+                   gray.ptr<std::uint8_t>(reflectRow(row + 1, rows)),
+                   columnSums_.data() + 1, width_);
+        padRow(columnSums_.data(), width_);
+        gaussianRow(columnSums_.data(), out + 1, width_);
+        padRow(out, width_);
+    }
+
+    void FusedEdgeDetector::blurThresholdRow(cv::Mat const &edge, int row,
+                                             std::uint8_t *out) {
+        auto const rows = edge.rows;
+        columnSums(edge.ptr<std::uint8_t>(reflectRow(row - 1, rows)),
+                   edge.ptr<std::uint8_t>(row),
+                   edge.ptr<std::uint8_t>(reflectRow(row + 1, rows)),
+                   columnSums_.data() + 1, width_);
+        padRow(columnSums_.data(), width_);
+        gaussianThresholdRow(columnSums_.data(), out, width_, threshold_);
+    }
+
+    void FusedEdgeDetector::laplacianRow(std::uint8_t const *up,
+                                         std::uint8_t const *mid,
+                                         std::uint8_t const *down,
+                                         std::uint8_t *out) const {
+        if (laplacianKSize_ == 3) {
+            laplacian3Row(up, mid, down, out, width_, laplacianScale_);
+        } else {
+            laplacian1Row(up, mid, down, out, width_, laplacianScale_);
+        }
+    }
+
+    std::uint8_t *FusedEdgeDetector::ringRow(std::vector<std::uint8_t> &ring,
+                                             int i) const {
+        return ring.data() + static_cast<std::size_t>(i % 3) * (width_ + 2);
+    }
+} // namespace vbtracker
+} // namespace osvr
@@ -0,0 +1,98 @@
+/** @file
+    @brief Header
+
+    @date 2017
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2017 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_FusedEdgeDetection_h_GUID_F7AD4F6B_1233_4757_9571_EB4475AD8EAA
+#define INCLUDED_FusedEdgeDetection_h_GUID_F7AD4F6B_1233_4757_9571_EB4475AD8EAA
+
+// Internal Includes
+#include "BlobParams.h"
+
+// Library/third-party includes
+#include <opencv2/core/core.hpp>
+
+// Standard includes
+#include <cstdint>
+#include <vector>
+
+namespace osvr {
+namespace vbtracker {
+    /// Produces the same edge image and binarized edge image as the
+    /// EdgeHoleBasedLedExtractor's sequence of OpenCV calls (Gaussian blur,
+    /// Laplacian, optional erosion, Gaussian blur, threshold), but in a single
+    /// pass down the image.
+    ///
+    /// Each stage keeps only the last three rows it produced, so the working
+    /// set stays in cache instead of streaming a full intermediate frame
+    /// through memory per stage. Rows are processed with SSE2 or AVX2 when
+    /// the compiler targets them, with a scalar fallback.
+    ///
+    /// Only the parameter combinations it reproduces bit-for-bit are
+    /// supported: check supports() and fall back to OpenCV otherwise.
+    class FusedEdgeDetector {
+      public:
+        explicit FusedEdgeDetector(EdgeHoleParams const &params);
+
+        /// Whether the parameters and the given input image (8-bit single
+        /// channel, at least 2x2) can be handled.
+        bool supports(cv::Mat const &gray) const;
+
+        /// Computes edge detection (after erosion, if enabled) into edge and
+        /// its binarized form into edgeBinary, (re)allocating them only if
+        /// needed.
+        void operator()(cv::Mat const &gray, cv::Mat &edge,
+                        cv::Mat &edgeBinary);
+
+      private:
+        /// Resizes the row buffers if the width changed.
+        void ensureRowBuffers(int width);
+        /// Pre-blur: input rows to a padded blurred row.
+        void blurRow(cv::Mat const &gray, int row, std::uint8_t *out);
+        /// Post-blur and threshold: edge rows to a binary row.
+        void blurThresholdRow(cv::Mat const &edge, int row,
+                              std::uint8_t *out);
+        /// Laplacian: three padded blurred rows to an edge row.
+        void laplacianRow(std::uint8_t const *up, std::uint8_t const *mid,
+                          std::uint8_t const *down, std::uint8_t *out) const;
+        /// Returns padded row buffer i (mod 3) from a ring of three.
+        std::uint8_t *ringRow(std::vector<std::uint8_t> &ring, int i) const;
+
+        bool supported_;
+        int laplacianKSize_;
+        int laplacianScale_;
+        bool erode_;
+        bool postBlur_;
+        int threshold_;
+
+        int width_ = 0;
+        /// Three padded rows each of blurred input and (if eroding) of
+        /// Laplacian output.
+        std::vector<std::uint8_t> blurredRows_;
+        std::vector<std::uint8_t> laplacianRows_;
+        /// Padded row of vertical sums for the separable blurs.
+        std::vector<std::uint16_t> columnSums_;
+    };
+} // namespace vbtracker
+} // namespace osvr
+
+#endif // INCLUDED_FusedEdgeDetection_h_GUID_F7AD4F6B_1233_4757_9571_EB4475AD8EAA
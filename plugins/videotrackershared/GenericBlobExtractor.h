@@ -33,6 +33,7 @@
 
 // Standard includes
 #include <memory>
+#include <vector>
 
 namespace osvr {
 namespace vbtracker {
@@ -49,6 +50,12 @@ namespace vbtracker {
         cv::Mat const &getDebugBlobImage();
 
         LedMeasurementVec const &extractBlobs(cv::Mat const &grayImage);
+        /// Like extractBlobs(), but only searches the given regions (in full
+        /// image coordinates, expected not to overlap) for blobs. Resulting
+        /// measurements are still in full image coordinates.
+        LedMeasurementVec const &
+        extractBlobsInRegions(cv::Mat const &grayImage,
+                              std::vector<cv::Rect> const &regions);
         LedMeasurementVec const &getLatestMeasurements() const {
             return latestMeasurements_;
         }
@@ -57,6 +64,10 @@ namespace vbtracker {
         virtual cv::Mat generateDebugThresholdImage_() const = 0;
         virtual cv::Mat generateDebugBlobImage_() const = 0;
         virtual LedMeasurementVec extractBlobs_() = 0;
+        /// The default implementation ignores the regions and searches the
+        /// whole image.
+        virtual LedMeasurementVec
+        extractBlobsInRegions_(std::vector<cv::Rect> const &regions);
         GenericBlobExtractor() = default;
 
       private:
@@ -49,13 +49,15 @@ namespace client {
 
     AnalysisClientContext::AnalysisClientContext(
         const char appId[], const char host[], vrpn_ConnectionPtr const &conn,
+        common::LocalReportDispatcherPtr const &localReports,
         common::ClientContextDeleter del)
         : ::OSVR_ClientContextObject(appId, del), m_mainConn(conn),
           m_ifaceMgr(m_pathTreeOwner, m_factory,
                      *static_cast<common::ClientContext *>(this)) {
 
-        /// Create all the remote handler factories.
-        populateRemoteHandlerFactory(m_factory, m_vrpnConns);
+        /// Create all the remote handler factories: where they can, they'll
+        /// subscribe to our server's devices directly.
+        populateRemoteHandlerFactory(m_factory, m_vrpnConns, localReports);
 
         m_vrpnConns.addConnection(m_mainConn, "localhost");
         m_vrpnConns.addConnection(m_mainConn, host);
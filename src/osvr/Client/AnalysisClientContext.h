@@ -32,6 +32,7 @@
 #include <osvr/Client/RemoteHandlerFactory.h>
 #include <osvr/Common/BaseDevicePtr.h>
 #include <osvr/Common/ClientContext.h>
+#include <osvr/Common/LocalReportDispatcher.h>
 #include <osvr/Common/PathTree.h>
 #include <osvr/Common/PathTreeOwner.h>
 #include <osvr/Common/SystemComponent_fwd.h>
@@ -49,9 +50,11 @@ namespace client {
 
     class AnalysisClientContext : public ::OSVR_ClientContextObject {
       public:
-        AnalysisClientContext(const char appId[], const char host[],
-                              vrpn_ConnectionPtr const &conn,
-                              common::ClientContextDeleter del);
+        AnalysisClientContext(
+            const char appId[], const char host[],
+            vrpn_ConnectionPtr const &conn,
+            common::LocalReportDispatcherPtr const &localReports,
+            common::ClientContextDeleter del);
         virtual ~AnalysisClientContext();
         EIGEN_MAKE_ALIGNED_OPERATOR_NEW
       private:
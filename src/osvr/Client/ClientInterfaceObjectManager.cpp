@@ -32,26 +32,30 @@
 #include <osvr/Common/ClientInterface.h>
 #include <osvr/Util/Verbosity.h>
 #include <osvr/Common/ResolveTreeNode.h>
+#include <osvr/Common/OriginalSource.h>
+#include <osvr/Common/PathElementTypes.h>
 
 // Library/third-party includes
 #include <boost/assert.hpp>
 
 // Standard includes
 #include <unordered_set>
+#include <vector>
 
 namespace osvr {
 namespace client {
     ClientInterfaceObjectManager::ClientInterfaceObjectManager(
         common::PathTreeOwner &tree, RemoteHandlerFactory &handlerFactory,
         common::ClientContext &ctx)
-        : m_pathTree(tree.get()), m_treeObserver(tree.makeObserver()),
-          m_factory(handlerFactory), m_ctx(&ctx) {
-        m_treeObserver->setEventCallback(
-            common::PathTreeEvents::AboutToUpdate,
-            [&](common::PathTree &) { m_interfaces.clearHandlers(); });
+        : m_pathTreeOwner(tree), m_pathTree(tree.get()),
+          m_treeObserver(tree.makeObserver()), m_factory(handlerFactory),
+          m_ctx(&ctx) {
+        /// Handlers copy what they need out of the tree when constructed, so
+        /// they can survive the tree being rebuilt: we only need to act once
+        /// the new tree is in place.
         m_treeObserver->setEventCallback(
             common::PathTreeEvents::AfterUpdate,
-            [&](common::PathTree &) { m_connectNeededCallbacks(); });
+            [&](common::PathTree &) { m_handleTreeUpdate(); });
     }
 
     void ClientInterfaceObjectManager::addInterface(
@@ -75,12 +79,32 @@ namespace client {
         m_interfaces.updateHandlers();
     }
 
+    /// @brief Summarizes a resolved source: two sources with the same summary
+    /// produce equivalent handlers.
+    static inline Json::Value
+    summarizeSource(common::OriginalSource const &source) {
+        Json::Value ret(Json::objectValue);
+        auto const &devElt = source.getDeviceElement();
+        ret["device"] = devElt.getFullDeviceName();
+        ret["descriptor"] = devElt.getDescriptor();
+        ret["interface"] = source.getInterfaceName();
+        auto sensor = source.getSensorNumber();
+        if (sensor) {
+            ret["sensor"] = *sensor;
+        }
+        if (source.hasTransform()) {
+            ret["transform"] = source.getTransformJson();
+        }
+        return ret;
+    }
+
     bool ClientInterfaceObjectManager::m_connectCallbacksOnPath(
         std::string const &path, bool verboseFailure) {
         /// Start by removing handler from interface tree and handler container
         /// for this path, if found. Ensures that if we early-out (fail to set
         /// up a handler) we don't have a leftover one still active.
         m_interfaces.eraseHandlerForPath(path);
+        m_handlerSources.erase(path);
 
         auto source = common::resolveTreeNode(m_pathTree, path);
         if (!source.is_initialized()) {
@@ -100,6 +124,7 @@ namespace client {
             BOOST_ASSERT_MSG(
                 !oldHandler,
                 "We removed the old handler before so it should be null now");
+            m_handlerSources[path] = summarizeSource(*source);
             return true;
         }
 
@@ -112,6 +137,7 @@ namespace client {
     void ClientInterfaceObjectManager::m_removeCallbacksOnPath(
         std::string const &path) {
         m_interfaces.eraseHandlerForPath(path);
+        m_handlerSources.erase(path);
     }
 
     void ClientInterfaceObjectManager::m_connectNeededCallbacks() {
@@ -132,6 +158,45 @@ namespace client {
                          << " unconnected paths successfully";
     }
 
+    void ClientInterfaceObjectManager::m_handleTreeUpdate() {
+        auto const &diff = m_pathTreeOwner.getLastDiff();
+        logger()->info() << "Path tree updated: " << diff.added.size()
+                         << " nodes added, " << diff.removed.size()
+                         << " removed, " << diff.changed.size() << " changed";
+
+        /// Collect first: we can't modify handlers while traversing them.
+        std::vector<std::string> connectedPaths;
+        m_interfaces.visitPathsWithHandlers([&](std::string const &path) {
+            connectedPaths.push_back(path);
+        });
+
+        auto rebuilt = size_t{0};
+        for (auto const &path : connectedPaths) {
+            auto source = common::resolveTreeNode(m_pathTree, path);
+            if (!source.is_initialized()) {
+                logger()->info() << "Source for " << path
+                                 << " no longer resolves, removing handler";
+                m_removeCallbacksOnPath(path);
+                continue;
+            }
+            auto it = m_handlerSources.find(path);
+            if (it != end(m_handlerSources) &&
+                it->second == summarizeSource(*source)) {
+                /// Unchanged - keep the existing handler and its connection.
+                continue;
+            }
+            m_connectCallbacksOnPath(path);
+            ++rebuilt;
+        }
+        if (rebuilt > 0) {
+            logger()->info() << "Rebuilt " << rebuilt << " of "
+                             << connectedPaths.size()
+                             << " handlers whose source changed";
+        }
+
+        m_connectNeededCallbacks();
+    }
+
     util::log::LoggerPtr const &ClientInterfaceObjectManager::logger() const {
         return m_ctx->logger();
     }
@@ -48,9 +48,9 @@ namespace client {
         return ret;
     }
 
-    common::ClientContext *
-    createAnalysisClientContext(const char appId[], const char host[],
-                                vrpn_ConnectionPtr const &conn) {
+    common::ClientContext *createAnalysisClientContext(
+        const char appId[], const char host[], vrpn_ConnectionPtr const &conn,
+        common::LocalReportDispatcherPtr const &localReports) {
         common::ClientContext *ret = nullptr;
         if (!appId || !appId[0]) {
             OSVR_DEV_VERBOSE("Could not create analysis client context - null "
@@ -70,7 +70,8 @@ namespace client {
             return ret;
         }
 
-        ret = common::makeContext<AnalysisClientContext>(appId, host, conn);
+        ret = common::makeContext<AnalysisClientContext>(appId, host, conn,
+                                                         localReports);
         return ret;
     }
 
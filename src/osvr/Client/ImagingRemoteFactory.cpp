@@ -36,12 +36,13 @@
 #include <osvr/Util/Verbosity.h>
 #include <osvr/Common/CreateDevice.h>
 #include <osvr/Common/ImagingComponent.h>
+#include <osvr/Common/ImageLeaseManager.h>
 
 // Library/third-party includes
 // - none
 
 // Standard includes
-// - none
+#include <cstdint>
 
 namespace osvr {
 namespace client {
@@ -51,11 +52,13 @@ namespace client {
         ImagingRemoteHandler(vrpn_ConnectionPtr const &conn,
                              std::string const &deviceName,
                              boost::optional<OSVR_ChannelCount> sensor,
-                             common::InterfaceList &ifaces)
+                             common::InterfaceList &ifaces,
+                             common::ImageLeaseManager &leases)
             : m_dev(common::createClientDevice(deviceName, conn)),
               m_internals(ifaces), m_all(!sensor.is_initialized()),
-              m_sensor(sensor) {
+              m_sensor(sensor), m_leases(leases) {
             auto imaging = common::ImagingComponent::create();
+            m_imaging = imaging.get();
             m_dev->addComponent(imaging);
             imaging->registerImageHandler(
                 [&](common::ImageData const &data,
@@ -73,7 +76,13 @@ namespace client {
             /// @todo do we need to unregister?
         }
 
-        virtual void update() { m_dev->update(); }
+        virtual void update() {
+            m_dev->update();
+            auto dropped = m_imaging->getDroppedFrameCount();
+            m_leases.recordDropped(dropped - m_dropped);
+            m_dropped = dropped;
+            m_leases.update(util::time::getNow());
+        }
 
       private:
         void m_handleImage(common::ImageData const &data,
@@ -83,19 +92,23 @@ namespace client {
                 return;
             }
 
+            /// Frames from shared memory pin a ring buffer entry while the
+            /// client holds them, subject to the context's lease policy.
+            auto buffer = m_leases.lease(data, util::time::getNow());
+
             OSVR_ImagingReport report;
             report.sensor = data.sensor;
             report.state.metadata = data.metadata;
-            report.state.data = data.buffer.get();
+            report.state.data = buffer.get();
 
             m_internals.forEachInterface(
-                [&timestamp, &report, &data](common::ClientInterface &iface) {
+                [&timestamp, &report, &buffer](common::ClientInterface &iface) {
                     // Note: not setting state here! we don't store image state.
                     auto n = iface.getNumCallbacksFor(report);
                     for (std::size_t i = 0; i < n; ++i) {
                         // Acquire a reference for each callback we're going to
                         // call.
-                        iface.getContext().acquireObject(data.buffer);
+                        iface.getContext().acquireObject(buffer);
                     }
                     iface.triggerCallbacks(timestamp, report);
                 });
@@ -105,6 +118,11 @@ namespace client {
         RemoteHandlerInternals m_internals;
         bool m_all;
         boost::optional<OSVR_ChannelCount> m_sensor;
+        /// @brief Owned by m_dev.
+        common::ImagingComponent *m_imaging;
+        common::ImageLeaseManager &m_leases;
+        /// @brief Dropped frame count already passed on to m_leases.
+        std::uint64_t m_dropped = 0;
     };
 
     ImagingRemoteFactory::ImagingRemoteFactory(
@@ -113,7 +131,7 @@ namespace client {
 
     shared_ptr<RemoteHandler> ImagingRemoteFactory::
     operator()(common::OriginalSource const &source,
-               common::InterfaceList &ifaces, common::ClientContext &) {
+               common::InterfaceList &ifaces, common::ClientContext &ctx) {
 
         shared_ptr<RemoteHandler> ret;
 
@@ -127,7 +145,8 @@ namespace client {
         /// @todo find out why make_shared causes a crash here
         ret.reset(new ImagingRemoteHandler(
             m_conns.getConnection(devElt), devElt.getFullDeviceName(),
-            source.getSensorNumberAsChannelCount(), ifaces));
+            source.getSensorNumberAsChannelCount(), ifaces,
+            ctx.getImageLeaseManager()));
         return ret;
     }
 
@@ -36,8 +36,11 @@
 
 // Library/third-party includes
 #include <json/value.h>
+#include <vrpn_Connection.h>
 
 // Standard includes
+#include <chrono>
+#include <mutex>
 #include <thread>
 #include <unordered_set>
 
@@ -82,6 +85,9 @@ namespace client {
     static const std::chrono::milliseconds STARTUP_CONNECT_TIMEOUT(200);
     static const std::chrono::milliseconds STARTUP_TREE_TIMEOUT(1000);
     static const std::chrono::milliseconds STARTUP_LOOP_SLEEP(1);
+    /// @brief How many times the update thread checks for traffic while
+    /// waiting between updates.
+    static const int UPDATE_WAIT_POLLS = 4;
 
     PureClientContext::PureClientContext(const char appId[], const char host[],
                                          common::ClientContextDeleter del)
@@ -181,6 +187,22 @@ namespace client {
         m_ifaceMgr.updateHandlers();
     }
 
+    void
+    PureClientContext::m_waitForUpdate(std::chrono::microseconds maxWait) {
+        /// VRPN doesn't expose its sockets for us to wait on, and waiting
+        /// inside mainloop would mean holding the update mutex (which the
+        /// handlers it runs need) for the whole wait, starving app threads.
+        /// So sleep unlocked, and take the lock only to handle whatever has
+        /// arrived, with a mainloop that doesn't wait.
+        auto const pollInterval = maxWait / UPDATE_WAIT_POLLS;
+        for (int i = 0; i < UPDATE_WAIT_POLLS; ++i) {
+            std::this_thread::sleep_for(pollInterval);
+            struct timeval noWait = {0, 0};
+            std::lock_guard<UpdateMutex> lock(getUpdateMutex());
+            m_mainConn->mainloop(&noWait);
+        }
+    }
+
     void PureClientContext::m_sendRoute(std::string const &route) {
         m_systemComponent->sendClientRouteUpdate(route);
         m_update();
@@ -59,6 +59,9 @@ namespace client {
         EIGEN_MAKE_ALIGNED_OPERATOR_NEW
       private:
         void m_update() override;
+        /// @brief Polls the main connection for traffic while waiting,
+        /// holding the update mutex only while handling it.
+        void m_waitForUpdate(std::chrono::microseconds maxWait) override;
         void m_sendRoute(std::string const &route) override;
 
         /// @brief Called with each new interface object before it is returned
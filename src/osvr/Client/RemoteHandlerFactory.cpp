@@ -42,10 +42,11 @@
 
 namespace osvr {
 namespace client {
-    void populateRemoteHandlerFactory(RemoteHandlerFactory &factory,
-                                      VRPNConnectionCollection const &conns) {
+    void populateRemoteHandlerFactory(
+        RemoteHandlerFactory &factory, VRPNConnectionCollection const &conns,
+        common::LocalReportDispatcherPtr const &localReports) {
         /// Register all the factories.
-        TrackerRemoteFactory(conns).registerWith(factory);
+        TrackerRemoteFactory(conns, localReports).registerWith(factory);
         AnalogRemoteFactory(conns).registerWith(factory);
         ButtonRemoteFactory(conns).registerWith(factory);
         EyeTrackerRemoteFactory(conns).registerWith(factory);
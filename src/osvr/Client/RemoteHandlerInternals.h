@@ -28,6 +28,7 @@
 // Internal Includes
 #include <osvr/Common/InterfaceList.h>
 #include <osvr/Common/ClientInterface.h>
+#include <osvr/Util/TimeValue.h>
 
 // Library/third-party includes
 // - none
@@ -50,7 +51,8 @@ namespace client {
         // non-assignable
         RemoteHandlerInternals &operator=(RemoteHandlerInternals &) = delete;
 
-        /// @brief Set state and call callbacks for a report type.
+        /// @brief Set state, queue the report if the interface asked for
+        /// that, and call callbacks for a report type.
         template <typename ReportType>
         void setStateAndTriggerCallbacks(const OSVR_TimeValue &timestamp,
                                          ReportType const &report) {
@@ -62,10 +64,21 @@ namespace client {
             forEachInterface(
                 [&timestamp, &report](common::ClientInterface &iface) {
                     iface.setState(timestamp, report);
+                    iface.queueReport(timestamp, report);
                     iface.triggerCallbacks(timestamp, report);
                 });
         }
 
+        /// @brief Record the arrival, now, of a report with the given
+        /// timestamp in the latency statistics of every interface. Call once
+        /// per incoming message, not once per report type derived from it.
+        void recordReportLatency(const OSVR_TimeValue &timestamp) {
+            auto const now = util::time::getNow();
+            forEachInterface([&](common::ClientInterface &iface) {
+                iface.getLatencyStats().recordReport(timestamp, now);
+            });
+        }
+
         /// @brief Do something with every client interface object, if the above
         /// options don't suit your needs.
         template <typename F> void forEachInterface(F &&f) {
@@ -30,8 +30,10 @@
 #include <osvr/Client/InterfaceTree.h>
 #include <osvr/Common/ClientInterface.h>
 #include <osvr/Common/JSONTransformVisitor.h>
+#include <osvr/Common/LocalReportDispatcher.h>
 #include <osvr/Common/OriginalSource.h>
 #include <osvr/Common/PathTreeFull.h>
+#include <osvr/Common/RigidTransform.h>
 #include <osvr/Common/Tracing.h>
 #include <osvr/Common/TrackerSensorInfo.h>
 #include <osvr/Common/Transform.h>
@@ -50,7 +52,8 @@
 #include <vrpn_Tracker.h>
 
 // Standard includes
-// - none
+#include <cstdint>
+#include <vector>
 
 namespace ei = osvr::util::eigen_interop;
 
@@ -92,7 +95,36 @@ namespace client {
             OSVR_DEV_VERBOSE("Constructed a TrackerHandler for "
                              << src << " sensor " << m_sensor.get_value_or(-1));
         }
+
+        /// @brief Constructor for a handler subscribing to a tracker in this
+        /// process (when running in an analysis plugin), skipping VRPN.
+        VRPNTrackerHandler(common::LocalDeviceReports &local, const char *src,
+                           Options const &options,
+                           common::TrackerSensorInfo const &info,
+                           common::Transform const &t,
+                           boost::optional<int> sensor,
+                           common::InterfaceList &ifaces,
+                           common::ClientContext &ctx)
+            : m_transform(t), m_ctx(ctx), m_internals(ifaces), m_opts(options),
+              m_info(info), m_sensor(sensor) {
+            if (m_info.reportsPosition || m_info.reportsOrientation) {
+                m_subscribeLocal<OSVR_PoseReport>(local);
+            }
+            if (m_info.reportsLinearVelocity || m_info.reportsAngularVelocity) {
+                m_subscribeLocal<OSVR_VelocityReport>(local);
+            }
+            if (m_info.reportsLinearAcceleration ||
+                m_info.reportsAngularAcceleration) {
+                m_subscribeLocal<OSVR_AccelerationReport>(local);
+            }
+            OSVR_DEV_VERBOSE("Constructed an in-process TrackerHandler for "
+                             << src << " sensor " << m_sensor.get_value_or(-1));
+        }
+
         virtual ~VRPNTrackerHandler() {
+            if (!m_remote) {
+                return;
+            }
             if (m_info.reportsPosition || m_info.reportsOrientation) {
                 m_remote->unregister_change_handler(this,
                                                     &VRPNTrackerHandler::handle,
@@ -119,6 +151,20 @@ namespace client {
             return ret;
         }
 
+        /// @brief Brings the cached composition of our route's transform and
+        /// the room to world transform up to date, if the latter changed.
+        /// (Route changes construct a new handler.)
+        void updateCachedTransform() {
+            auto generation = m_ctx.getRoomToWorldTransformGeneration();
+            if (m_haveCachedTransform && generation == m_cachedGeneration) {
+                return;
+            }
+            m_cachedTransform = getCurrentTransform();
+            m_cachedIsRigid = m_cachedRigidTransform.assign(m_cachedTransform);
+            m_cachedGeneration = generation;
+            m_haveCachedTransform = true;
+        }
+
         static void VRPN_CALLBACK handle(void *userdata, vrpn_TRACKERCB info) {
             auto self = static_cast<VRPNTrackerHandler *>(userdata);
             self->m_handle(info);
@@ -133,21 +179,54 @@ namespace client {
             auto self = static_cast<VRPNTrackerHandler *>(userdata);
             self->m_handle(info);
         }
-        virtual void update() { m_remote->mainloop(); }
+        virtual void update() {
+            if (m_remote) {
+                m_remote->mainloop();
+            }
+        }
 
       private:
-        /// Pass pose messages on to the client
+        /// @brief Subscribes to in-process reports of the given type,
+        /// filtering by sensor the way VRPN does for us otherwise.
+        template <typename ReportType>
+        void m_subscribeLocal(common::LocalDeviceReports &local) {
+            m_localSubscriptions.push_back(local.subscribe<ReportType>(
+                [&](util::time::TimeValue const &timestamp,
+                    ReportType const &report) {
+                    if (m_sensor && *m_sensor != report.sensor) {
+                        return;
+                    }
+                    m_handle(timestamp, report);
+                }));
+        }
+
         void m_handle(vrpn_TRACKERCB const &info) {
-            common::tracing::markNewTrackerData();
-            OSVR_PoseReport report;
-            report.sensor = info.sensor;
             OSVR_TimeValue timestamp;
             osvrStructTimevalToTimeValue(&timestamp, &(info.msg_time));
+            OSVR_PoseReport report;
+            report.sensor = info.sensor;
             osvrQuatFromQuatlib(&(report.pose.rotation), info.quat);
             osvrVec3FromQuatlib(&(report.pose.translation), info.pos);
-            auto xform = getCurrentTransform();
-            ei::map(report.pose) =
-                xform.transform(ei::map(report.pose).matrix());
+            m_handle(timestamp, report);
+        }
+
+        /// Pass pose messages on to the client
+        void m_handle(OSVR_TimeValue const &timestamp,
+                      OSVR_PoseReport const &deviceReport) {
+            common::tracing::markNewTrackerData();
+            m_internals.recordReportLatency(timestamp);
+            OSVR_PoseReport report = deviceReport;
+            updateCachedTransform();
+            if (m_cachedIsRigid) {
+                Eigen::Quaterniond rot = ei::map(report.pose.rotation);
+                Eigen::Vector3d xlate = ei::map(report.pose.translation);
+                m_cachedRigidTransform.transformPose(rot, xlate);
+                ei::map(report.pose.rotation) = rot;
+                ei::map(report.pose.translation) = xlate;
+            } else {
+                ei::map(report.pose) = m_cachedTransform.transform(
+                    ei::map(report.pose).matrix());
+            }
 
             if (m_opts.reportPose) {
                 m_internals.setStateAndTriggerCallbacks(timestamp, report);
@@ -155,7 +234,7 @@ namespace client {
 
             if (m_opts.reportPosition) {
                 OSVR_PositionReport positionReport;
-                positionReport.sensor = info.sensor;
+                positionReport.sensor = report.sensor;
                 positionReport.xyz = report.pose.translation;
 
                 m_internals.setStateAndTriggerCallbacks(timestamp,
@@ -164,36 +243,49 @@ namespace client {
 
             if (m_opts.reportOrientation) {
                 OSVR_OrientationReport oriReport;
-                oriReport.sensor = info.sensor;
+                oriReport.sensor = report.sensor;
                 oriReport.rotation = report.pose.rotation;
 
                 m_internals.setStateAndTriggerCallbacks(timestamp, oriReport);
             }
         }
 
-        /// Pass velocity messages on to the client
         void m_handle(vrpn_TRACKERVELCB const &info) {
-            /// @todo should we be marking a trace event here?
-            // common::tracing::markNewTrackerData();
-
             OSVR_TimeValue timestamp;
             osvrStructTimevalToTimeValue(&timestamp, &(info.msg_time));
+            OSVR_VelocityReport report;
+            report.sensor = info.sensor;
+            report.state.linearVelocityValid = true;
+            osvrVec3FromQuatlib(&(report.state.linearVelocity), info.vel);
+            report.state.angularVelocityValid = true;
+            osvrQuatFromQuatlib(
+                &(report.state.angularVelocity.incrementalRotation),
+                info.vel_quat);
+            report.state.angularVelocity.dt = info.vel_quat_dt;
+            m_handle(timestamp, report);
+        }
+
+        /// Pass velocity messages on to the client
+        void m_handle(OSVR_TimeValue const &timestamp,
+                      OSVR_VelocityReport const &deviceReport) {
+            /// @todo should we be marking a trace event here?
+            // common::tracing::markNewTrackerData();
 
             OSVR_VelocityReport overallReport;
-            overallReport.sensor = info.sensor;
-            auto xform = getCurrentTransform();
+            overallReport.sensor = deviceReport.sensor;
+            updateCachedTransform();
 
             overallReport.state.linearVelocityValid =
                 m_info.reportsLinearVelocity;
             if (m_info.reportsLinearVelocity) {
-                OSVR_LinearVelocityState vel;
-                osvrVec3FromQuatlib(&(vel), info.vel);
+                OSVR_LinearVelocityState vel =
+                    deviceReport.state.linearVelocity;
 
-                ei::map(vel) = xform.transformDerivative(ei::map(vel));
+                ei::map(vel) = m_transformDerivative(ei::map(vel));
 
                 overallReport.state.linearVelocity = vel;
                 OSVR_LinearVelocityReport report;
-                report.sensor = info.sensor;
+                report.sensor = deviceReport.sensor;
                 report.state = vel;
                 m_internals.setStateAndTriggerCallbacks(timestamp, report);
             }
@@ -201,17 +293,15 @@ namespace client {
             overallReport.state.angularVelocityValid =
                 m_info.reportsAngularVelocity;
             if (m_info.reportsAngularVelocity) {
-                OSVR_AngularVelocityState state;
-                osvrQuatFromQuatlib(&(state.incrementalRotation),
-                                    info.vel_quat);
-                state.dt = info.vel_quat_dt;
+                OSVR_AngularVelocityState state =
+                    deviceReport.state.angularVelocity;
 
-                ei::map(state.incrementalRotation) = xform.transformDerivative(
+                ei::map(state.incrementalRotation) = m_transformDerivative(
                     ei::map(state.incrementalRotation));
 
                 overallReport.state.angularVelocity = state;
                 OSVR_AngularVelocityReport report;
-                report.sensor = info.sensor;
+                report.sensor = deviceReport.sensor;
                 report.state = state;
                 m_internals.setStateAndTriggerCallbacks(timestamp, report);
             }
@@ -219,29 +309,42 @@ namespace client {
             m_internals.setStateAndTriggerCallbacks(timestamp, overallReport);
         }
 
-        /// Pass acceleration messages on to the client
         void m_handle(vrpn_TRACKERACCCB const &info) {
-            /// @todo should we be marking a trace event here?
-            // common::tracing::markNewTrackerData();
             OSVR_TimeValue timestamp;
             osvrStructTimevalToTimeValue(&timestamp, &(info.msg_time));
+            OSVR_AccelerationReport report;
+            report.sensor = info.sensor;
+            report.state.linearAccelerationValid = true;
+            osvrVec3FromQuatlib(&(report.state.linearAcceleration), info.acc);
+            report.state.angularAccelerationValid = true;
+            osvrQuatFromQuatlib(
+                &(report.state.angularAcceleration.incrementalRotation),
+                info.acc_quat);
+            report.state.angularAcceleration.dt = info.acc_quat_dt;
+            m_handle(timestamp, report);
+        }
 
+        /// Pass acceleration messages on to the client
+        void m_handle(OSVR_TimeValue const &timestamp,
+                      OSVR_AccelerationReport const &deviceReport) {
+            /// @todo should we be marking a trace event here?
+            // common::tracing::markNewTrackerData();
             OSVR_AccelerationReport overallReport;
-            overallReport.sensor = info.sensor;
+            overallReport.sensor = deviceReport.sensor;
 
-            auto xform = getCurrentTransform();
+            updateCachedTransform();
 
             overallReport.state.linearAccelerationValid =
                 m_info.reportsLinearAcceleration;
             if (m_info.reportsLinearAcceleration) {
-                OSVR_LinearAccelerationState accel;
-                osvrVec3FromQuatlib(&(accel), info.acc);
+                OSVR_LinearAccelerationState accel =
+                    deviceReport.state.linearAcceleration;
 
-                ei::map(accel) = xform.transformDerivative(ei::map(accel));
+                ei::map(accel) = m_transformDerivative(ei::map(accel));
 
                 overallReport.state.linearAcceleration = accel;
                 OSVR_LinearAccelerationReport report;
-                report.sensor = info.sensor;
+                report.sensor = deviceReport.sensor;
                 report.state = accel;
                 m_internals.setStateAndTriggerCallbacks(timestamp, report);
             }
@@ -249,35 +352,63 @@ namespace client {
                 m_info.reportsAngularAcceleration;
             if (m_info.reportsAngularAcceleration) {
 
-                OSVR_AngularAccelerationState state;
-                osvrQuatFromQuatlib(&(state.incrementalRotation),
-                                    info.acc_quat);
-                state.dt = info.acc_quat_dt;
+                OSVR_AngularAccelerationState state =
+                    deviceReport.state.angularAcceleration;
 
-                ei::map(state.incrementalRotation) = xform.transformDerivative(
+                ei::map(state.incrementalRotation) = m_transformDerivative(
                     ei::map(state.incrementalRotation));
 
                 overallReport.state.angularAcceleration = state;
                 OSVR_AngularAccelerationReport report;
-                report.sensor = info.sensor;
+                report.sensor = deviceReport.sensor;
                 report.state = state;
                 m_internals.setStateAndTriggerCallbacks(timestamp, report);
             }
 
             m_internals.setStateAndTriggerCallbacks(timestamp, overallReport);
         }
+
+        /// @brief Applies the cached transform to a linear derivative.
+        Eigen::Vector3d m_transformDerivative(Eigen::Vector3d const &vec) {
+            if (m_cachedIsRigid) {
+                return m_cachedRigidTransform.transformDerivative(vec);
+            }
+            return m_cachedTransform.transformDerivative(vec);
+        }
+
+        /// @brief Applies the cached transform to an angular derivative.
+        Eigen::Quaterniond
+        m_transformDerivative(Eigen::Quaterniond const &quat) {
+            if (m_cachedIsRigid) {
+                return m_cachedRigidTransform.transformDerivative(quat);
+            }
+            return m_cachedTransform.transformDerivative(quat);
+        }
+
         unique_ptr<vrpn_Tracker_Remote> m_remote;
         common::Transform m_transform;
+        /// @name Cached composition of m_transform with room to world
+        /// @{
+        common::Transform m_cachedTransform;
+        common::RigidTransform m_cachedRigidTransform;
+        bool m_cachedIsRigid = false;
+        bool m_haveCachedTransform = false;
+        std::uint32_t m_cachedGeneration = 0;
+        /// @}
         common::ClientContext &m_ctx;
         RemoteHandlerInternals m_internals;
         Options m_opts;
         common::TrackerSensorInfo m_info;
         boost::optional<int> m_sensor;
+        /// @brief Declared last, so the handlers referring to this object
+        /// are removed first.
+        std::vector<common::LocalReportSubscriptionPtr> m_localSubscriptions;
     };
 
     TrackerRemoteFactory::TrackerRemoteFactory(
-        VRPNConnectionCollection const &conns)
-        : m_conns(conns) {}
+        VRPNConnectionCollection const &conns,
+        common::LocalReportDispatcherPtr const &localReports)
+        : m_conns(conns), m_localReports(localReports) {}
 
     shared_ptr<RemoteHandler> TrackerRemoteFactory::
     operator()(common::OriginalSource const &source,
@@ -304,10 +435,27 @@ namespace client {
             xform = xformParse.getTransform();
         }
 
+        auto conn = m_conns.getConnection(devElt);
+
+        /// Only trust the in-process dispatcher for devices on our own
+        /// server: another server may have a device by the same name.
+        common::LocalDeviceReportsPtr local;
+        if (m_localReports &&
+            conn == m_conns.getConnection(devElt.getDeviceName(),
+                                          "localhost")) {
+            local = m_localReports->getDevice(devElt.getDeviceName());
+        }
+        if (local) {
+            ret.reset(new VRPNTrackerHandler(
+                *local, devElt.getFullDeviceName().c_str(), opts, info, xform,
+                source.getSensorNumber(), ifaces, ctx));
+            return ret;
+        }
+
         /// @todo find out why make_shared causes a crash here
         ret.reset(new VRPNTrackerHandler(
-            m_conns.getConnection(devElt), devElt.getFullDeviceName().c_str(),
-            opts, info, xform, source.getSensorNumber(), ifaces, ctx));
+            conn, devElt.getFullDeviceName().c_str(), opts, info, xform,
+            source.getSensorNumber(), ifaces, ctx));
         return ret;
     }
 
@@ -28,6 +28,7 @@
 // Internal Includes
 #include "VRPNConnectionCollection.h"
 #include <osvr/Common/InterfaceList.h>
+#include <osvr/Common/LocalReportDispatcher.h>
 #include <osvr/Common/OriginalSource.h>
 #include <osvr/Util/SharedPtr.h>
 #include <osvr/Client/RemoteHandler.h>
@@ -45,7 +46,11 @@ namespace client {
 
     class TrackerRemoteFactory {
       public:
-        TrackerRemoteFactory(VRPNConnectionCollection const &conns);
+        /// @param localReports If provided, trackers published in-process
+        /// are subscribed to directly rather than through VRPN.
+        TrackerRemoteFactory(
+            VRPNConnectionCollection const &conns,
+            common::LocalReportDispatcherPtr const &localReports = nullptr);
 
         template <typename T> void registerWith(T &factory) const {
             factory.addFactory("tracker", *this);
@@ -57,6 +62,7 @@ namespace client {
 
       private:
         VRPNConnectionCollection m_conns;
+        common::LocalReportDispatcherPtr m_localReports;
     };
 
 } // namespace client
@@ -38,10 +38,14 @@
 
 namespace osvr {
 namespace client {
-    Eigen::Isometry3d ViewerEye::getPoseIsometry() const {
+    Eigen::Isometry3d ViewerEye::getPoseIsometry(
+        boost::optional<util::time::TimeValue> const &targetTime) const {
         OSVR_TimeValue timestamp;
         OSVR_Pose3 pose;
-        bool hasState = m_pose->getState<OSVR_PoseReport>(timestamp, pose);
+        bool hasState =
+            targetTime
+                ? m_pose->getPoseStateAtTime(*targetTime, timestamp, pose)
+                : m_pose->getState<OSVR_PoseReport>(timestamp, pose);
         if (!hasState) {
             throw NoPoseYet();
         }
@@ -58,6 +62,14 @@ namespace client {
         return pose;
     }
 
+    OSVR_Pose3
+    ViewerEye::getPoseAtTime(util::time::TimeValue const &targetTime) const {
+        Eigen::Isometry3d transformedPose = getPoseIsometry(targetTime);
+        OSVR_Pose3 pose;
+        util::toPose(transformedPose, pose);
+        return pose;
+    }
+
     bool ViewerEye::hasPose() const {
         return m_pose->hasStateForReportType<OSVR_PoseReport>();
     }
@@ -67,6 +79,12 @@ namespace client {
         return transformedPose.inverse().matrix();
     }
 
+    Eigen::Matrix4d
+    ViewerEye::getViewAtTime(util::time::TimeValue const &targetTime) const {
+        Eigen::Isometry3d transformedPose = getPoseIsometry(targetTime);
+        return transformedPose.inverse().matrix();
+    }
+
     util::Rectd ViewerEye::m_getRect(double near, double /*far*/ = 100) const {
         util::Rectd rect(m_unitBounds);
         // Scale the in-plane positions based on the near plane to put
@@ -83,6 +83,26 @@ OSVR_ReturnCode osvrClientUpdate(OSVR_ClientContext ctx) {
     return OSVR_RETURN_SUCCESS;
 }
 
+OSVR_ReturnCode osvrClientStartUpdateThread(OSVR_ClientContext ctx) {
+    if (!ctx) {
+        make_clientkit_logger()->error(
+            "Can't start the update thread of a null Client Context!");
+        return OSVR_RETURN_FAILURE;
+    }
+    ctx->startUpdateThread();
+    return OSVR_RETURN_SUCCESS;
+}
+
+OSVR_ReturnCode osvrClientStopUpdateThread(OSVR_ClientContext ctx) {
+    if (!ctx) {
+        make_clientkit_logger()->error(
+            "Can't stop the update thread of a null Client Context!");
+        return OSVR_RETURN_FAILURE;
+    }
+    ctx->stopUpdateThread();
+    return OSVR_RETURN_SUCCESS;
+}
+
 OSVR_ReturnCode osvrClientShutdown(OSVR_ClientContext ctx) {
     if (nullptr == ctx) {
         make_clientkit_logger()->error("Can't delete a null Client Context!");
@@ -225,6 +225,32 @@ OSVR_ReturnCode osvrClientGetViewerEyePose(OSVR_DisplayConfig disp,
     return OSVR_RETURN_FAILURE;
 }
 
+OSVR_ReturnCode osvrClientGetViewerEyePoseAtTime(
+    OSVR_DisplayConfig disp, OSVR_ViewerCount viewer, OSVR_EyeCount eye,
+    const struct OSVR_TimeValue *targetTime, OSVR_Pose3 *pose) {
+    OSVR_VALIDATE_DISPLAY_CONFIG;
+    OSVR_VALIDATE_VIEWER_ID;
+    OSVR_VALIDATE_EYE_ID;
+    OSVR_VALIDATE_OUTPUT_PTR(pose, "eye pose");
+    if (nullptr == targetTime) {
+        OSVR_DEV_VERBOSE("Passed a null pointer for the target time!");
+        return OSVR_RETURN_FAILURE;
+    }
+    try {
+        *pose = disp->cfg->getViewerEye(viewer, eye).getPoseAtTime(*targetTime);
+        return OSVR_RETURN_SUCCESS;
+    } catch (osvr::client::NoPoseYet &) {
+        OSVR_DEV_VERBOSE(
+            "Error getting predicted viewer eye pose: no pose yet available");
+        return OSVR_RETURN_FAILURE;
+    } catch (std::exception &e) {
+        OSVR_DEV_VERBOSE("Error getting predicted viewer eye pose - exception: "
+                         << e.what());
+        return OSVR_RETURN_FAILURE;
+    }
+    return OSVR_RETURN_FAILURE;
+}
+
 template <typename Scalar>
 static inline OSVR_ReturnCode getViewMatrixImpl(OSVR_DisplayConfig disp,
                                                 OSVR_ViewerCount viewer,
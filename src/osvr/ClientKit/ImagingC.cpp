@@ -25,15 +25,70 @@
 // Internal Includes
 #include <osvr/ClientKit/ImagingC.h>
 #include <osvr/Common/ClientContext.h>
+#include <osvr/Common/ImageLeaseManager.h>
 
 // Library/third-party includes
 // - none
 
 // Standard includes
-// - none
+#include <mutex>
 
 OSVR_ReturnCode osvrClientFreeImage(OSVR_ClientContext ctx,
                                     OSVR_ImageBufferElement *buf) {
     auto ret = ctx->releaseObject(buf);
     return (ret ? OSVR_RETURN_SUCCESS : OSVR_RETURN_FAILURE);
 }
+
+OSVR_ReturnCode osvrClientSetImageLeasePolicy(OSVR_ClientContext ctx,
+                                              OSVR_ImageLeaseAction action,
+                                              double deadlineSeconds,
+                                              uint32_t maxPinned) {
+    if (!ctx || deadlineSeconds < 0) {
+        return OSVR_RETURN_FAILURE;
+    }
+    osvr::common::ImageLeasePolicy policy;
+    switch (action) {
+    case OSVR_IMAGE_LEASE_COPY_OUT:
+        policy.action = osvr::common::ImageLeaseAction::CopyOut;
+        break;
+    case OSVR_IMAGE_LEASE_REVOKE:
+        policy.action = osvr::common::ImageLeaseAction::Revoke;
+        break;
+    default:
+        return OSVR_RETURN_FAILURE;
+    }
+    policy.deadline = deadlineSeconds;
+    policy.maxPinned = maxPinned;
+    std::lock_guard<OSVR_ClientContextObject::UpdateMutex> lock(
+        ctx->getUpdateMutex());
+    ctx->getImageLeaseManager().setPolicy(policy);
+    return OSVR_RETURN_SUCCESS;
+}
+
+OSVR_ReturnCode osvrClientGetImageLeaseStats(OSVR_ClientContext ctx,
+                                             OSVR_ImageLeaseStats *stats) {
+    if (!ctx || !stats) {
+        return OSVR_RETURN_FAILURE;
+    }
+    std::lock_guard<OSVR_ClientContextObject::UpdateMutex> lock(
+        ctx->getUpdateMutex());
+    auto ret = ctx->getImageLeaseManager().getStats();
+    stats->pinned = static_cast<uint32_t>(ret.pinned);
+    stats->copied = ret.copied;
+    stats->revoked = ret.revoked;
+    stats->dropped = ret.dropped;
+    return OSVR_RETURN_SUCCESS;
+}
+
+OSVR_ReturnCode osvrClientIsImageRevoked(OSVR_ClientContext ctx,
+                                         OSVR_ImageBufferElement const *buf,
+                                         OSVR_CBool *revoked) {
+    if (!ctx || !revoked) {
+        return OSVR_RETURN_FAILURE;
+    }
+    std::lock_guard<OSVR_ClientContextObject::UpdateMutex> lock(
+        ctx->getUpdateMutex());
+    *revoked = ctx->getImageLeaseManager().isRevoked(buf) ? OSVR_TRUE
+                                                          : OSVR_FALSE;
+    return OSVR_RETURN_SUCCESS;
+}
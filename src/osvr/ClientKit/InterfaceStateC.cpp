@@ -62,3 +62,15 @@ OSVR_CALLBACK_METHODS(NaviPosition)
 OSVR_CALLBACK_METHODS(Skeleton)
 
 #undef OSVR_CALLBACK_METHODS
+
+OSVR_ReturnCode osvrGetPoseStateAtTime(OSVR_ClientInterface iface,
+                                       const struct OSVR_TimeValue *targetTime,
+                                       struct OSVR_TimeValue *timestamp,
+                                       OSVR_PoseState *state) {
+    if (nullptr == iface || nullptr == targetTime || nullptr == timestamp ||
+        nullptr == state) {
+        return OSVR_RETURN_FAILURE;
+    }
+    bool hasState = iface->getPoseStateAtTime(*targetTime, *timestamp, *state);
+    return hasState ? OSVR_RETURN_SUCCESS : OSVR_RETURN_FAILURE;
+}
@@ -0,0 +1,60 @@
+/** @file
+    @brief Implementation
+
+    @date 2017
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2017 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include <osvr/ClientKit/LatencyC.h>
+#include <osvr/Common/ClientInterface.h>
+
+// Library/third-party includes
+// - none
+
+// Standard includes
+// - none
+
+OSVR_ReturnCode
+osvrClientGetInterfaceLatencyStats(OSVR_ClientInterface iface,
+                                   OSVR_ReportLatencyStats *stats) {
+    if (nullptr == iface || nullptr == stats) {
+        return OSVR_RETURN_FAILURE;
+    }
+    auto lock = iface->lockContext();
+    auto const &latency = iface->getLatencyStats();
+    stats->reportCount = latency.getReportCount();
+    stats->outOfOrderCount = latency.getOutOfOrderCount();
+    stats->reportRate = latency.getReportRate();
+    stats->latencyP50 = latency.getLatencyPercentile(0.5);
+    stats->latencyP99 = latency.getLatencyPercentile(0.99);
+    stats->latencyMax = latency.getMaxLatency();
+    return OSVR_RETURN_SUCCESS;
+}
+
+OSVR_ReturnCode
+osvrClientResetInterfaceLatencyStats(OSVR_ClientInterface iface) {
+    if (nullptr == iface) {
+        return OSVR_RETURN_FAILURE;
+    }
+    auto lock = iface->lockContext();
+    iface->getLatencyStats().reset();
+    return OSVR_RETURN_SUCCESS;
+}
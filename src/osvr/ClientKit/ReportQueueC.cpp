@@ -0,0 +1,105 @@
+/** @file
+    @brief Implementation
+
+    @date 2017
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2017 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include <osvr/ClientKit/ReportQueueC.h>
+#include <osvr/Common/ClientInterface.h>
+
+// Library/third-party includes
+// - none
+
+// Standard includes
+// - none
+
+template <typename ReportType>
+static inline OSVR_ReturnCode setQueueCapacity(OSVR_ClientInterface iface,
+                                               uint32_t capacity) {
+    if (nullptr == iface) {
+        return OSVR_RETURN_FAILURE;
+    }
+    auto lock = iface->lockContext();
+    iface->getReportQueue<ReportType>().setCapacity(capacity);
+    return OSVR_RETURN_SUCCESS;
+}
+
+template <typename ReportType>
+static inline OSVR_ReturnCode
+drainQueue(OSVR_ClientInterface iface, OSVR_TimeValue *timestamps,
+           ReportType *reports, uint32_t maxReports, uint32_t *numReports,
+           uint32_t *numDropped) {
+    if (nullptr == iface || nullptr == numReports ||
+        (maxReports > 0 && (nullptr == timestamps || nullptr == reports))) {
+        return OSVR_RETURN_FAILURE;
+    }
+    auto lock = iface->lockContext();
+    auto &queue = iface->getReportQueue<ReportType>();
+    using Entry = typename osvr::common::ReportQueue<ReportType>::Entry;
+    uint32_t n = 0;
+    queue.drain(maxReports, [&](Entry const &entry) {
+        timestamps[n] = entry.timestamp;
+        reports[n] = entry.report;
+        ++n;
+    });
+    *numReports = n;
+    auto dropped = queue.takeDroppedCount();
+    if (numDropped) {
+        *numDropped = dropped;
+    }
+    return OSVR_RETURN_SUCCESS;
+}
+
+#define OSVR_REPORT_QUEUE_METHODS(TYPE)                                        \
+    OSVR_ReturnCode osvrClientInterfaceSet##TYPE##ReportQueueCapacity(         \
+        OSVR_ClientInterface iface, uint32_t capacity) {                       \
+        return setQueueCapacity<OSVR_##TYPE##Report>(iface, capacity);         \
+    }                                                                          \
+    OSVR_ReturnCode osvrClientInterfaceDrain##TYPE##Reports(                   \
+        OSVR_ClientInterface iface, struct OSVR_TimeValue *timestamps,         \
+        OSVR_##TYPE##Report *reports, uint32_t maxReports,                     \
+        uint32_t *numReports, uint32_t *numDropped) {                          \
+        return drainQueue(iface, timestamps, reports, maxReports, numReports,  \
+                          numDropped);                                         \
+    }
+
+OSVR_REPORT_QUEUE_METHODS(Pose)
+OSVR_REPORT_QUEUE_METHODS(Position)
+OSVR_REPORT_QUEUE_METHODS(Orientation)
+OSVR_REPORT_QUEUE_METHODS(Velocity)
+OSVR_REPORT_QUEUE_METHODS(LinearVelocity)
+OSVR_REPORT_QUEUE_METHODS(AngularVelocity)
+OSVR_REPORT_QUEUE_METHODS(Acceleration)
+OSVR_REPORT_QUEUE_METHODS(LinearAcceleration)
+OSVR_REPORT_QUEUE_METHODS(AngularAcceleration)
+OSVR_REPORT_QUEUE_METHODS(Button)
+OSVR_REPORT_QUEUE_METHODS(Analog)
+OSVR_REPORT_QUEUE_METHODS(Location2D)
+OSVR_REPORT_QUEUE_METHODS(Direction)
+OSVR_REPORT_QUEUE_METHODS(EyeTracker2D)
+OSVR_REPORT_QUEUE_METHODS(EyeTracker3D)
+OSVR_REPORT_QUEUE_METHODS(EyeTrackerBlink)
+OSVR_REPORT_QUEUE_METHODS(NaviVelocity)
+OSVR_REPORT_QUEUE_METHODS(NaviPosition)
+OSVR_REPORT_QUEUE_METHODS(Skeleton)
+
+#undef OSVR_REPORT_QUEUE_METHODS
@@ -68,6 +68,21 @@ namespace common {
                                               getSender().get());
     }
 
+    void BaseDevice::registerAnySenderHandler(vrpn_MESSAGEHANDLER handler,
+                                              void *userdata,
+                                              RawMessageType const &msgType) {
+        m_getConnection()->register_handler(msgType.get(), handler, userdata,
+                                            RawSenderType().get());
+    }
+
+    void
+    BaseDevice::unregisterAnySenderHandler(vrpn_MESSAGEHANDLER handler,
+                                           void *userdata,
+                                           RawMessageType const &msgType) {
+        m_getConnection()->unregister_handler(msgType.get(), handler, userdata,
+                                              RawSenderType().get());
+    }
+
     RawMessageType BaseDevice::m_registerMessageType(const char *msgString) {
         OSVR_DEV_VERBOSE("BaseDevice registering message type " << msgString);
         return RawMessageType(
@@ -26,6 +26,7 @@
 #include "GetJSONStringFromTree.h"
 #include <osvr/Common/ClientContext.h>
 #include <osvr/Common/ClientInterface.h>
+#include <osvr/Common/ImageLeaseManager.h>
 #include <osvr/Util/Verbosity.h>
 
 // Library/third-party includes
@@ -33,6 +34,9 @@
 
 // Standard includes
 #include <algorithm>
+#include <chrono>
+#include <mutex>
+#include <thread>
 
 using ::osvr::common::ClientInterfacePtr;
 using ::osvr::common::ClientInterface;
@@ -42,6 +46,9 @@ using ::osvr::make_shared;
 namespace osvr {
 namespace common {
     void deleteContext(ClientContext *ctx) {
+        /// The update thread calls into the derived class, so it has to stop
+        /// before any destructor runs.
+        ctx->stopUpdateThread();
         auto del = ctx->getDeleter();
         (*del)(ctx);
     }
@@ -51,13 +58,16 @@ namespace common {
 static const auto CLIENT_LOG_PREFIX = "Client: ";
 static const auto OSVR_LIBS_CLIENT_LOG_PREFIX = "OSVR: ";
 static const auto OSVR_LIBS_CLIENT_LOG_SUFFIX = "";
+/// @brief Upper bound on how long the update thread waits for traffic before
+/// updating anyway.
+static const std::chrono::microseconds UPDATE_THREAD_MAX_WAIT(1000);
 
 OSVR_ClientContextObject::OSVR_ClientContextObject(
     const char appId[],
     osvr::common::ClientInterfaceFactory const &interfaceFactory,
     osvr::common::ClientContextDeleter del)
     : m_appId(appId), m_clientInterfaceFactory(interfaceFactory),
-      m_deleter(del),
+      m_imageLeases(new osvr::common::ImageLeaseManager), m_deleter(del),
       m_logger(osvr::util::log::make_logger(
           OSVR_LIBS_CLIENT_LOG_PREFIX + m_appId + OSVR_LIBS_CLIENT_LOG_SUFFIX)),
       m_clientLogger(
@@ -76,6 +86,10 @@ OSVR_ClientContextObject::OSVR_ClientContextObject(const char appId[],
           appId, osvr::common::getStandardClientInterfaceFactory(), del) {}
 
 OSVR_ClientContextObject::~OSVR_ClientContextObject() {
+    BOOST_ASSERT_MSG(!m_updateThreadRunning,
+                     "Update thread should have been stopped by "
+                     "deleteContext() before the derived class was destroyed!");
+    stopUpdateThread();
     m_logger->info() << "OSVR client context shut down for " << m_appId;
     m_logger->flush();
 }
@@ -85,13 +99,52 @@ std::string const &OSVR_ClientContextObject::getAppId() const {
 }
 
 void OSVR_ClientContextObject::update() {
+    if (m_updateThreadRunning) {
+        return;
+    }
+    m_updateAll();
+}
+
+void OSVR_ClientContextObject::startUpdateThread() {
+    if (m_updateThreadRunning) {
+        return;
+    }
+    m_updateThreadRunning = true;
+    m_updateThread = std::thread([&] { m_runUpdateThread(); });
+    m_logger->info() << "Started client update thread";
+}
+
+void OSVR_ClientContextObject::stopUpdateThread() {
+    if (!m_updateThreadRunning) {
+        return;
+    }
+    m_updateThreadRunning = false;
+    m_updateThread.join();
+    m_logger->info() << "Stopped client update thread";
+}
+
+void OSVR_ClientContextObject::m_updateAll() {
+    std::lock_guard<UpdateMutex> lock(m_updateMutex);
     m_update();
     for (auto const &iface : m_interfaces) {
         iface->update();
     }
 }
 
+void OSVR_ClientContextObject::m_runUpdateThread() {
+    while (m_updateThreadRunning) {
+        m_updateAll();
+        m_waitForUpdate(UPDATE_THREAD_MAX_WAIT);
+    }
+}
+
+void OSVR_ClientContextObject::m_waitForUpdate(
+    std::chrono::microseconds maxWait) {
+    std::this_thread::sleep_for(maxWait);
+}
+
 ClientInterfacePtr OSVR_ClientContextObject::getInterface(const char path[]) {
+    std::lock_guard<UpdateMutex> lock(m_updateMutex);
     auto ret = m_clientInterfaceFactory(*this, path);
     if (!ret) {
         return ret;
@@ -107,6 +160,7 @@ OSVR_ClientContextObject::releaseInterface(ClientInterface *iface) {
     if (!iface) {
         return ret;
     }
+    std::lock_guard<UpdateMutex> lock(m_updateMutex);
     auto it = std::find_if(begin(m_interfaces), end(m_interfaces),
                            [&](ClientInterfacePtr const &ptr) {
                                if (ptr.get() == iface) {
@@ -129,6 +183,7 @@ OSVR_ClientContextObject::releaseInterface(ClientInterface *iface) {
 
 std::string
 OSVR_ClientContextObject::getStringParameter(std::string const &path) const {
+    std::lock_guard<UpdateMutex> lock(m_updateMutex);
     return getJSONStringFromTree(getPathTree(), path);
 }
 
@@ -137,10 +192,12 @@ osvr::common::PathTree const &OSVR_ClientContextObject::getPathTree() const {
 }
 
 void OSVR_ClientContextObject::sendRoute(std::string const &route) {
+    std::lock_guard<UpdateMutex> lock(m_updateMutex);
     m_sendRoute(route);
 }
 
 bool OSVR_ClientContextObject::releaseObject(void *obj) {
+    std::lock_guard<UpdateMutex> lock(m_updateMutex);
     return m_ownedObjects.release(obj);
 }
 
@@ -151,14 +208,19 @@ OSVR_ClientContextObject::getRoomToWorldTransform() const {
 
 void OSVR_ClientContextObject::setRoomToWorldTransform(
     osvr::common::Transform const &xform) {
+    std::lock_guard<UpdateMutex> lock(m_updateMutex);
     m_setRoomToWorldTransform(xform);
+    ++m_roomToWorldGeneration;
 }
 
 ClientContextDeleter OSVR_ClientContextObject::getDeleter() const {
     return m_deleter;
 }
 
-bool OSVR_ClientContextObject::getStatus() const { return m_getStatus(); }
+bool OSVR_ClientContextObject::getStatus() const {
+    std::lock_guard<UpdateMutex> lock(m_updateMutex);
+    return m_getStatus();
+}
 
 void OSVR_ClientContextObject::log(osvr::util::log::LogLevel severity,
                                    const char *message) {
@@ -23,7 +23,9 @@
 // limitations under the License.
 
 // Internal Includes
+#include <osvr/Common/ClientContext.h>
 #include <osvr/Common/ClientInterface.h>
+#include <osvr/Common/PosePrediction.h>
 #include <osvr/Util/Verbosity.h>
 
 // Library/third-party includes
@@ -42,4 +44,17 @@ std::string const &OSVR_ClientInterfaceObject::getPath() const {
     return m_path;
 }
 
+bool OSVR_ClientInterfaceObject::getPoseStateAtTime(
+    osvr::util::time::TimeValue const &targetTime,
+    osvr::util::time::TimeValue &timestamp, OSVR_PoseState &state) const {
+    osvr::common::tracing::markGetState(m_path);
+    return osvr::common::predictPoseState(m_state, targetTime, timestamp,
+                                          state);
+}
+
+std::unique_lock<std::recursive_mutex>
+OSVR_ClientInterfaceObject::lockContext() const {
+    return std::unique_lock<std::recursive_mutex>(m_ctx.getUpdateMutex());
+}
+
 void OSVR_ClientInterfaceObject::update() {}
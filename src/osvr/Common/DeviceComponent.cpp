@@ -59,6 +59,15 @@ namespace common {
         h->registerHandler(&m_getParent());
         m_messageHandlers.push_back(h);
     }
+    void DeviceComponent::m_registerAnySenderHandler(
+        vrpn_MESSAGEHANDLER handler, void *userdata,
+        RawMessageType const &msgType) {
+        auto h = make_shared<
+            MessageHandler<BaseDeviceAnySenderMessageHandleTraits> >(
+            handler, userdata, msgType);
+        h->registerHandler(&m_getParent());
+        m_anySenderMessageHandlers.push_back(h);
+    }
     void DeviceComponent::m_update() {}
 } // namespace common
 } // namespace osvr
@@ -53,7 +53,9 @@ namespace common {
     /// shared-memory objects (Bookkeeping, ElementData) changes, if Boost
     /// Interprocess changes affect the utilized ABI, or if other changes occur
     /// that would interfere with communication.
-    static IPCRingBuffer::abi_level_type SHM_SOURCE_ABI_LEVEL = 0;
+    ///
+    /// - Level 1: Added the lock-free (seqlock) mode and its counters.
+    static IPCRingBuffer::abi_level_type SHM_SOURCE_ABI_LEVEL = 1;
 
 #ifdef _WIN32
 #if (BOOST_VERSION < 105400)
@@ -286,6 +288,11 @@ namespace common {
         m_entrySize = entrySize;
         return *this;
     }
+
+    IPCRingBuffer::Options &IPCRingBuffer::Options::setLockFree(bool lockFree) {
+        m_lockFree = lockFree;
+        return *this;
+    }
     class IPCRingBuffer::Impl {
       public:
         Impl(unique_ptr<SharedMemorySegmentHolder> &&segment,
@@ -294,6 +301,7 @@ namespace common {
             m_bookkeeping = m_seg->getBookkeeping();
             m_opts.setEntries(m_bookkeeping->getCapacity());
             m_opts.setEntrySize(m_bookkeeping->getBufferLength());
+            m_opts.setLockFree(m_bookkeeping->isLockFree());
         }
 
         detail::IPCPutResultPtr put() {
@@ -301,6 +309,9 @@ namespace common {
         }
 
         detail::IPCGetResultPtr get(sequence_type num) {
+            if (m_bookkeeping->isLockFree()) {
+                return getLockFree(num);
+            }
             detail::IPCGetResultPtr ret;
             auto boundsLock = m_bookkeeping->getSharableLock();
             auto elt = m_bookkeeping->getBySequenceNumber(num, boundsLock);
@@ -309,12 +320,28 @@ namespace common {
                 auto buf = elt->getBuf(readerLock);
                 /// The nullptr will be filled in by the main object.
                 ret.reset(new detail::IPCGetResult{buf, std::move(readerLock),
-                                                   num, nullptr});
+                                                   num, nullptr, nullptr});
             }
             return ret;
         }
 
         detail::IPCGetResultPtr getLatest() {
+            if (m_bookkeeping->isLockFree()) {
+                /// If the producer laps us while copying, try again with the
+                /// newer element, but don't spin forever.
+                for (int attempt = 0; attempt < LOCK_FREE_LATEST_ATTEMPTS;
+                     ++attempt) {
+                    auto end = m_bookkeeping->lockFreeEnd();
+                    if (end == 0) {
+                        break;
+                    }
+                    auto ret = getLockFree(end - 1);
+                    if (ret) {
+                        return ret;
+                    }
+                }
+                return detail::IPCGetResultPtr{};
+            }
             detail::IPCGetResultPtr ret;
             auto boundsLock = m_bookkeeping->getSharableLock();
             auto elt = m_bookkeeping->back(boundsLock);
@@ -324,7 +351,8 @@ namespace common {
                 /// The nullptr will be filled in by the main object.
                 ret.reset(new detail::IPCGetResult{
                     buf, std::move(readerLock),
-                    m_bookkeeping->backSequenceNumber(boundsLock), nullptr});
+                    m_bookkeeping->backSequenceNumber(boundsLock), nullptr,
+                    nullptr});
             }
             return ret;
         }
@@ -332,6 +360,22 @@ namespace common {
         Options const &getOpts() const { return m_opts; }
 
       private:
+        static const int LOCK_FREE_LATEST_ATTEMPTS = 3;
+
+        detail::IPCGetResultPtr getLockFree(sequence_type num) {
+            detail::IPCGetResultPtr ret;
+            auto copy = util::makeAlignedImageBuffer(
+                m_bookkeeping->getBufferLength(), m_opts.getAlignment());
+            if (m_bookkeeping->lockFreeCopy(num, copy.get())) {
+                auto buf = copy.get();
+                /// The nullptr will be filled in by the main object.
+                ret.reset(new detail::IPCGetResult{
+                    buf, ipc::sharable_lock_type(), num, nullptr,
+                    std::move(copy)});
+            }
+            return ret;
+        }
+
         unique_ptr<SharedMemorySegmentHolder> m_seg;
         detail::Bookkeeping *m_bookkeeping;
 
@@ -412,6 +456,10 @@ namespace common {
         return m_impl->getOpts().getEntries();
     }
 
+    bool IPCRingBuffer::isLockFree() const {
+        return m_impl->getOpts().getLockFree();
+    }
+
     IPCRingBuffer::BufferWriteProxy IPCRingBuffer::put() {
         return BufferWriteProxy(m_impl->put(), shared_from_this());
     }
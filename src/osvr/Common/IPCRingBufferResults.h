@@ -29,6 +29,7 @@
 #include <osvr/Common/IPCRingBuffer.h>
 #include "SharedMemory.h"
 #include "SharedMemoryObjectWithMutex.h"
+#include <osvr/Util/AlignedMemoryUniquePtr.h>
 
 // Library/third-party includes
 // - none
@@ -40,20 +41,21 @@ namespace osvr {
 namespace common {
 
     namespace detail {
+        class ElementData;
+        class Bookkeeping;
         struct IPCPutResult {
-            ~IPCPutResult() {
-#ifdef OSVR_SHM_LOCK_DEBUGGING
-                OSVR_DEV_VERBOSE("Releasing exclusive lock on sequence "
-                                 << seq);
-#endif
-                elementLock.unlock();
-                boundsLock.unlock();
-            }
+            /// @brief Releases the element lock, or in lock-free mode,
+            /// commits the element. Defined in IPCRingBufferSharedObjects.h, since it
+            /// needs the complete types.
+            inline ~IPCPutResult();
             IPCRingBuffer::value_type *buffer;
             IPCRingBuffer::sequence_type seq;
             ipc::exclusive_lock_type elementLock;
-            ipc::exclusive_lock_type boundsLock;
             IPCRingBufferPtr shm;
+            /// @brief Only non-null in lock-free mode.
+            ElementData *lockFreeElement;
+            /// @brief Only non-null in lock-free mode.
+            Bookkeeping *lockFreeBookkeeping;
         };
 
         struct IPCGetResult {
@@ -62,12 +64,17 @@ namespace common {
 #ifdef OSVR_SHM_LOCK_DEBUGGING
                 OSVR_DEV_VERBOSE("Releasing shared lock on sequence " << seq);
 #endif
-                elementLock.unlock();
+                if (elementLock) {
+                    elementLock.unlock();
+                }
             }
             IPCRingBuffer::value_type *buffer;
             ipc::sharable_lock_type elementLock;
             IPCRingBuffer::sequence_type seq;
             IPCRingBufferPtr shm;
+            /// @brief In lock-free mode, the private copy that buffer points
+            /// to.
+            util::AlignedImageBufferPtr copy;
         };
     } // namespace detail
 
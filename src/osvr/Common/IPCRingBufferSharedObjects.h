@@ -37,6 +37,8 @@
 #include <boost/noncopyable.hpp>
 
 // Standard includes
+#include <atomic>
+#include <cstring>
 #include <utility>
 
 namespace osvr {
@@ -45,11 +47,18 @@ namespace common {
     namespace detail {
         namespace bip = boost::interprocess;
 
+        /// @brief The lock-free mode places these atomics in shared memory, so
+        /// they must not hide a process-local lock.
+        static_assert(ATOMIC_INT_LOCK_FREE == 2,
+                      "Lock-free IPC ring buffers require always-lock-free "
+                      "32-bit atomics.");
+
         class ElementData : public ipc::ObjectWithMutex, boost::noncopyable {
           public:
             typedef IPCRingBuffer::value_type BufferType;
+            typedef IPCRingBuffer::sequence_type sequence_type;
 
-            ElementData() : m_buf(nullptr) {}
+            ElementData() : m_buf(nullptr), m_generation(0), m_seq(0) {}
 
             template <typename LockType>
             BufferType *getBuf(LockType &lock) const {
@@ -57,6 +66,44 @@ namespace common {
                 return m_buf.get();
             }
 
+            /// @name Lock-free (seqlock) access
+            /// The generation counter is odd while the single producer is
+            /// writing to the element, and the stored sequence number
+            /// identifies which put() the contents belong to.
+            /// @{
+            /// @brief Producer: starts overwriting this element with the
+            /// given sequence number, returning the buffer to write to.
+            BufferType *beginLockFreeWrite(sequence_type seq) {
+                m_generation.fetch_add(1, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_release);
+                m_seq.store(seq, std::memory_order_relaxed);
+                return m_buf.get();
+            }
+
+            /// @brief Producer: marks the write as complete.
+            void endLockFreeWrite() {
+                m_generation.fetch_add(1, std::memory_order_release);
+            }
+
+            /// @brief Consumer: copies the contents out if they still belong
+            /// to the given sequence number and weren't modified during the
+            /// copy.
+            ///
+            /// @return false if the element was torn or overwritten, in which
+            /// case the contents of dest are meaningless.
+            bool lockFreeCopy(sequence_type seq, BufferType *dest,
+                              uint32_t len) const {
+                auto gen = m_generation.load(std::memory_order_acquire);
+                if ((gen & 0x1) != 0 ||
+                    m_seq.load(std::memory_order_relaxed) != seq) {
+                    return false;
+                }
+                std::memcpy(dest, m_buf.get(), len);
+                std::atomic_thread_fence(std::memory_order_acquire);
+                return gen == m_generation.load(std::memory_order_relaxed);
+            }
+            /// @}
+
             template <typename ManagedMemory>
             void allocateBuf(ManagedMemory &shm,
                              IPCRingBuffer::Options const &opts) {
@@ -74,12 +121,15 @@ namespace common {
 
           private:
             ipc_offset_ptr<BufferType> m_buf;
+            std::atomic<uint32_t> m_generation;
+            std::atomic<sequence_type> m_seq;
         };
 
         class Bookkeeping : public ipc::ObjectWithMutex, boost::noncopyable {
           public:
             typedef IPCRingBuffer::sequence_type sequence_type;
             typedef uint16_t raw_index_type;
+            typedef ElementData::BufferType BufferType;
 
             template <typename ManagedMemory>
             static Bookkeeping *find(ManagedMemory &shm) {
@@ -111,7 +161,8 @@ namespace common {
                   elementArray(shm.template construct<ElementData>(
                       bip::unique_instance)[m_capacity]()),
                   m_beginSequenceNumber(0), m_nextSequenceNumber(0), m_begin(0),
-                  m_size(0), m_bufLen(opts.getEntrySize()) {
+                  m_size(0), m_bufLen(opts.getEntrySize()),
+                  m_lockFree(opts.getLockFree()), m_lockFreeEnd(0) {
 
                 auto lock = getExclusiveLock();
                 {
@@ -146,6 +197,9 @@ namespace common {
             /// @brief Get capacity of elements.
             uint32_t getBufferLength() const { return m_bufLen; }
 
+            /// @brief Was this buffer created in lock-free broadcast mode?
+            bool isLockFree() const { return m_lockFree; }
+
             template <typename LockType>
             ElementData &getByRawIndex(raw_index_type index, LockType &lock) {
                 verifyReaderLock(lock);
@@ -183,6 +237,9 @@ namespace common {
             }
 
             IPCPutResultPtr produceElement() {
+                if (m_lockFree) {
+                    return produceElementLockFree();
+                }
                 auto lock = getExclusiveLock();
                 auto sequenceNumber = m_nextSequenceNumber;
                 m_nextSequenceNumber++;
@@ -201,11 +258,55 @@ namespace common {
                 /// shared memory nullptr filled in by outer class
                 IPCPutResultPtr ret(new IPCPutResult{
                     back(lock)->getBuf(elementLock), sequenceNumber,
-                    std::move(elementLock), std::move(lock), nullptr});
+                    std::move(elementLock), nullptr, nullptr, nullptr});
+                /// The bookkeeping lock is released on return: the producer
+                /// may take a while to fill the element, and only readers of
+                /// this one element need to wait for that.
                 return ret;
             }
 
+            /// @brief Lock-free mode: the sequence number one past the most
+            /// recently committed element.
+            sequence_type lockFreeEnd() const {
+                return m_lockFreeEnd.load(std::memory_order_acquire);
+            }
+
+            /// @brief Lock-free mode: copies the element with the given
+            /// sequence number into dest (which must be at least
+            /// getBufferLength() bytes).
+            ///
+            /// @return false if that sequence number hasn't been committed
+            /// yet, has been overwritten, or was overwritten while copying.
+            bool lockFreeCopy(sequence_type num, BufferType *dest) const {
+                auto age = sequence_type(lockFreeEnd() - 1 - num);
+                if (age >= m_capacity) {
+                    return false;
+                }
+                return elementArray.get()[num % m_capacity].lockFreeCopy(
+                    num, dest, m_bufLen);
+            }
+
+            /// @brief Lock-free mode: called by the put result when the
+            /// producer is done writing.
+            void commitLockFree(ElementData &elt, sequence_type num) {
+                elt.endLockFreeWrite();
+                m_lockFreeEnd.store(num + 1, std::memory_order_release);
+            }
+
           private:
+            /// @brief Lock-free mode: never takes a lock, so it must only ever
+            /// be called from a single producer thread.
+            IPCPutResultPtr produceElementLockFree() {
+                auto sequenceNumber = m_nextSequenceNumber++;
+                auto &elt = elementArray.get()[sequenceNumber % m_capacity];
+                auto buf = elt.beginLockFreeWrite(sequenceNumber);
+                /// shared memory nullptr filled in by outer class
+                IPCPutResultPtr ret(new IPCPutResult{
+                    buf, sequenceNumber, ipc::exclusive_lock_type(), nullptr,
+                    &elt, this});
+                return ret;
+            }
+
             raw_index_type m_capacity;
             ipc_offset_ptr<ElementData> elementArray;
             IPCRingBuffer::sequence_type m_beginSequenceNumber;
@@ -213,7 +314,20 @@ namespace common {
             raw_index_type m_begin;
             raw_index_type m_size;
             uint32_t m_bufLen;
+            bool m_lockFree;
+            std::atomic<sequence_type> m_lockFreeEnd;
         };
+
+        inline IPCPutResult::~IPCPutResult() {
+            if (nullptr != lockFreeBookkeeping) {
+                lockFreeBookkeeping->commitLockFree(*lockFreeElement, seq);
+                return;
+            }
+#ifdef OSVR_SHM_LOCK_DEBUGGING
+            OSVR_DEV_VERBOSE("Releasing exclusive lock on sequence " << seq);
+#endif
+            elementLock.unlock();
+        }
     } // namespace detail
 
 } // namespace common
@@ -0,0 +1,221 @@
+/** @file
+    @brief Implementation
+
+    @date 2017
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2017 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// Internal Includes
+#include <osvr/Common/ImageLeaseManager.h>
+#include <osvr/Util/AlignedMemory.h>
+
+// Library/third-party includes
+// - none
+
+// Standard includes
+#include <algorithm>
+#include <cstring>
+#include <mutex>
+
+namespace osvr {
+namespace common {
+    static inline std::size_t getBufferSize(OSVR_ImagingMetadata const &meta) {
+        return meta.height * meta.width * meta.depth * meta.channels;
+    }
+
+    /// @brief A frame whose ring buffer entry the client holds, kept alive
+    /// by the buffer pointer delivered to the client.
+    struct ImageLeaseManager::Lease {
+        /// @brief Holds the ring entry: reset when revoked.
+        ImageBufferPtr pin;
+        /// @brief Keeps the memory mapped even once the entry is released.
+        shared_ptr<void> mapping;
+        OSVR_ImageBufferElement const *data;
+        util::time::TimeValue start;
+        bool revoked;
+    };
+
+    /// @brief Recycles the client-owned buffers frames are copied into. The
+    /// deleters of delivered copies share ownership of the pool, so they may
+    /// outlive the manager.
+    class ImageLeaseManager::BufferPool
+        : public enable_shared_from_this<BufferPool> {
+      public:
+        explicit BufferPool(std::size_t maxFree) : m_maxFree(maxFree) {}
+        ~BufferPool() { m_clear(); }
+
+        void setMaxFree(std::size_t maxFree) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_maxFree = maxFree;
+        }
+
+        ImageBufferPtr get(std::size_t bytes) {
+            void *buf = nullptr;
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if (bytes != m_bytes) {
+                    /// Frame size changed: the old buffers are no use.
+                    m_clear();
+                    m_bytes = bytes;
+                } else if (!m_free.empty()) {
+                    buf = m_free.back();
+                    m_free.pop_back();
+                }
+            }
+            if (!buf) {
+                buf = util::alignedAlloc(bytes);
+            }
+            auto self = shared_from_this();
+            return ImageBufferPtr(
+                static_cast<OSVR_ImageBufferElement *>(buf),
+                [self, bytes](OSVR_ImageBufferElement *p) {
+                    self->m_put(p, bytes);
+                });
+        }
+
+      private:
+        void m_put(void *buf, std::size_t bytes) {
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if (bytes == m_bytes && m_free.size() < m_maxFree) {
+                    m_free.push_back(buf);
+                    return;
+                }
+            }
+            util::alignedFree(buf);
+        }
+        void m_clear() {
+            for (auto buf : m_free) {
+                util::alignedFree(buf);
+            }
+            m_free.clear();
+        }
+        /// @brief Client code may free images from any thread.
+        std::mutex m_mutex;
+        std::size_t m_maxFree;
+        std::size_t m_bytes = 0;
+        std::vector<void *> m_free;
+    };
+
+    ImageLeaseManager::ImageLeaseManager()
+        : m_pool(make_shared<BufferPool>(m_policy.maxPinned)) {}
+
+    ImageLeaseManager::~ImageLeaseManager() {}
+
+    void ImageLeaseManager::setPolicy(ImageLeasePolicy const &policy) {
+        m_policy = policy;
+        m_overdue = false;
+        m_pool->setMaxFree(policy.maxPinned);
+    }
+
+    ImageBufferPtr ImageLeaseManager::lease(ImageData const &data,
+                                            util::time::TimeValue const &now) {
+        if (!data.mapping || !data.buffer) {
+            return data.buffer;
+        }
+        m_prune();
+        auto pinned = getStats().pinned;
+        if (m_policy.action == ImageLeaseAction::CopyOut &&
+            (m_overdue || pinned >= m_policy.maxPinned)) {
+            /// Over the limits: copy now, releasing the entry right away.
+            auto bytes = getBufferSize(data.metadata);
+            auto copy = m_pool->get(bytes);
+            std::memcpy(copy.get(), data.buffer.get(), bytes);
+            m_stats.copied++;
+            return copy;
+        }
+        if (m_policy.action == ImageLeaseAction::Revoke) {
+            /// Leases are kept oldest first.
+            for (auto &weak : m_leases) {
+                if (pinned < m_policy.maxPinned) {
+                    break;
+                }
+                auto lease = weak.lock();
+                if (lease && !lease->revoked) {
+                    m_revoke(*lease);
+                    --pinned;
+                }
+            }
+        }
+        auto lease = make_shared<Lease>();
+        lease->pin = data.buffer;
+        lease->mapping = data.mapping;
+        lease->data = data.buffer.get();
+        lease->start = now;
+        lease->revoked = false;
+        m_leases.push_back(lease);
+        /// Shares ownership of the lease, pointing at the frame.
+        return ImageBufferPtr(lease, data.buffer.get());
+    }
+
+    void ImageLeaseManager::update(util::time::TimeValue const &now) {
+        m_prune();
+        m_overdue = false;
+        for (auto &weak : m_leases) {
+            auto lease = weak.lock();
+            if (!lease || lease->revoked ||
+                util::time::duration(now, lease->start) < m_policy.deadline) {
+                continue;
+            }
+            if (m_policy.action == ImageLeaseAction::Revoke) {
+                m_revoke(*lease);
+            } else {
+                m_overdue = true;
+            }
+        }
+    }
+
+    bool
+    ImageLeaseManager::isRevoked(OSVR_ImageBufferElement const *buf) const {
+        for (auto &weak : m_leases) {
+            auto lease = weak.lock();
+            if (lease && lease->revoked && lease->data == buf) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    ImageLeaseStats ImageLeaseManager::getStats() const {
+        auto ret = m_stats;
+        ret.pinned = std::count_if(
+            m_leases.begin(), m_leases.end(), [](weak_ptr<Lease> const &weak) {
+                auto lease = weak.lock();
+                return lease && !lease->revoked;
+            });
+        return ret;
+    }
+
+    void ImageLeaseManager::m_prune() {
+        m_leases.erase(std::remove_if(m_leases.begin(), m_leases.end(),
+                                      [](weak_ptr<Lease> const &weak) {
+                                          return weak.expired();
+                                      }),
+                       m_leases.end());
+    }
+
+    void ImageLeaseManager::m_revoke(Lease &lease) {
+        lease.pin.reset();
+        lease.revoked = true;
+        m_stats.revoked++;
+    }
+} // namespace common
+} // namespace osvr
@@ -0,0 +1,146 @@
+/** @file
+    @brief Implementation
+
+    @date 2017
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2017 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include "ImagingCodec.h"
+
+// Library/third-party includes
+// - none
+
+// Standard includes
+#include <algorithm>
+
+namespace osvr {
+namespace common {
+    namespace imaging_codec {
+        /// The encoded stream is a sequence of control bytes, each followed by
+        /// its payload:
+        ///
+        /// - 0 to 127: a literal run of (control + 1) bytes follows.
+        /// - 128 to 255: a run of (control - 128 + MIN_ZERO_RUN) zero bytes,
+        ///   with no payload.
+        static const std::size_t MAX_LITERAL_RUN = 128;
+        static const std::size_t MIN_ZERO_RUN = 2;
+        static const std::size_t MAX_ZERO_RUN = 127 + MIN_ZERO_RUN;
+        static const uint8_t ZERO_RUN_FLAG = 0x80;
+
+        namespace {
+            /// @brief Accessor for the (possibly delta-transformed) input.
+            class Source {
+              public:
+                Source(uint8_t const *data, uint8_t const *reference)
+                    : m_data(data), m_reference(reference) {}
+                uint8_t operator[](std::size_t i) const {
+                    return m_reference
+                               ? static_cast<uint8_t>(m_data[i] -
+                                                      m_reference[i])
+                               : m_data[i];
+                }
+
+              private:
+                uint8_t const *m_data;
+                uint8_t const *m_reference;
+            };
+        } // namespace
+
+        bool encode(uint8_t const *data, uint8_t const *reference,
+                    std::size_t len, std::vector<uint8_t> &out) {
+            Source src(data, reference);
+            out.clear();
+            out.reserve(len);
+            std::size_t i = 0;
+            while (i < len) {
+                /// Count zeros here.
+                std::size_t zeros = 0;
+                while (i + zeros < len && zeros < MAX_ZERO_RUN &&
+                       src[i + zeros] == 0) {
+                    ++zeros;
+                }
+                if (zeros >= MIN_ZERO_RUN) {
+                    out.push_back(static_cast<uint8_t>(
+                        ZERO_RUN_FLAG | (zeros - MIN_ZERO_RUN)));
+                    i += zeros;
+                    continue;
+                }
+                /// Otherwise, gather literals until the next worthwhile run
+                /// of zeros.
+                std::size_t literals = 0;
+                while (i + literals < len && literals < MAX_LITERAL_RUN) {
+                    if (src[i + literals] == 0 && i + literals + 1 < len &&
+                        src[i + literals + 1] == 0) {
+                        break;
+                    }
+                    ++literals;
+                }
+                if (out.size() + 1 + literals >= len) {
+                    /// Not going to be a win.
+                    return false;
+                }
+                out.push_back(static_cast<uint8_t>(literals - 1));
+                for (std::size_t j = 0; j < literals; ++j) {
+                    out.push_back(src[i + j]);
+                }
+                i += literals;
+            }
+            return out.size() < len;
+        }
+
+        bool decode(uint8_t const *encoded, std::size_t encodedLen,
+                    uint8_t const *reference, uint8_t *out, std::size_t len) {
+            std::size_t in = 0;
+            std::size_t pos = 0;
+            while (in < encodedLen) {
+                auto control = encoded[in];
+                ++in;
+                if (control & ZERO_RUN_FLAG) {
+                    std::size_t zeros =
+                        (control & ~ZERO_RUN_FLAG) + MIN_ZERO_RUN;
+                    if (pos + zeros > len) {
+                        return false;
+                    }
+                    std::fill(out + pos, out + pos + zeros, uint8_t(0));
+                    pos += zeros;
+                } else {
+                    std::size_t literals = control + 1;
+                    if (pos + literals > len || in + literals > encodedLen) {
+                        return false;
+                    }
+                    std::copy(encoded + in, encoded + in + literals, out + pos);
+                    pos += literals;
+                    in += literals;
+                }
+            }
+            if (pos != len) {
+                return false;
+            }
+            if (reference) {
+                for (std::size_t i = 0; i < len; ++i) {
+                    out[i] = static_cast<uint8_t>(out[i] + reference[i]);
+                }
+            }
+            return true;
+        }
+    } // namespace imaging_codec
+} // namespace common
+} // namespace osvr
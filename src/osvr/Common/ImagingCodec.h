@@ -0,0 +1,78 @@
+/** @file
+    @brief Header for the simple lossless codec used to shrink image frames
+    sent over the network.
+
+    @date 2017
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2017 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_ImagingCodec_h_GUID_1AD656B1_5A83_4734_8CDA_46EC38A7CBE9
+#define INCLUDED_ImagingCodec_h_GUID_1AD656B1_5A83_4734_8CDA_46EC38A7CBE9
+
+// Internal Includes
+#include <osvr/Util/StdInt.h>
+
+// Library/third-party includes
+// - none
+
+// Standard includes
+#include <cstddef>
+#include <vector>
+
+namespace osvr {
+namespace common {
+    namespace imaging_codec {
+        /// @brief How the payload of a chunked network image is encoded.
+        enum Encoding : uint8_t {
+            /// @brief Raw image bytes.
+            ENCODING_RAW = 0,
+            /// @brief Zero-run-length encoded image bytes.
+            ENCODING_RLE = 1,
+            /// @brief Zero-run-length encoded byte-wise differences from a
+            /// previous frame.
+            ENCODING_DELTA_RLE = 2
+        };
+
+        /// @brief Run-length encodes runs of zero bytes in data (or, if
+        /// reference is not null, in the byte-wise difference between data
+        /// and reference - both len bytes long), replacing the contents of
+        /// out.
+        ///
+        /// Tracking camera frames are mostly black, and differences between
+        /// consecutive frames of a still scene are mostly zero, so this cheap
+        /// scheme often gives large reductions.
+        ///
+        /// @return false (leaving out in an unspecified state) if the encoded
+        /// form would not be smaller than len.
+        bool encode(uint8_t const *data, uint8_t const *reference,
+                    std::size_t len, std::vector<uint8_t> &out);
+
+        /// @brief Decodes the output of encode() into out (len bytes long),
+        /// adding reference (if not null, also len bytes long) byte-wise.
+        ///
+        /// @return false if the encoded data was malformed or didn't decode
+        /// to exactly len bytes.
+        bool decode(uint8_t const *encoded, std::size_t encodedLen,
+                    uint8_t const *reference, uint8_t *out, std::size_t len);
+    } // namespace imaging_codec
+} // namespace common
+} // namespace osvr
+
+#endif // INCLUDED_ImagingCodec_h_GUID_1AD656B1_5A83_4734_8CDA_46EC38A7CBE9
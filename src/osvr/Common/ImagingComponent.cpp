@@ -24,6 +24,7 @@
 
 // Internal Includes
 #include <osvr/Common/ImagingComponent.h>
+#include "ImagingCodec.h"
 #include <osvr/Common/BaseDevice.h>
 #include <osvr/Common/Serialization.h>
 #include <osvr/Common/Buffer.h>
@@ -35,14 +36,34 @@
 // - none
 
 // Standard includes
+#include <algorithm>
+#include <limits>
+#include <random>
 #include <sstream>
 #include <utility>
 
 namespace osvr {
 namespace common {
+#ifdef OSVR_COMMON_LOCK_FREE_IMAGING
+    static const bool LOCK_FREE_SHM = true;
+#else
+    static const bool LOCK_FREE_SHM = false;
+#endif
     static inline uint32_t getBufferSize(OSVR_ImagingMetadata const &meta) {
         return meta.height * meta.width * meta.depth * meta.channels;
     }
+    /// @brief getBufferSize() for metadata received from the network: returns
+    /// 0 if the size doesn't fit in 32 bits.
+    static inline uint32_t
+    getCheckedBufferSize(OSVR_ImagingMetadata const &meta) {
+        static const uint64_t MAX_SIZE = std::numeric_limits<uint32_t>::max();
+        uint64_t size = uint64_t(meta.height) * meta.width;
+        if (size > MAX_SIZE) {
+            return 0;
+        }
+        size *= uint64_t(meta.depth) * meta.channels;
+        return size > MAX_SIZE ? 0 : static_cast<uint32_t>(size);
+    }
     namespace messages {
         namespace {
             template <typename T>
@@ -193,15 +214,148 @@ namespace common {
         const char *ImagePlacedInSharedMemory::identifier() {
             return "com.osvr.imaging.imageplacedinsharedmemory";
         }
+
+        namespace {
+            /// @brief The header of each chunk of a chunked network frame:
+            /// the rest of the message is the chunk's piece of the encoded
+            /// frame. Multi-byte image elements are left in the sender's byte
+            /// order, as with shared memory.
+            struct ImageChunkHeader {
+                OSVR_ImagingMetadata metadata;
+                OSVR_ChannelCount sensor;
+                uint32_t frameId;
+                /// @brief For delta encoding, the frame it is relative to.
+                uint32_t referenceFrameId;
+                uint8_t encoding;
+                uint32_t encodedSize;
+                uint32_t offset;
+            };
+            template <typename T>
+            void process(ImageChunkHeader &header, T &p) {
+                process(header.metadata, p);
+                p(header.sensor);
+                p(header.frameId);
+                p(header.referenceFrameId);
+                p(header.encoding);
+                p(header.encodedSize);
+                p(header.offset);
+            }
+        } // namespace
+
+        class ImageChunk::MessageSerialization {
+          public:
+            MessageSerialization() {}
+            explicit MessageSerialization(ImageChunkHeader const &header)
+                : m_header(header) {}
+
+            template <typename T> void processMessage(T &p) {
+                process(m_header, p);
+            }
+
+            ImageChunkHeader const &getHeader() const { return m_header; }
+
+          private:
+            ImageChunkHeader m_header;
+        };
+
+        const char *ImageChunk::identifier() {
+            return "com.osvr.imaging.imagechunk";
+        }
+
+        class ImagingTransportRequest::MessageSerialization {
+          public:
+            MessageSerialization() : m_transports(0), m_clientId(0) {}
+            MessageSerialization(imaging_transport::TransportFlags transports,
+                                 uint32_t clientId)
+                : m_transports(transports), m_clientId(clientId) {}
+
+            template <typename T> void processMessage(T &p) {
+                p(m_transports);
+                p(m_clientId);
+            }
+
+            imaging_transport::TransportFlags getTransports() const {
+                return m_transports;
+            }
+
+            /// @brief Identifies the requesting client (process), so the
+            /// server can count how many transport-aware clients it has.
+            uint32_t getClientId() const { return m_clientId; }
+
+          private:
+            imaging_transport::TransportFlags m_transports;
+            uint32_t m_clientId;
+        };
+
+        const char *ImagingTransportRequest::identifier() {
+            return "com.osvr.imaging.transportrequest";
+        }
+
+        const char *VrpnGotConnection::identifier() {
+            return vrpn_got_connection;
+        }
+
+        const char *VrpnDroppedConnection::identifier() {
+            return vrpn_dropped_connection;
+        }
     } // namespace messages
 
+    /// @brief Maximum amount of encoded frame data in each chunk, leaving
+    /// plenty of room in the VRPN buffer for the headers.
+    static const std::size_t CHUNK_PAYLOAD_SIZE =
+        vrpn_CONNECTION_TCP_BUFLEN - 256;
+
+    /// @brief Maximum number of delta-encoded frames sent between frames that
+    /// can be decoded on their own, which bounds how long a client that
+    /// connects (or falls behind) waits for a picture.
+    static const uint32_t CHUNK_KEYFRAME_INTERVAL = 30;
+
+    /// @brief Highest number of sensors a client keeps chunk reassembly state
+    /// for, when it doesn't know the device's actual sensor count, so a bad
+    /// sensor number on the wire can't make it allocate without bound.
+    static const OSVR_ChannelCount MAX_CHUNKED_SENSORS = 64;
+
+    static inline bool sameMetadata(OSVR_ImagingMetadata const &a,
+                                    OSVR_ImagingMetadata const &b) {
+        return a.height == b.height && a.width == b.width &&
+               a.channels == b.channels && a.depth == b.depth &&
+               a.type == b.type;
+    }
+
+    /// @brief How often a client re-sends its transport request.
+    static const double TRANSPORT_REQUEST_INTERVAL = 1.0;
+
+    /// @brief How long a transport request remains in effect on the server,
+    /// if not refreshed (e.g. because the client disconnected)
+    static const double TRANSPORT_REQUEST_LEASE = 3.0;
+
+    /// @brief Random ID this process uses in its transport requests. One per
+    /// process rather than per component, since the server compares the
+    /// number of requesting clients to the number of connected endpoints.
+    static uint32_t getTransportRequestClientId() {
+        static const uint32_t clientId = [] {
+            std::random_device rd;
+            return static_cast<uint32_t>(rd());
+        }();
+        return clientId;
+    }
+
+#ifdef OSVR_COMMON_IN_PROCESS_IMAGING
+    static const imaging_transport::TransportFlags LOCAL_TRANSPORT =
+        imaging_transport::IN_PROCESS_MEMORY;
+#else
+    static const imaging_transport::TransportFlags LOCAL_TRANSPORT =
+        imaging_transport::SHARED_MEMORY;
+#endif
+
     shared_ptr<ImagingComponent>
     ImagingComponent::create(OSVR_ChannelCount numChan) {
         shared_ptr<ImagingComponent> ret(new ImagingComponent(numChan));
         return ret;
     }
     ImagingComponent::ImagingComponent(OSVR_ChannelCount numChan)
-        : m_numSensor(numChan) {}
+        : m_numSensor(numChan),
+          m_acceptedTransports(LOCAL_TRANSPORT | imaging_transport::NETWORK) {}
 
     void ImagingComponent::sendImageData(OSVR_ImagingMetadata metadata,
                                          OSVR_ImageBufferElement *imageData,
@@ -210,15 +364,19 @@ namespace common {
 
         util::Flag dataSent;
 
+        if (m_isTransportRequested(LOCAL_TRANSPORT)) {
 #ifdef OSVR_COMMON_IN_PROCESS_IMAGING
-        dataSent += m_sendImageDataViaInProcessMemory(metadata, imageData,
-                                                      sensor, timestamp);
+            dataSent += m_sendImageDataViaInProcessMemory(metadata, imageData,
+                                                          sensor, timestamp);
 #else
-        dataSent += m_sendImageDataViaSharedMemory(metadata, imageData, sensor,
-                                                   timestamp);
+            dataSent += m_sendImageDataViaSharedMemory(metadata, imageData,
+                                                       sensor, timestamp);
 #endif
-        dataSent +=
-            m_sendImageDataOnTheWire(metadata, imageData, sensor, timestamp);
+        }
+        if (m_isTransportRequested(imaging_transport::NETWORK)) {
+            dataSent += m_sendImageDataOnTheWire(metadata, imageData, sensor,
+                                                 timestamp);
+        }
         if (dataSent) {
             m_checkFirst(metadata);
         }
@@ -247,10 +405,49 @@ namespace common {
     }
 #endif
 
-    bool ImagingComponent::m_sendImageDataViaSharedMemory(
-        OSVR_ImagingMetadata metadata, OSVR_ImageBufferElement *imageData,
-        OSVR_ChannelCount sensor, OSVR_TimeValue const &timestamp) {
+    ImagingSharedMemoryFramePtr
+    ImagingComponent::acquireSharedMemoryFrame(OSVR_ImagingMetadata metadata,
+                                               OSVR_ChannelCount sensor) {
+        ImagingSharedMemoryFramePtr ret;
+#ifndef OSVR_COMMON_IN_PROCESS_IMAGING
+        if (!m_isTransportRequested(imaging_transport::SHARED_MEMORY)) {
+            return ret;
+        }
+        if (m_getShmBuf(metadata, sensor)) {
+            ret.reset(new ImagingSharedMemoryFrame(metadata, sensor,
+                                                   m_shmBuf[sensor]));
+        }
+#endif
+        return ret;
+    }
 
+    void
+    ImagingComponent::sendSharedMemoryFrame(ImagingSharedMemoryFramePtr &&frame,
+                                            OSVR_TimeValue const &timestamp) {
+        if (!frame) {
+            return;
+        }
+        auto metadata = frame->getMetadata();
+        auto sensor = frame->getSensor();
+        auto imageData = frame->getBuffer();
+        auto seq = frame->m_proxy.getSequenceNumber();
+        /// Keeps the ring (and so imageData) alive even if the sensor has
+        /// moved to a new ring since this frame was acquired.
+        IPCRingBufferPtr shm = frame->m_shm;
+        /// Release the entry to readers before notifying them. As the only
+        /// producer, we can keep reading the data until our next put.
+        frame.reset();
+
+        m_sendSharedMemoryMessage(metadata, seq, sensor, *shm, timestamp);
+        if (m_isTransportRequested(imaging_transport::NETWORK)) {
+            m_sendImageDataOnTheWire(metadata, imageData, sensor, timestamp);
+        }
+        m_checkFirst(metadata);
+    }
+
+    IPCRingBuffer *
+    ImagingComponent::m_getShmBuf(OSVR_ImagingMetadata const &metadata,
+                                  OSVR_ChannelCount sensor) {
         m_growShmVecIfRequired(sensor);
         uint32_t imageBufferSize = getBufferSize(metadata);
         if (!m_shmBuf[sensor] ||
@@ -265,16 +462,21 @@ namespace common {
             m_shmBuf[sensor] = IPCRingBuffer::create(
                 IPCRingBuffer::Options(
                     makeName(sensor, m_getParent().getDeviceName()))
-                    .setEntrySize(imageBufferSize));
+                    .setEntrySize(imageBufferSize)
+                    .setLockFree(LOCK_FREE_SHM));
         }
         if (!m_shmBuf[sensor]) {
             OSVR_DEV_VERBOSE(
                 "Some issue creating shared memory for imaging, skipping out.");
-            return false;
+            return nullptr;
         }
-        auto &shm = *(m_shmBuf[sensor]);
-        auto seq = shm.put(imageData, imageBufferSize);
+        return m_shmBuf[sensor].get();
+    }
 
+    void ImagingComponent::m_sendSharedMemoryMessage(
+        OSVR_ImagingMetadata const &metadata, IPCRingBuffer::sequence_type seq,
+        OSVR_ChannelCount sensor, IPCRingBuffer const &shm,
+        OSVR_TimeValue const &timestamp) {
         Buffer<> buf;
         messages::ImagePlacedInSharedMemory::MessageSerialization serialization(
             messages::SharedMemoryMessage{metadata, seq, sensor,
@@ -283,31 +485,105 @@ namespace common {
         serialize(buf, serialization);
         m_getParent().packMessage(
             buf, imagePlacedInSharedMemory.getMessageType(), timestamp);
+    }
+
+    bool ImagingComponent::m_sendImageDataViaSharedMemory(
+        OSVR_ImagingMetadata metadata, OSVR_ImageBufferElement *imageData,
+        OSVR_ChannelCount sensor, OSVR_TimeValue const &timestamp) {
 
+        auto shm = m_getShmBuf(metadata, sensor);
+        if (!shm) {
+            return false;
+        }
+        auto seq = shm->put(imageData, getBufferSize(metadata));
+        m_sendSharedMemoryMessage(metadata, seq, sensor, *shm, timestamp);
         return true;
     }
 
     bool ImagingComponent::m_sendImageDataOnTheWire(
         OSVR_ImagingMetadata metadata, OSVR_ImageBufferElement *imageData,
         OSVR_ChannelCount sensor, OSVR_TimeValue const &timestamp) {
-        /// @todo currently only handle 8bit data over network
-        if (metadata.depth != 1) {
-            return false;
+        /// Small 8-bit frames go in a single message that older clients also
+        /// understand.
+        if (metadata.depth == 1 &&
+            getBufferSize(metadata) < vrpn_CONNECTION_TCP_BUFLEN) {
+            Buffer<> buf;
+            messages::ImageRegion::MessageSerialization msg(metadata,
+                                                            imageData, sensor);
+            serialize(buf, msg);
+            if (buf.size() <= vrpn_CONNECTION_TCP_BUFLEN) {
+                m_getParent().packMessage(buf, imageRegion.getMessageType(),
+                                          timestamp);
+                m_getParent().sendPending();
+                return true;
+            }
         }
-        Buffer<> buf;
-        messages::ImageRegion::MessageSerialization msg(metadata, imageData,
-                                                        sensor);
-        serialize(buf, msg);
-        if (buf.size() > vrpn_CONNECTION_TCP_BUFLEN) {
-#if 0
-            OSVR_DEV_VERBOSE("Skipping imaging message: size is "
-                             << buf.size() << " vs the maximum of "
-                             << vrpn_CONNECTION_TCP_BUFLEN);
-#endif
+        if (!m_isTransportExplicitlyRequested(imaging_transport::NETWORK)) {
+            /// Only transport-aware clients can reassemble chunks, so don't
+            /// spend the time encoding them for anybody else.
             return false;
         }
-        m_getParent().packMessage(buf, imageRegion.getMessageType(), timestamp);
-        m_getParent().sendPending();
+        return m_sendImageDataInChunks(metadata, imageData, sensor, timestamp);
+    }
+
+    bool ImagingComponent::m_sendImageDataInChunks(
+        OSVR_ImagingMetadata const &metadata,
+        OSVR_ImageBufferElement const *imageData, OSVR_ChannelCount sensor,
+        OSVR_TimeValue const &timestamp) {
+        m_growChunkVecIfRequired(sensor);
+        auto &state = m_chunkState[sensor];
+        auto bytes = getBufferSize(metadata);
+
+        messages::ImageChunkHeader header;
+        header.metadata = metadata;
+        header.sensor = sensor;
+        header.frameId = state.frameId + 1;
+        header.referenceFrameId = 0;
+        header.encoding = imaging_codec::ENCODING_RAW;
+        header.encodedSize = bytes;
+        header.offset = 0;
+
+        bool canDelta = state.havePrevious &&
+                        sameMetadata(state.previousMetadata, metadata) &&
+                        state.framesSinceKeyframe < CHUNK_KEYFRAME_INTERVAL;
+        if (canDelta && imaging_codec::encode(imageData, state.previous.data(),
+                                              bytes, state.encoded)) {
+            header.encoding = imaging_codec::ENCODING_DELTA_RLE;
+            header.referenceFrameId = state.frameId;
+        } else if (imaging_codec::encode(imageData, nullptr, bytes,
+                                         state.encoded)) {
+            header.encoding = imaging_codec::ENCODING_RLE;
+        }
+
+        uint8_t const *payload = imageData;
+        if (header.encoding != imaging_codec::ENCODING_RAW) {
+            payload = state.encoded.data();
+            header.encodedSize = static_cast<uint32_t>(state.encoded.size());
+        }
+
+        while (header.offset < header.encodedSize) {
+            auto len = std::min<std::size_t>(
+                CHUNK_PAYLOAD_SIZE, header.encodedSize - header.offset);
+            Buffer<> buf;
+            messages::ImageChunk::MessageSerialization msg(header);
+            serialize(buf, msg);
+            buf.append(reinterpret_cast<char const *>(payload + header.offset),
+                       len);
+            m_getParent().packMessage(buf, imageChunk.getMessageType(),
+                                      timestamp);
+            m_getParent().sendPending();
+            header.offset += static_cast<uint32_t>(len);
+        }
+
+        /// Remember this frame for delta coding the next one.
+        state.frameId = header.frameId;
+        state.framesSinceKeyframe =
+            (header.encoding == imaging_codec::ENCODING_DELTA_RLE)
+                ? state.framesSinceKeyframe + 1
+                : 0;
+        state.previous.assign(imageData, imageData + bytes);
+        state.previousMetadata = metadata;
+        state.havePrevious = true;
         return true;
     }
 
@@ -328,6 +604,121 @@ namespace common {
         return 0;
     }
 
+    int VRPN_CALLBACK
+    ImagingComponent::m_handleImageChunk(void *userdata, vrpn_HANDLERPARAM p) {
+        auto self = static_cast<ImagingComponent *>(userdata);
+        auto bufReader = readExternalBuffer(p.buffer, p.payload_len);
+
+        messages::ImageChunk::MessageSerialization msg;
+        deserialize(bufReader, msg);
+        auto const &header = msg.getHeader();
+        auto len = bufReader.bytesRemaining();
+        auto payload = bufReader.readBytes(len);
+
+        if (header.sensor >= MAX_CHUNKED_SENSORS ||
+            (self->m_numSensor != 0 && header.sensor >= self->m_numSensor)) {
+            OSVR_DEV_VERBOSE("Image chunk for out-of-range sensor "
+                             << header.sensor << ", dropping it.");
+            return 0;
+        }
+        self->m_growChunkVecIfRequired(header.sensor);
+        auto &state = self->m_chunkState[header.sensor];
+        if (header.offset == 0) {
+            /// Start of a new frame. The sender only encodes a frame if that
+            /// makes it smaller, so don't trust (and allocate for) a larger
+            /// size than the frame itself.
+            if (header.encodedSize == 0 ||
+                header.encodedSize > getCheckedBufferSize(header.metadata)) {
+                OSVR_DEV_VERBOSE("Image chunk has an invalid frame size, "
+                                 "dropping the frame.");
+                state.assembling = false;
+                return 0;
+            }
+            state.assembling = true;
+            state.assemblingFrameId = header.frameId;
+            state.assemblingReferenceId = header.referenceFrameId;
+            state.assemblingEncoding = header.encoding;
+            state.assemblingEncodedSize = header.encodedSize;
+            state.assemblingMetadata = header.metadata;
+            state.encoded.clear();
+            state.encoded.reserve(header.encodedSize);
+        } else if (!state.assembling ||
+                   state.assemblingFrameId != header.frameId ||
+                   state.assemblingEncodedSize != header.encodedSize ||
+                   state.encoded.size() != header.offset) {
+            /// We missed the start of this frame: wait for the next.
+            state.assembling = false;
+            return 0;
+        }
+        if (state.encoded.size() + len > header.encodedSize) {
+            OSVR_DEV_VERBOSE("Image chunk overflows its frame, dropping it.");
+            state.assembling = false;
+            return 0;
+        }
+        state.encoded.insert(state.encoded.end(),
+                             reinterpret_cast<uint8_t const *>(&(*payload)),
+                             reinterpret_cast<uint8_t const *>(&(*payload)) +
+                                 len);
+        if (state.encoded.size() < header.encodedSize) {
+            /// More chunks to come.
+            return 0;
+        }
+        state.assembling = false;
+
+        auto const &metadata = state.assemblingMetadata;
+        auto bytes = getBufferSize(metadata);
+        auto imageBuffer = util::makeAlignedImageBuffer(bytes);
+        bool decoded = false;
+        switch (state.assemblingEncoding) {
+        case imaging_codec::ENCODING_RAW:
+            if (state.encoded.size() == bytes) {
+                std::copy(state.encoded.begin(), state.encoded.end(),
+                          imageBuffer.get());
+                decoded = true;
+            }
+            break;
+        case imaging_codec::ENCODING_RLE:
+            decoded = imaging_codec::decode(state.encoded.data(),
+                                            state.encoded.size(), nullptr,
+                                            imageBuffer.get(), bytes);
+            break;
+        case imaging_codec::ENCODING_DELTA_RLE:
+            if (state.havePrevious &&
+                state.frameId == state.assemblingReferenceId &&
+                sameMetadata(state.previousMetadata, metadata)) {
+                decoded = imaging_codec::decode(
+                    state.encoded.data(), state.encoded.size(),
+                    state.previous.data(), imageBuffer.get(), bytes);
+            }
+            break;
+        default:
+            OSVR_DEV_VERBOSE("Unrecognized image chunk encoding "
+                             << int(state.assemblingEncoding));
+            break;
+        }
+        if (!decoded) {
+            /// Can't use deltas until the next keyframe.
+            state.havePrevious = false;
+            return 0;
+        }
+        state.frameId = state.assemblingFrameId;
+        state.previous.assign(imageBuffer.get(), imageBuffer.get() + bytes);
+        state.previousMetadata = metadata;
+        state.havePrevious = true;
+
+        ImageData data;
+        data.sensor = header.sensor;
+        data.metadata = metadata;
+        data.buffer.reset(imageBuffer.release(), &util::alignedFree);
+        auto timestamp = util::time::fromStructTimeval(p.msg_time);
+
+        self->m_checkFirst(metadata);
+        for (auto const &cb : self->m_cb) {
+            cb(data, timestamp);
+        }
+        return 0;
+    }
+
 #ifdef OSVR_COMMON_IN_PROCESS_IMAGING
     int VRPN_CALLBACK ImagingComponent::m_handleImagePlacedInProcessMemory(
         void *userdata, vrpn_HANDLERPARAM p) {
@@ -346,6 +737,7 @@ namespace common {
         auto timestamp = util::time::fromStructTimeval(p.msg_time);
 
         self->m_checkFirst(msg.metadata);
+        self->m_setAcceptedTransports(imaging_transport::IN_PROCESS_MEMORY);
         for (auto const &cb : self->m_cb) {
             cb(data, timestamp);
         }
@@ -366,6 +758,7 @@ namespace common {
         if (IPCRingBuffer::getABILevel() != msg.abiLevel) {
             /// Can't interoperate with this server over shared memory
             OSVR_DEV_VERBOSE("Can't handle SHM ABI level " << msg.abiLevel);
+            self->m_setAcceptedTransports(imaging_transport::NETWORK);
             return 0;
         }
         self->m_growShmVecIfRequired(msg.sensor);
@@ -385,19 +778,25 @@ namespace common {
             /// client
             OSVR_DEV_VERBOSE("Can't find desired IPC ring buffer "
                              << msg.shmName);
+            self->m_setAcceptedTransports(imaging_transport::NETWORK);
             return 0;
         }
+        /// Shared memory works, so we don't need the network copies.
+        self->m_setAcceptedTransports(imaging_transport::SHARED_MEMORY);
 
         auto &shm = self->m_shmBuf[msg.sensor];
         auto getResult = shm->get(msg.seqNum);
         if (getResult) {
             auto bufptr = getResult.getBufferSmartPointer();
             self->m_checkFirst(msg.metadata);
-            auto data = ImageData{msg.sensor, msg.metadata, bufptr};
+            auto data = ImageData{msg.sensor, msg.metadata, bufptr, shm};
 
             for (auto const &cb : self->m_cb) {
                 cb(data, timestamp);
             }
+        } else {
+            /// The server has already lapped us.
+            self->m_droppedFrames++;
         }
         return 0;
     }
@@ -411,20 +810,135 @@ namespace common {
                 &ImagingComponent::m_handleImagePlacedInSharedMemory, this,
                 imagePlacedInSharedMemory.getMessageType());
 
+            m_registerHandler(&ImagingComponent::m_handleImageChunk, this,
+                              imageChunk.getMessageType());
+
 #ifdef OSVR_COMMON_IN_PROCESS_IMAGING
             m_registerHandler(
                 &ImagingComponent::m_handleImagePlacedInProcessMemory, this,
                 imagePlacedInProcessMemory.getMessageType());
 #endif
+            m_sendTransportRequest();
         }
         m_cb.push_back(handler);
     }
     void ImagingComponent::m_parentSet() {
         m_getParent().registerMessageType(imageRegion);
         m_getParent().registerMessageType(imagePlacedInSharedMemory);
+        m_getParent().registerMessageType(imageChunk);
 #ifdef OSVR_COMMON_IN_PROCESS_IMAGING
         m_getParent().registerMessageType(imagePlacedInProcessMemory);
 #endif
+        m_getParent().registerMessageType(transportRequest);
+        m_registerHandler(&ImagingComponent::m_handleTransportRequest, this,
+                          transportRequest.getMessageType());
+        m_getParent().registerMessageType(m_gotConnection);
+        m_registerAnySenderHandler(&ImagingComponent::m_handleGotConnection,
+                                   this, m_gotConnection.getMessageType());
+        m_getParent().registerMessageType(m_droppedConnection);
+        m_registerAnySenderHandler(
+            &ImagingComponent::m_handleDroppedConnection, this,
+            m_droppedConnection.getMessageType());
+    }
+
+    void ImagingComponent::m_update() {
+        if (m_cb.empty()) {
+            /// Not a client, or nobody to deliver images to anyway.
+            return;
+        }
+        auto now = util::time::getNow();
+        if (util::time::duration(now, m_lastTransportRequest) >
+            TRANSPORT_REQUEST_INTERVAL) {
+            m_sendTransportRequest();
+        }
+    }
+
+    bool ImagingComponent::m_isTransportRequested(
+        imaging_transport::TransportFlags transport) const {
+        return m_isLegacyClientConnected() ||
+               m_isTransportExplicitlyRequested(transport);
+    }
+
+    bool ImagingComponent::m_isTransportExplicitlyRequested(
+        imaging_transport::TransportFlags transport) const {
+        auto now = util::time::getNow();
+        for (auto const &req : m_transportRequests) {
+            if ((req.second.transports & transport) &&
+                util::time::duration(now, req.second.time) <
+                    TRANSPORT_REQUEST_LEASE) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool ImagingComponent::m_isLegacyClientConnected() const {
+        auto now = util::time::getNow();
+        auto requesters = std::count_if(
+            m_transportRequests.begin(), m_transportRequests.end(),
+            [&](std::pair<const uint32_t, TransportRequest> const &req) {
+                return util::time::duration(now, req.second.time) <
+                       TRANSPORT_REQUEST_LEASE;
+            });
+        return m_connectedEndpoints > static_cast<std::size_t>(requesters);
+    }
+
+    void ImagingComponent::m_setAcceptedTransports(
+        imaging_transport::TransportFlags transports) {
+        if (transports == m_acceptedTransports) {
+            return;
+        }
+        m_acceptedTransports = transports;
+        m_sendTransportRequest();
+    }
+
+    void ImagingComponent::m_sendTransportRequest() {
+        Buffer<> buf;
+        messages::ImagingTransportRequest::MessageSerialization msg(
+            m_acceptedTransports, getTransportRequestClientId());
+        serialize(buf, msg);
+        m_getParent().packMessage(buf, transportRequest.getMessageType());
+        util::time::getNow(m_lastTransportRequest);
+    }
+
+    int VRPN_CALLBACK ImagingComponent::m_handleTransportRequest(
+        void *userdata, vrpn_HANDLERPARAM p) {
+        auto self = static_cast<ImagingComponent *>(userdata);
+        auto bufReader = readExternalBuffer(p.buffer, p.payload_len);
+
+        messages::ImagingTransportRequest::MessageSerialization msg;
+        deserialize(bufReader, msg);
+
+        /// Use our own clock: the client's may not match.
+        auto now = util::time::getNow();
+        auto &requests = self->m_transportRequests;
+        for (auto it = requests.begin(); it != requests.end();) {
+            if (util::time::duration(now, it->second.time) >=
+                TRANSPORT_REQUEST_LEASE) {
+                it = requests.erase(it);
+            } else {
+                ++it;
+            }
+        }
+        requests[msg.getClientId()] =
+            TransportRequest{msg.getTransports(), now};
+        return 0;
+    }
+
+    int VRPN_CALLBACK
+    ImagingComponent::m_handleGotConnection(void *userdata, vrpn_HANDLERPARAM) {
+        auto self = static_cast<ImagingComponent *>(userdata);
+        self->m_connectedEndpoints++;
+        return 0;
+    }
+
+    int VRPN_CALLBACK ImagingComponent::m_handleDroppedConnection(
+        void *userdata, vrpn_HANDLERPARAM) {
+        auto self = static_cast<ImagingComponent *>(userdata);
+        if (self->m_connectedEndpoints > 0) {
+            self->m_connectedEndpoints--;
+        }
+        return 0;
     }
 
     void ImagingComponent::m_checkFirst(OSVR_ImagingMetadata const &metadata) {
@@ -441,5 +955,11 @@ namespace common {
             m_shmBuf.resize(sensor + 1);
         }
     }
+    void
+    ImagingComponent::m_growChunkVecIfRequired(OSVR_ChannelCount sensor) {
+        if (m_chunkState.size() <= sensor) {
+            m_chunkState.resize(sensor + 1);
+        }
+    }
 } // namespace common
 } // namespace osvr
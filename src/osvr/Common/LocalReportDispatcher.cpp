@@ -0,0 +1,55 @@
+/** @file
+    @brief Implementation
+
+    @date 2017
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2017 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// Internal Includes
+#include <osvr/Common/LocalReportDispatcher.h>
+
+// Library/third-party includes
+// - none
+
+// Standard includes
+// - none
+
+namespace osvr {
+namespace common {
+    LocalDeviceReportsPtr
+    LocalReportDispatcher::getPublisher(std::string const &deviceName) {
+        auto &ret = m_devices[deviceName];
+        if (!ret) {
+            ret = make_shared<LocalDeviceReports>();
+        }
+        return ret;
+    }
+
+    LocalDeviceReportsPtr
+    LocalReportDispatcher::getDevice(std::string const &deviceName) const {
+        auto it = m_devices.find(deviceName);
+        if (it == end(m_devices)) {
+            return LocalDeviceReportsPtr();
+        }
+        return it->second;
+    }
+} // namespace common
+} // namespace osvr
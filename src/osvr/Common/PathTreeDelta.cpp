@@ -0,0 +1,105 @@
+/** @file
+    @brief Implementation
+
+    @date 2017
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2017 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include <osvr/Common/PathTreeDelta.h>
+
+// Library/third-party includes
+// - none
+
+// Standard includes
+// - none
+
+namespace osvr {
+namespace common {
+    SerializedNodeMap mapNodesByPath(Json::Value const &nodes) {
+        SerializedNodeMap ret;
+        for (auto const &node : nodes) {
+            ret[node["path"].asString()] = node;
+        }
+        return ret;
+    }
+
+    Json::Value nodeMapToJson(SerializedNodeMap const &nodes) {
+        Json::Value ret(Json::arrayValue);
+        for (auto const &node : nodes) {
+            ret.append(node.second);
+        }
+        return ret;
+    }
+
+    PathTreeDelta makePathTreeDelta(SerializedNodeMap const &base,
+                                    SerializedNodeMap const &current,
+                                    std::uint32_t baseRevision,
+                                    std::uint32_t revision) {
+        PathTreeDelta ret;
+        ret.revision = revision;
+        ret.baseRevision = baseRevision;
+        /// Both maps are sorted by path, so a single merge-like pass will do.
+        auto oldIt = base.begin();
+        auto newIt = current.begin();
+        while (oldIt != base.end() || newIt != current.end()) {
+            if (newIt == current.end() ||
+                (oldIt != base.end() && oldIt->first < newIt->first)) {
+                ret.removed.push_back(oldIt->first);
+                ++oldIt;
+            } else if (oldIt == base.end() || newIt->first < oldIt->first) {
+                ret.upserted.push_back(newIt->second);
+                ++newIt;
+            } else {
+                if (oldIt->second != newIt->second) {
+                    ret.upserted.push_back(newIt->second);
+                }
+                ++oldIt;
+                ++newIt;
+            }
+        }
+        return ret;
+    }
+
+    PathTreeDelta makeFullPathTreeDelta(SerializedNodeMap const &current,
+                                        std::uint32_t revision) {
+        PathTreeDelta ret;
+        ret.revision = revision;
+        ret.upserted.reserve(current.size());
+        for (auto const &node : current) {
+            ret.upserted.push_back(node.second);
+        }
+        return ret;
+    }
+
+    void applyPathTreeDelta(SerializedNodeMap &nodes,
+                            PathTreeDelta const &delta) {
+        if (delta.isFull()) {
+            nodes.clear();
+        }
+        for (auto const &path : delta.removed) {
+            nodes.erase(path);
+        }
+        for (auto const &node : delta.upserted) {
+            nodes[node["path"].asString()] = node;
+        }
+    }
+} // namespace common
+} // namespace osvr
@@ -0,0 +1,348 @@
+/** @file
+    @brief Header
+
+    @date 2017
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2017 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_PathTreeNodeSerialization_h_GUID_4181ADDD_DFFD_4B4A_8717_CDB3BDEB33B0
+#define INCLUDED_PathTreeNodeSerialization_h_GUID_4181ADDD_DFFD_4B4A_8717_CDB3BDEB33B0
+
+// Internal Includes
+#include <osvr/Common/SerializationTraits.h>
+#include <osvr/Common/JSONSerializationTags.h>
+#include <osvr/Common/PathElementTypes.h>
+#include <osvr/Common/PathElementTools.h>
+
+// Library/third-party includes
+#include <json/value.h>
+
+// Standard includes
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace osvr {
+namespace common {
+    namespace serialization {
+        /// @brief Tag for the compact binary encoding of a single serialized
+        /// path tree node (a JSON object as produced by pathNodeToJson).
+        ///
+        /// A node is written as its path (length-prefixed), a one-byte index
+        /// into the table of element type names (or 0xff followed by the name
+        /// itself, for a type this build does not know), a one-byte count of
+        /// the remaining members, then for each member its name, a one-byte
+        /// kind, and the value in its native binary form. Members holding
+        /// arrays or objects (device descriptors) are carried as JSON text.
+        struct PathTreeNodeTag {};
+
+        /// @brief Tag for a length-prefixed list of nodes, each encoded using
+        /// PathTreeNodeTag.
+        struct PathTreeNodeListTag {};
+
+        namespace detail {
+            /// @brief The kinds of value a node member may hold on the wire.
+            enum class NodeMemberKind : std::uint8_t {
+                Null = 0,
+                Bool,
+                Int,
+                UInt,
+                Real,
+                String,
+                JsonText
+            };
+
+            static const std::uint8_t UNLISTED_ELEMENT_TYPE = 0xff;
+
+            /// @brief The element type names, in a fixed wire order: append
+            /// new ones, never reorder.
+            inline std::vector<std::string> const &elementTypeNames() {
+                using namespace elements;
+                static const std::vector<std::string> names = {
+                    getTypeName<NullElement>(),
+                    getTypeName<AliasElement>(),
+                    getTypeName<ArticulationElement>(),
+                    getTypeName<SensorElement>(),
+                    getTypeName<InterfaceElement>(),
+                    getTypeName<DeviceElement>(),
+                    getTypeName<PluginElement>(),
+                    getTypeName<StringElement>()};
+                return names;
+            }
+
+            inline std::uint8_t elementTypeIndex(std::string const &name) {
+                auto const &names = elementTypeNames();
+                for (std::size_t i = 0; i < names.size(); ++i) {
+                    if (names[i] == name) {
+                        return static_cast<std::uint8_t>(i);
+                    }
+                }
+                return UNLISTED_ELEMENT_TYPE;
+            }
+
+            inline NodeMemberKind getMemberKind(Json::Value const &val) {
+                switch (val.type()) {
+                case Json::nullValue:
+                    return NodeMemberKind::Null;
+                case Json::booleanValue:
+                    return NodeMemberKind::Bool;
+                case Json::intValue:
+                    return NodeMemberKind::Int;
+                case Json::uintValue:
+                    return NodeMemberKind::UInt;
+                case Json::realValue:
+                    return NodeMemberKind::Real;
+                case Json::stringValue:
+                    return NodeMemberKind::String;
+                default:
+                    return NodeMemberKind::JsonText;
+                }
+            }
+
+            /// @brief Calls `f(value, tag)` on the type name and each member
+            /// other than "path" and "type", with the tag that member is
+            /// serialized with - shared by serialization and space
+            /// computation so they cannot disagree.
+            template <typename F>
+            inline void visitNodeForSerialization(Json::Value const &node,
+                                                  F &&f) {
+                auto path = node["path"].asString();
+                f(path, DefaultSerializationTag<std::string>());
+                auto typeName = node["type"].asString();
+                auto typeIdx = elementTypeIndex(typeName);
+                f(typeIdx, DefaultSerializationTag<std::uint8_t>());
+                if (typeIdx == UNLISTED_ELEMENT_TYPE) {
+                    f(typeName, DefaultSerializationTag<std::string>());
+                }
+                std::vector<std::string> members;
+                for (auto const &name : node.getMemberNames()) {
+                    if (name != "path" && name != "type") {
+                        members.push_back(name);
+                    }
+                }
+                if (members.size() > 0xff) {
+                    throw std::length_error(
+                        "Too many members in path tree node to serialize!");
+                }
+                auto count = static_cast<std::uint8_t>(members.size());
+                f(count, DefaultSerializationTag<std::uint8_t>());
+                for (auto const &name : members) {
+                    f(name, DefaultSerializationTag<std::string>());
+                    auto const &val = node[name];
+                    auto kind = getMemberKind(val);
+                    auto kindByte = static_cast<std::uint8_t>(kind);
+                    f(kindByte, DefaultSerializationTag<std::uint8_t>());
+                    switch (kind) {
+                    case NodeMemberKind::Null:
+                        break;
+                    case NodeMemberKind::Bool: {
+                        std::uint8_t b = val.asBool() ? 1 : 0;
+                        f(b, DefaultSerializationTag<std::uint8_t>());
+                        break;
+                    }
+                    case NodeMemberKind::Int: {
+                        auto i = static_cast<std::int64_t>(val.asInt64());
+                        f(i, DefaultSerializationTag<std::int64_t>());
+                        break;
+                    }
+                    case NodeMemberKind::UInt: {
+                        auto u = static_cast<std::uint64_t>(val.asUInt64());
+                        f(u, DefaultSerializationTag<std::uint64_t>());
+                        break;
+                    }
+                    case NodeMemberKind::Real: {
+                        double d = val.asDouble();
+                        f(d, DefaultSerializationTag<double>());
+                        break;
+                    }
+                    case NodeMemberKind::String: {
+                        auto s = val.asString();
+                        f(s, DefaultSerializationTag<std::string>());
+                        break;
+                    }
+                    case NodeMemberKind::JsonText:
+                        f(val, DefaultSerializationTag<Json::Value>());
+                        break;
+                    }
+                }
+            }
+
+            template <typename BufferType> class NodeSerializeFunctor {
+              public:
+                NodeSerializeFunctor(BufferType &buf) : m_buf(buf) {}
+                template <typename T, typename Tag>
+                void operator()(T const &val, Tag const &tag) {
+                    serializeRaw(m_buf, val, tag);
+                }
+
+              private:
+                BufferType &m_buf;
+            };
+
+            class NodeSpaceRequirementFunctor {
+              public:
+                NodeSpaceRequirementFunctor(std::size_t existingBytes)
+                    : m_existing(existingBytes), m_bytes(0) {}
+                template <typename T, typename Tag>
+                void operator()(T const &val, Tag const &tag) {
+                    m_bytes += getBufferSpaceRequiredRaw(m_existing + m_bytes,
+                                                         val, tag);
+                }
+                std::size_t get() const { return m_bytes; }
+
+              private:
+                std::size_t m_existing;
+                std::size_t m_bytes;
+            };
+
+            template <typename T, typename BufferReaderType>
+            inline T readNodeValue(BufferReaderType &reader) {
+                T ret;
+                deserializeRaw(reader, ret);
+                return ret;
+            }
+        } // namespace detail
+
+        template <>
+        struct SerializationTraits<PathTreeNodeTag, void>
+            : BaseSerializationTraits<Json::Value> {
+            typedef BaseSerializationTraits<Json::Value> Base;
+            typedef PathTreeNodeTag tag_type;
+
+            template <typename BufferType>
+            static void serialize(BufferType &buf, Base::param_type val,
+                                  tag_type const &) {
+                detail::visitNodeForSerialization(
+                    val, detail::NodeSerializeFunctor<BufferType>(buf));
+            }
+
+            template <typename BufferReaderType>
+            static void deserialize(BufferReaderType &reader,
+                                    Base::reference_type val,
+                                    tag_type const &) {
+                using detail::NodeMemberKind;
+                using detail::readNodeValue;
+                val = Json::Value(Json::objectValue);
+                val["path"] = readNodeValue<std::string>(reader);
+                auto typeIdx = readNodeValue<std::uint8_t>(reader);
+                auto const &names = detail::elementTypeNames();
+                if (typeIdx == detail::UNLISTED_ELEMENT_TYPE) {
+                    val["type"] = readNodeValue<std::string>(reader);
+                } else if (typeIdx < names.size()) {
+                    val["type"] = names[typeIdx];
+                } else {
+                    throw std::runtime_error(
+                        "Unknown element type index in path tree node!");
+                }
+                auto count = readNodeValue<std::uint8_t>(reader);
+                for (std::uint8_t i = 0; i < count; ++i) {
+                    auto name = readNodeValue<std::string>(reader);
+                    auto kind = static_cast<NodeMemberKind>(
+                        readNodeValue<std::uint8_t>(reader));
+                    auto &member = val[name];
+                    switch (kind) {
+                    case NodeMemberKind::Null:
+                        member = Json::nullValue;
+                        break;
+                    case NodeMemberKind::Bool:
+                        member = (readNodeValue<std::uint8_t>(reader) != 0);
+                        break;
+                    case NodeMemberKind::Int:
+                        member = static_cast<Json::Int64>(
+                            readNodeValue<std::int64_t>(reader));
+                        break;
+                    case NodeMemberKind::UInt:
+                        member = static_cast<Json::UInt64>(
+                            readNodeValue<std::uint64_t>(reader));
+                        break;
+                    case NodeMemberKind::Real:
+                        member = readNodeValue<double>(reader);
+                        break;
+                    case NodeMemberKind::String:
+                        member = readNodeValue<std::string>(reader);
+                        break;
+                    case NodeMemberKind::JsonText:
+                        member = readNodeValue<Json::Value>(reader);
+                        break;
+                    default:
+                        throw std::runtime_error(
+                            "Unknown member kind in path tree node!");
+                    }
+                }
+            }
+
+            static size_t spaceRequired(size_t existingBytes,
+                                        Base::param_type val,
+                                        tag_type const &) {
+                detail::NodeSpaceRequirementFunctor f(existingBytes);
+                detail::visitNodeForSerialization(val, f);
+                return f.get();
+            }
+        };
+
+        template <>
+        struct SerializationTraits<PathTreeNodeListTag, void>
+            : BaseSerializationTraits<std::vector<Json::Value> > {
+            typedef BaseSerializationTraits<std::vector<Json::Value> > Base;
+            typedef PathTreeNodeListTag tag_type;
+            typedef std::vector<Json::Value> value_type;
+            typedef value_type const &param_type;
+            typedef value_type &reference_type;
+
+            template <typename BufferType>
+            static void serialize(BufferType &buf, param_type val,
+                                  tag_type const &) {
+                serializeRaw(buf, static_cast<uint32_t>(val.size()));
+                for (auto const &node : val) {
+                    serializeRaw(buf, node, PathTreeNodeTag());
+                }
+            }
+
+            template <typename BufferReaderType>
+            static void deserialize(BufferReaderType &reader,
+                                    reference_type val, tag_type const &) {
+                uint32_t n;
+                deserializeRaw(reader, n);
+                val.clear();
+                val.reserve(n);
+                for (uint32_t i = 0; i < n; ++i) {
+                    val.emplace_back();
+                    deserializeRaw(reader, val.back(), PathTreeNodeTag());
+                }
+            }
+
+            static size_t spaceRequired(size_t existingBytes, param_type val,
+                                        tag_type const &) {
+                size_t bytes = existingBytes;
+                bytes += getBufferSpaceRequiredRaw(
+                    bytes, static_cast<uint32_t>(val.size()));
+                for (auto const &node : val) {
+                    bytes += getBufferSpaceRequiredRaw(bytes, node,
+                                                       PathTreeNodeTag());
+                }
+                return bytes - existingBytes;
+            }
+        };
+    } // namespace serialization
+} // namespace common
+} // namespace osvr
+
+#endif // INCLUDED_PathTreeNodeSerialization_h_GUID_4181ADDD_DFFD_4B4A_8717_CDB3BDEB33B0
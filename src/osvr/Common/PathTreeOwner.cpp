@@ -25,6 +25,7 @@
 // Internal Includes
 #include <osvr/Common/PathTreeOwner.h>
 #include <osvr/Common/PathTreeObserver.h>
+#include <osvr/Common/PathTreeDelta.h>
 #include <osvr/Common/PathTreeSerialization.h>
 
 // Library/third-party includes
@@ -33,6 +34,7 @@
 // Standard includes
 #include <algorithm>
 #include <iterator>
+#include <utility>
 
 namespace osvr {
 namespace common {
@@ -71,7 +73,44 @@ namespace common {
         return ret;
     }
 
+    /// @brief Compare two sets of serialized nodes, keyed by path.
+    static inline PathTreeDiff
+    diffNodes(std::map<std::string, Json::Value> const &oldNodes,
+              std::map<std::string, Json::Value> const &newNodes) {
+        PathTreeDiff ret;
+        /// Both maps are sorted by path, so a single merge-like pass will do.
+        auto oldIt = oldNodes.begin();
+        auto newIt = newNodes.begin();
+        while (oldIt != oldNodes.end() || newIt != newNodes.end()) {
+            if (newIt == newNodes.end() ||
+                (oldIt != oldNodes.end() && oldIt->first < newIt->first)) {
+                ret.removed.insert(oldIt->first);
+                ++oldIt;
+            } else if (oldIt == oldNodes.end() ||
+                       newIt->first < oldIt->first) {
+                ret.added.insert(newIt->first);
+                ++newIt;
+            } else {
+                if (oldIt->second != newIt->second) {
+                    ret.changed.insert(newIt->first);
+                }
+                ++oldIt;
+                ++newIt;
+            }
+        }
+        return ret;
+    }
+
     void PathTreeOwner::replaceTree(Json::Value const &nodes) {
+        auto nodesByPath = mapNodesByPath(nodes);
+        auto diff = diffNodes(m_nodesByPath, nodesByPath);
+        if (m_valid && diff.empty()) {
+            /// Nothing to do - don't disturb anyone.
+            return;
+        }
+        m_lastDiff = std::move(diff);
+        m_nodesByPath = std::move(nodesByPath);
+
         for_each_cleanup_pointers(
             m_observers, [&](PathTreeObserver const &observer) {
                 observer.notifyEvent(PathTreeEvents::AboutToUpdate, m_tree);
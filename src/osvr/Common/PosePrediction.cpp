@@ -0,0 +1,162 @@
+/** @file
+    @brief Implementation
+
+    @date 2017
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2017 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include <osvr/Common/PosePrediction.h>
+#include <osvr/Util/EigenInterop.h>
+#include <osvr/Util/EigenQuatExponentialMap.h>
+
+// Library/third-party includes
+// - none
+
+// Standard includes
+#include <algorithm>
+
+namespace osvr {
+namespace common {
+    namespace ei = util::eigen_interop;
+
+    /// @brief Incremental rotations (room-space, over dt seconds) to and from
+    /// room-space rotation vectors (axis times angle). The quaternion
+    /// exponential map works in half-angles, hence the factors of 2.
+    ///
+    /// q and -q are the same rotation, but quat_ln gives the long way around
+    /// (an angle near 2 pi) for negative w, so flip into the positive-w
+    /// hemisphere first.
+    static inline Eigen::Vector3d
+    quatToRotationVector(Eigen::Quaterniond inc) {
+        if (inc.w() < 0) {
+            inc.coeffs() *= -1;
+        }
+        return util::quat_ln(inc) * 2.;
+    }
+    static inline Eigen::Vector3d
+    incRotToRotationVector(OSVR_IncrementalQuaternion const &inc) {
+        return quatToRotationVector(ei::map(inc.incrementalRotation).quat());
+    }
+    static inline Eigen::Quaterniond
+    rotationVectorToIncRot(Eigen::Vector3d const &rotVec) {
+        return util::quat_exp(rotVec * 0.5).normalized();
+    }
+
+    /// @brief Gets a derivative state if it exists and is no older than the
+    /// pose it would be applied to.
+    template <typename ReportType>
+    static inline bool
+    getFreshState(InterfaceState const &state,
+                  util::time::TimeValue const &poseTime,
+                  traits::StateFromReport_t<ReportType> &out) {
+        if (!state.hasState<ReportType>()) {
+            return false;
+        }
+        util::time::TimeValue timestamp;
+        state.getState<ReportType>(timestamp, out);
+        return !osvrTimeValueGreater(&poseTime, &timestamp);
+    }
+
+    bool predictPoseState(InterfaceState const &state,
+                          util::time::TimeValue const &targetTime,
+                          util::time::TimeValue &reportTime,
+                          OSVR_PoseState &pose) {
+        if (!state.hasState<OSVR_PoseReport>()) {
+            return false;
+        }
+        util::time::TimeValue poseTime;
+        OSVR_PoseState latest;
+        state.getState<OSVR_PoseReport>(poseTime, latest);
+        reportTime = poseTime;
+        pose = latest;
+
+        auto const dt = std::min(util::time::duration(targetTime, poseTime),
+                                 MAX_POSE_PREDICTION_INTERVAL);
+        if (dt <= 0) {
+            return true;
+        }
+
+        Eigen::Vector3d linVel = Eigen::Vector3d::Zero();
+        Eigen::Vector3d angVel = Eigen::Vector3d::Zero();
+        bool haveLinVel = false;
+        bool haveAngVel = false;
+
+        OSVR_VelocityState vel;
+        if (getFreshState<OSVR_VelocityReport>(state, poseTime, vel)) {
+            if (vel.linearVelocityValid) {
+                linVel = ei::map(vel.linearVelocity);
+                haveLinVel = true;
+            }
+            if (vel.angularVelocityValid && vel.angularVelocity.dt > 0) {
+                angVel = incRotToRotationVector(vel.angularVelocity) /
+                         vel.angularVelocity.dt;
+                haveAngVel = true;
+            }
+        }
+
+        if (!haveLinVel || !haveAngVel) {
+            /// Fall back to a finite difference against the previous pose, as
+            /// long as it is recent enough to still describe current motion.
+            util::time::TimeValue prevTime;
+            OSVR_PoseState prev;
+            if (state.getPreviousPoseState(prevTime, prev)) {
+                auto const h = util::time::duration(poseTime, prevTime);
+                if (h > 0 && h <= MAX_POSE_PREDICTION_INTERVAL) {
+                    if (!haveLinVel) {
+                        linVel = (ei::map(latest.translation) -
+                                  ei::map(prev.translation)) /
+                                 h;
+                    }
+                    if (!haveAngVel) {
+                        Eigen::Quaterniond inc =
+                            ei::map(latest.rotation).quat() *
+                            ei::map(prev.rotation).quat().conjugate();
+                        angVel = quatToRotationVector(inc) / h;
+                    }
+                }
+            }
+        }
+
+        Eigen::Vector3d translation = linVel * dt;
+        Eigen::Vector3d rotation = angVel * dt;
+
+        OSVR_AccelerationState acc;
+        if (getFreshState<OSVR_AccelerationReport>(state, poseTime, acc)) {
+            if (acc.linearAccelerationValid) {
+                translation += 0.5 * dt * dt * ei::map(acc.linearAcceleration);
+            }
+            if (acc.angularAccelerationValid &&
+                acc.angularAcceleration.dt > 0) {
+                rotation += 0.5 * dt * dt *
+                            incRotToRotationVector(acc.angularAcceleration) /
+                            acc.angularAcceleration.dt;
+            }
+        }
+
+        ei::map(pose.translation) = ei::map(latest.translation) + translation;
+        ei::map(pose.rotation) = (rotationVectorToIncRot(rotation) *
+                                  ei::map(latest.rotation).quat())
+                                     .normalized();
+        return true;
+    }
+
+} // namespace common
+} // namespace osvr
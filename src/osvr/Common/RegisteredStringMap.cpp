@@ -30,10 +30,25 @@
 #include <boost/algorithm/string.hpp>
 
 // Standard includes
+#include <algorithm>
 #include <iostream>
 
 namespace osvr {
 namespace common {
+    namespace {
+        /// @brief FNV-1a: cheap, and good enough for short identifier-like
+        /// strings.
+        inline std::uint32_t hashString(boost::string_ref str) {
+            std::uint32_t hash = 2166136261u;
+            for (auto c : str) {
+                hash ^= static_cast<unsigned char>(c);
+                hash *= 16777619u;
+            }
+            return hash;
+        }
+        /// @brief Index size on first insert: must be a power of two.
+        const std::size_t MIN_INDEX_SLOTS = 16;
+    } // namespace
 
     /// @brief helper function to print size and contents of the map
     void RegisteredStringMap::printCurrentMap() {
@@ -47,33 +62,84 @@ namespace common {
     }
 
     util::StringID
-    RegisteredStringMap::registerStringID(std::string const &str) {
-        auto entry = std::find(begin(m_regEntries), end(m_regEntries), str);
-        if (end(m_regEntries) != entry) {
+    RegisteredStringMap::registerStringID(boost::string_ref str) {
+        auto hash = hashString(str);
+        auto idx = m_find(str, hash);
+        if (idx != m_regEntries.size()) {
             // we found it.
-            return util::StringID(std::distance(begin(m_regEntries), entry));
+            return util::StringID(idx);
         }
 
         // we didn't find an entry in the registry so we'll add a new one
         auto ret = util::StringID(
             m_regEntries.size()); // will be the location of the next insert.
-        m_regEntries.push_back(str);
+        m_regEntries.emplace_back(str.begin(), str.end());
+        m_hashes.push_back(hash);
+        m_indexLastEntry();
         m_modified = true;
         return ret;
     }
 
     util::StringID
-    RegisteredStringMap::getStringID(std::string const &str) const {
-
-        auto entry = std::find(begin(m_regEntries), end(m_regEntries), str);
-        if (end(m_regEntries) != entry) {
+    RegisteredStringMap::getStringID(boost::string_ref str) const {
+        auto idx = m_find(str, hashString(str));
+        if (idx != m_regEntries.size()) {
             // we found it.
-            return util::StringID(std::distance(begin(m_regEntries), entry));
+            return util::StringID(idx);
         }
         // we did not find an entry with given string
         return util::StringID();
     }
 
+    std::size_t RegisteredStringMap::m_find(boost::string_ref str,
+                                            std::uint32_t hash) const {
+        auto const notFound = m_regEntries.size();
+        if (m_index.empty()) {
+            return notFound;
+        }
+        auto const mask = m_index.size() - 1;
+        for (auto slot = hash & mask;; slot = (slot + 1) & mask) {
+            auto const entry = m_index[slot];
+            if (0 == entry) {
+                return notFound;
+            }
+            auto const idx = entry - 1;
+            if (m_hashes[idx] == hash &&
+                str == boost::string_ref(m_regEntries[idx])) {
+                return idx;
+            }
+        }
+    }
+
+    void RegisteredStringMap::m_indexLastEntry() {
+        // Keep the load factor at or under one half, so probe sequences stay
+        // short.
+        if (m_regEntries.size() * 2 > m_index.size()) {
+            m_rebuildIndex(std::max(MIN_INDEX_SLOTS, m_index.size() * 2));
+            return;
+        }
+        auto const idx = m_regEntries.size() - 1;
+        auto const mask = m_index.size() - 1;
+        auto slot = m_hashes[idx] & mask;
+        while (0 != m_index[slot]) {
+            slot = (slot + 1) & mask;
+        }
+        m_index[slot] = static_cast<std::uint32_t>(idx + 1);
+    }
+
+    void RegisteredStringMap::m_rebuildIndex(std::size_t slots) {
+        m_index.assign(slots, 0);
+        auto const mask = slots - 1;
+        auto const n = m_regEntries.size();
+        for (std::size_t idx = 0; idx < n; ++idx) {
+            auto slot = m_hashes[idx] & mask;
+            while (0 != m_index[slot]) {
+                slot = (slot + 1) & mask;
+            }
+            m_index[slot] = static_cast<std::uint32_t>(idx + 1);
+        }
+    }
+
     std::string RegisteredStringMap::getStringFromId(util::StringID id) const {
 
         // requested non-existent ID (include sanity check)
@@ -93,11 +159,12 @@ namespace common {
     }
 
     util::StringID
-    CorrelatedStringMap::registerStringID(std::string const &str) {
+    CorrelatedStringMap::registerStringID(boost::string_ref str) {
         return m_local.registerStringID(str);
     }
 
-    util::StringID CorrelatedStringMap::getStringID(std::string const &str) const{
+    util::StringID
+    CorrelatedStringMap::getStringID(boost::string_ref str) const {
         return m_local.getStringID(str);
     }
 
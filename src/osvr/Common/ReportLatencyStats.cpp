@@ -0,0 +1,149 @@
+/** @file
+    @brief Implementation
+
+    @date 2017
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2017 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include <osvr/Common/ReportLatencyStats.h>
+
+// Library/third-party includes
+// - none
+
+// Standard includes
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace osvr {
+namespace common {
+
+    /// @brief Signed difference a - b in microseconds.
+    static inline std::int64_t
+    microsecondsBetween(util::time::TimeValue const &a,
+                        util::time::TimeValue const &b) {
+        return (static_cast<std::int64_t>(a.seconds) - b.seconds) * 1000000 +
+               (static_cast<std::int64_t>(a.microseconds) - b.microseconds);
+    }
+
+    ReportLatencyStats::ReportLatencyStats() { reset(); }
+
+    void ReportLatencyStats::recordReport(
+        util::time::TimeValue const &reportTime,
+        util::time::TimeValue const &receivedTime) {
+        /// Clock skew can make a report appear to come from the future: the
+        /// best we can say about it is that it took no time at all.
+        auto const age = std::max<std::int64_t>(
+            0, microsecondsBetween(receivedTime, reportTime));
+        if (m_count == 0) {
+            m_firstReceived = receivedTime;
+            m_max = age;
+        } else {
+            m_max = std::max(m_max, age);
+            if (microsecondsBetween(reportTime, m_lastReportTime) < 0) {
+                ++m_outOfOrder;
+            }
+        }
+        ++m_count;
+        ++m_bins[binForLatency(age)];
+        m_lastReceived = receivedTime;
+        m_lastReportTime = reportTime;
+    }
+
+    void ReportLatencyStats::reset() {
+        m_bins.fill(0);
+        m_count = 0;
+        m_outOfOrder = 0;
+        m_max = 0;
+        m_firstReceived = util::time::TimeValue{};
+        m_lastReceived = util::time::TimeValue{};
+        m_lastReportTime = util::time::TimeValue{};
+    }
+
+    double ReportLatencyStats::getReportRate() const {
+        if (m_count < 2) {
+            return 0;
+        }
+        auto const elapsed =
+            microsecondsBetween(m_lastReceived, m_firstReceived);
+        if (elapsed <= 0) {
+            return 0;
+        }
+        return (m_count - 1) * 1.0e6 / elapsed;
+    }
+
+    std::int64_t
+    ReportLatencyStats::getLatencyPercentile(double fraction) const {
+        if (m_count == 0) {
+            return 0;
+        }
+        fraction = std::min(std::max(fraction, 0.), 1.);
+        auto const target = std::max<std::uint64_t>(
+            1, static_cast<std::uint64_t>(std::ceil(fraction * m_count)));
+        std::uint64_t seen = 0;
+        for (std::size_t bin = 0; bin < NUM_BINS; ++bin) {
+            seen += m_bins[bin];
+            if (seen >= target) {
+                /// The bin's upper bound can overshoot the largest age
+                /// actually seen.
+                return std::min(upperBoundForBin(bin), m_max);
+            }
+        }
+        return m_max;
+    }
+
+    std::size_t ReportLatencyStats::binForLatency(std::int64_t usec) {
+        std::int64_t limit = 1000;
+        if (usec < limit) {
+            return static_cast<std::size_t>(usec / 10);
+        }
+        std::size_t base = FIRST_DECADE_BINS;
+        for (int decade = 1; decade < DECADES; ++decade) {
+            auto const lower = limit;
+            limit *= 10;
+            if (usec < limit) {
+                return base + static_cast<std::size_t>((usec - lower) /
+                                                       (limit / 100));
+            }
+            base += DECADE_BINS;
+        }
+        return NUM_BINS - 1;
+    }
+
+    std::int64_t ReportLatencyStats::upperBoundForBin(std::size_t bin) {
+        if (bin < FIRST_DECADE_BINS) {
+            return static_cast<std::int64_t>(bin + 1) * 10;
+        }
+        bin -= FIRST_DECADE_BINS;
+        std::int64_t lower = 1000;
+        for (int decade = 1; decade < DECADES; ++decade) {
+            if (bin < DECADE_BINS) {
+                return lower + static_cast<std::int64_t>(bin + 1) * lower / 10;
+            }
+            bin -= DECADE_BINS;
+            lower *= 10;
+        }
+        /// Overflow bin: no upper bound.
+        return std::numeric_limits<std::int64_t>::max();
+    }
+
+} // namespace common
+} // namespace osvr
@@ -30,12 +30,14 @@
 #include <osvr/Common/JSONSerializationTags.h>
 #include <osvr/Common/Buffer.h>
 #include <osvr/Common/PathTreeSerialization.h>
+#include "PathTreeNodeSerialization.h"
+#include <osvr/Util/Verbosity.h>
 
 // Library/third-party includes
 #include <json/value.h>
 
 // Standard includes
-// - none
+#include <exception>
 
 namespace osvr {
 namespace common {
@@ -93,6 +95,57 @@ namespace common {
         const char *ReplacementTreeFromServer::identifier() {
             return "com.osvr.system.ReplacementTreeFromServer";
         }
+
+        class PathTreeDeltaFromServer::MessageSerialization {
+          public:
+            /// @brief Bumped whenever the layout below changes incompatibly.
+            static const uint8_t FORMAT_VERSION = 1;
+
+            MessageSerialization(PathTreeDelta const &delta = PathTreeDelta())
+                : m_version(FORMAT_VERSION), m_delta(delta) {}
+
+            template <typename T> void processMessage(T &p) {
+                p(m_version);
+                if (p.isDeserialize() && m_version != FORMAT_VERSION) {
+                    // Don't try to interpret the rest.
+                    return;
+                }
+                p(m_delta.revision);
+                p(m_delta.baseRevision);
+                p(m_delta.removed);
+                p(m_delta.upserted, serialization::PathTreeNodeListTag());
+            }
+
+            bool isSupportedVersion() const {
+                return m_version == FORMAT_VERSION;
+            }
+            PathTreeDelta const &getDelta() const { return m_delta; }
+
+          private:
+            uint8_t m_version;
+            PathTreeDelta m_delta;
+        };
+        const char *PathTreeDeltaFromServer::identifier() {
+            return "com.osvr.system.PathTreeDeltaFromServer";
+        }
+
+        class TreeRevisionAckToServer::MessageSerialization {
+          public:
+            MessageSerialization(uint32_t revision = 0)
+                : m_revision(revision) {}
+
+            template <typename T> void processMessage(T &p) {
+                p(m_revision);
+            }
+
+            uint32_t getRevision() const { return m_revision; }
+
+          private:
+            uint32_t m_revision;
+        };
+        const char *TreeRevisionAckToServer::identifier() {
+            return "com.osvr.system.TreeRevisionAckToServer";
+        }
     } // namespace messages
 
     const char *SystemComponent::deviceName() {
@@ -131,33 +184,71 @@ namespace common {
     }
 
     void SystemComponent::sendReplacementTree(PathTree &tree) {
-        auto config = pathTreeToJson(tree);
+        sendReplacementTree(pathTreeToJson(tree));
+    }
+
+    void SystemComponent::sendReplacementTree(Json::Value const &nodes) {
         Buffer<> buf;
-        messages::ReplacementTreeFromServer::MessageSerialization msg(config);
+        messages::ReplacementTreeFromServer::MessageSerialization msg(nodes);
         serialize(buf, msg);
         m_getParent().packMessage(buf, treeOut.getMessageType());
 
         m_getParent().sendPending(); // forcing this since it will cause
                                      // shuffling of remotes on the client.
     }
+
     void SystemComponent::registerReplaceTreeHandler(JsonHandler cb) {
         if (m_replaceTreeHandlers.empty()) {
             m_registerHandler(&SystemComponent::m_handleReplaceTree, this,
                               treeOut.getMessageType());
+            m_registerHandler(&SystemComponent::m_handlePathTreeDelta, this,
+                              treeDeltaOut.getMessageType());
         }
         m_replaceTreeHandlers.push_back(cb);
     }
 
+    void SystemComponent::sendPathTreeDelta(PathTreeDelta const &delta) {
+        Buffer<> buf;
+        messages::PathTreeDeltaFromServer::MessageSerialization msg(delta);
+        serialize(buf, msg);
+        m_getParent().packMessage(buf, treeDeltaOut.getMessageType());
+
+        m_getParent().sendPending(); // see sendReplacementTree
+    }
+
+    void SystemComponent::sendTreeRevisionAck(std::uint32_t revision) {
+        Buffer<> buf;
+        messages::TreeRevisionAckToServer::MessageSerialization msg(revision);
+        serialize(buf, msg);
+        m_getParent().packMessage(buf, treeRevisionAckIn.getMessageType());
+    }
+
+    void SystemComponent::registerTreeRevisionAckHandler(
+        TreeRevisionAckHandler cb) {
+        if (m_treeRevisionAckHandlers.empty()) {
+            m_registerHandler(&SystemComponent::m_handleTreeRevisionAck, this,
+                              treeRevisionAckIn.getMessageType());
+        }
+        m_treeRevisionAckHandlers.push_back(cb);
+    }
+
     void SystemComponent::m_parentSet() {
         m_getParent().registerMessageType(routesOut);
         m_getParent().registerMessageType(appStartup);
         m_getParent().registerMessageType(routeIn);
         m_getParent().registerMessageType(treeOut);
+        m_getParent().registerMessageType(treeDeltaOut);
+        m_getParent().registerMessageType(treeRevisionAckIn);
     }
 
     int SystemComponent::m_handleReplaceTree(void *userdata,
                                              vrpn_HANDLERPARAM p) {
         auto self = static_cast<SystemComponent *>(userdata);
+        if (self->m_gotBinaryTree) {
+            /// The server sends this only for the benefit of older clients:
+            /// we already have the same tree from the delta message.
+            return 0;
+        }
         auto bufReader = readExternalBuffer(p.buffer, p.payload_len);
         messages::ReplacementTreeFromServer::MessageSerialization msg;
         deserialize(bufReader, msg);
@@ -169,5 +260,57 @@ namespace common {
         }
         return 0;
     }
+
+    int SystemComponent::m_handlePathTreeDelta(void *userdata,
+                                               vrpn_HANDLERPARAM p) {
+        auto self = static_cast<SystemComponent *>(userdata);
+        auto bufReader = readExternalBuffer(p.buffer, p.payload_len);
+        messages::PathTreeDeltaFromServer::MessageSerialization msg;
+        try {
+            deserialize(bufReader, msg);
+        } catch (std::exception &e) {
+            OSVR_DEV_VERBOSE("Could not decode path tree delta: " << e.what());
+            /// Fall back to the JSON trees, which the server keeps sending.
+            return 0;
+        }
+        if (!msg.isSupportedVersion()) {
+            /// Same fallback.
+            return 0;
+        }
+        self->m_gotBinaryTree = true;
+        auto const &delta = msg.getDelta();
+        if (!delta.isFull() && delta.baseRevision != self->m_treeRevision) {
+            /// We can't apply this: report what we have so the server sends
+            /// the whole thing.
+            self->sendTreeRevisionAck(self->m_treeRevision);
+            return 0;
+        }
+        if (delta.empty() && delta.revision == self->m_treeRevision) {
+            /// Just a reminder of the current revision.
+            return 0;
+        }
+        applyPathTreeDelta(self->m_treeNodes, delta);
+        self->m_treeRevision = delta.revision;
+        self->sendTreeRevisionAck(self->m_treeRevision);
+
+        auto timestamp = util::time::fromStructTimeval(p.msg_time);
+        auto nodes = nodeMapToJson(self->m_treeNodes);
+        for (auto const &cb : self->m_replaceTreeHandlers) {
+            cb(nodes, timestamp);
+        }
+        return 0;
+    }
+
+    int SystemComponent::m_handleTreeRevisionAck(void *userdata,
+                                                 vrpn_HANDLERPARAM p) {
+        auto self = static_cast<SystemComponent *>(userdata);
+        auto bufReader = readExternalBuffer(p.buffer, p.payload_len);
+        messages::TreeRevisionAckToServer::MessageSerialization msg;
+        deserialize(bufReader, msg);
+        for (auto const &cb : self->m_treeRevisionAckHandlers) {
+            cb(msg.getRevision());
+        }
+        return 0;
+    }
 } // namespace common
 } // namespace osvr
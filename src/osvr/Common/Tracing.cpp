@@ -26,6 +26,10 @@
 #include <osvr/Common/Tracing.h>
 
 #ifdef OSVR_COMMON_TRACING_ENABLED
+#if OSVR_COMMON_TRACING_PORTABLE
+#include <osvr/Util/GetEnvironmentVariable.h>
+#endif
+
 // Library/third-party includes
 #if OSVR_COMMON_TRACING_ETW
 #include <vrpn_WindowsH.h>
@@ -33,7 +37,23 @@
 #endif
 
 // Standard includes
-// - none
+#if OSVR_COMMON_TRACING_PORTABLE
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <vector>
+#endif
+
+#if defined(_MSC_VER) && _MSC_VER < 1900
+#define OSVR_TRACING_THREAD_LOCAL __declspec(thread)
+#else
+#define OSVR_TRACING_THREAD_LOCAL thread_local
+#endif
 
 namespace osvr {
 namespace common {
@@ -57,6 +77,260 @@ namespace common {
         }
 
         void WorkerTracePolicy::mark(const char *text) { ETWWorkerMark(text); }
+
+        void setRecording(bool) {}
+        bool isRecording() { return false; }
+        bool writeChromeTrace(std::ostream &) { return false; }
+        bool writeChromeTrace(std::string const &) { return false; }
+#endif
+
+#if OSVR_COMMON_TRACING_PORTABLE
+        namespace {
+            /// @brief Longest event name kept (longer ones are truncated),
+            /// chosen to make an event 64 bytes.
+            static const std::size_t EVENT_NAME_LENGTH = 45;
+
+            /// @brief Events kept per thread: older ones get overwritten.
+            static const std::size_t EVENTS_PER_THREAD = 16384;
+
+            /// @brief A recorded event, using the Chrome trace event "phase"
+            /// codes: 'X' for a complete region, 'i' for an instant mark.
+            struct TraceEvent {
+                /// @brief Microseconds, from an arbitrary epoch.
+                std::int64_t timestamp;
+                /// @brief Microseconds, for regions.
+                std::int64_t duration;
+                char phase;
+                /// @brief From the worker (rather than main) trace policy?
+                bool worker;
+                char name[EVENT_NAME_LENGTH + 1];
+            };
+
+            inline std::int64_t getTimestamp() {
+                using namespace std::chrono;
+                return duration_cast<microseconds>(
+                           steady_clock::now().time_since_epoch())
+                    .count();
+            }
+
+            /// @brief A ring buffer of events, written by only one thread and
+            /// read (rarely) by whoever is exporting the trace.
+            class ThreadBuffer {
+              public:
+                explicit ThreadBuffer(std::size_t id)
+                    : m_id(id), m_events(EVENTS_PER_THREAD), m_count(0) {}
+
+                std::size_t getId() const { return m_id; }
+
+                /// @brief Owning thread only: never blocks.
+                void record(char phase, bool worker, const char *name,
+                            std::int64_t timestamp, std::int64_t duration) {
+                    auto const n = m_count.load(std::memory_order_relaxed);
+                    auto &evt = m_events[n % EVENTS_PER_THREAD];
+                    evt.timestamp = timestamp;
+                    evt.duration = duration;
+                    evt.phase = phase;
+                    evt.worker = worker;
+                    std::strncpy(evt.name, name, EVENT_NAME_LENGTH);
+                    evt.name[EVENT_NAME_LENGTH] = '\0';
+                    m_count.store(n + 1, std::memory_order_release);
+                }
+
+                /// @brief Any thread: appends a copy of the events, oldest
+                /// first, leaving out any the owning thread may have been
+                /// overwriting while we copied.
+                void copyEvents(std::vector<TraceEvent> &out) const {
+                    auto const end = m_count.load(std::memory_order_acquire);
+                    auto const begin = firstIntact(end);
+                    std::vector<TraceEvent> copy;
+                    copy.reserve(end - begin);
+                    for (auto i = begin; i < end; ++i) {
+                        copy.push_back(m_events[i % EVENTS_PER_THREAD]);
+                    }
+                    std::atomic_thread_fence(std::memory_order_acquire);
+                    /// The slot after the last complete event may be
+                    /// mid-write, hence the + 1.
+                    auto const after =
+                        m_count.load(std::memory_order_relaxed) + 1;
+                    auto const skip =
+                        std::min(copy.size(), static_cast<std::size_t>(
+                                                  firstIntact(after) - begin));
+                    out.insert(out.end(), copy.begin() + skip, copy.end());
+                }
+
+              private:
+                static std::uint64_t firstIntact(std::uint64_t count) {
+                    return count > EVENTS_PER_THREAD
+                               ? count - EVENTS_PER_THREAD
+                               : 0;
+                }
+                std::size_t m_id;
+                std::vector<TraceEvent> m_events;
+                std::atomic<std::uint64_t> m_count;
+            };
+
+            /// @brief Writes a string as a JSON string literal.
+            void writeJsonString(std::ostream &os, const char *str) {
+                os << '"';
+                for (; *str; ++str) {
+                    auto c = *str;
+                    if (c == '"' || c == '\\') {
+                        os << '\\' << c;
+                    } else if (static_cast<unsigned char>(c) < 0x20) {
+                        os << ' ';
+                    } else {
+                        os << c;
+                    }
+                }
+                os << '"';
+            }
+
+            /// @brief Owns the per-thread buffers (so they outlive their
+            /// threads) and the runtime on/off switch.
+            class TraceRecorder {
+              public:
+                static TraceRecorder &get() {
+                    static TraceRecorder recorder;
+                    return recorder;
+                }
+
+                ~TraceRecorder() {
+                    if (!m_traceFile.empty()) {
+                        std::ofstream os(m_traceFile.c_str());
+                        write(os);
+                    }
+                }
+
+                bool recording() const {
+                    return m_recording.load(std::memory_order_relaxed);
+                }
+                void setRecording(bool enable) {
+                    m_recording.store(enable, std::memory_order_relaxed);
+                }
+
+                /// @brief Gets the calling thread's buffer, creating it on
+                /// first use.
+                ThreadBuffer &getThreadBuffer() {
+                    static OSVR_TRACING_THREAD_LOCAL ThreadBuffer *buf =
+                        nullptr;
+                    if (!buf) {
+                        std::lock_guard<std::mutex> lock(m_mutex);
+                        m_buffers.emplace_back(
+                            new ThreadBuffer(m_buffers.size() + 1));
+                        buf = m_buffers.back().get();
+                    }
+                    return *buf;
+                }
+
+                bool write(std::ostream &os) {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    if (m_buffers.empty()) {
+                        return false;
+                    }
+                    os << "{\"traceEvents\":[";
+                    bool first = true;
+                    std::vector<TraceEvent> events;
+                    for (auto const &buf : m_buffers) {
+                        events.clear();
+                        buf->copyEvents(events);
+                        for (auto const &evt : events) {
+                            os << (first ? "\n" : ",\n") << "{\"name\":";
+                            first = false;
+                            writeJsonString(os, evt.name);
+                            os << ",\"cat\":\""
+                               << (evt.worker ? "worker" : "main")
+                               << "\",\"ph\":\"" << evt.phase
+                               << "\",\"pid\":1,\"tid\":" << buf->getId()
+                               << ",\"ts\":" << evt.timestamp;
+                            if (evt.phase == 'X') {
+                                os << ",\"dur\":" << evt.duration;
+                            } else {
+                                os << ",\"s\":\"t\"";
+                            }
+                            os << "}";
+                        }
+                    }
+                    os << "\n],\"displayTimeUnit\":\"ms\"}\n";
+                    return true;
+                }
+
+              private:
+                TraceRecorder() : m_recording(false) {
+                    auto traceFile =
+                        util::getEnvironmentVariable("OSVR_TRACE_FILE");
+                    if (traceFile) {
+                        m_traceFile = *traceFile;
+                        setRecording(true);
+                    }
+                }
+                std::atomic<bool> m_recording;
+                std::string m_traceFile;
+                std::mutex m_mutex;
+                std::vector<std::unique_ptr<ThreadBuffer> > m_buffers;
+            };
+
+            /// @brief Shared implementation of the two trace policies.
+            template <bool Worker> struct PortablePolicy {
+                static TraceBeginStamp begin(const char *) {
+                    if (!TraceRecorder::get().recording()) {
+                        return 0;
+                    }
+                    return getTimestamp();
+                }
+                static void end(const char *text, TraceBeginStamp stamp) {
+                    auto &recorder = TraceRecorder::get();
+                    /// A zero stamp means we weren't recording at the start.
+                    if (stamp == 0 || !recorder.recording()) {
+                        return;
+                    }
+                    recorder.getThreadBuffer().record(
+                        'X', Worker, text, stamp, getTimestamp() - stamp);
+                }
+                static void mark(const char *text) {
+                    auto &recorder = TraceRecorder::get();
+                    if (!recorder.recording()) {
+                        return;
+                    }
+                    recorder.getThreadBuffer().record('i', Worker, text,
+                                                      getTimestamp(), 0);
+                }
+            };
+        } // namespace
+
+        TraceBeginStamp MainTracePolicy::begin(const char *text) {
+            return PortablePolicy<false>::begin(text);
+        }
+        void MainTracePolicy::end(const char *text, TraceBeginStamp stamp) {
+            PortablePolicy<false>::end(text, stamp);
+        }
+        void MainTracePolicy::mark(const char *text) {
+            PortablePolicy<false>::mark(text);
+        }
+
+        TraceBeginStamp WorkerTracePolicy::begin(const char *text) {
+            return PortablePolicy<true>::begin(text);
+        }
+        void WorkerTracePolicy::end(const char *text, TraceBeginStamp stamp) {
+            PortablePolicy<true>::end(text, stamp);
+        }
+        void WorkerTracePolicy::mark(const char *text) {
+            PortablePolicy<true>::mark(text);
+        }
+
+        void setRecording(bool enable) {
+            TraceRecorder::get().setRecording(enable);
+        }
+        bool isRecording() { return TraceRecorder::get().recording(); }
+        bool writeChromeTrace(std::ostream &os) {
+            return TraceRecorder::get().write(os);
+        }
+        bool writeChromeTrace(std::string const &filename) {
+            std::ofstream os(filename.c_str());
+            if (!os) {
+                return false;
+            }
+            return TraceRecorder::get().write(os);
+        }
 #endif
     } // namespace tracing
 } // namespace common
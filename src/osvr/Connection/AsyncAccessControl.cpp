@@ -80,6 +80,9 @@ namespace connection {
             m_sharedRts = true;
             m_sharedDone = false;
             m_calledRequest = true;
+            if (m_control.m_requestNotifier) {
+                m_control.m_requestNotifier();
+            }
             /// Take the main thread "free to go" status lock.
             {
                 m_lockDone.lock();
@@ -109,6 +112,11 @@ namespace connection {
     AsyncAccessControl::AsyncAccessControl()
         : m_rts(false), m_done(false), m_mainMessage(MTM_WAIT) {}
 
+    void AsyncAccessControl::setRequestNotifier(
+        std::function<void()> const &notifier) {
+        m_requestNotifier = notifier;
+    }
+
     bool AsyncAccessControl::mainThreadCTS() {
         MainLockType lock(m_mut);
         return m_handleRTS(lock, MTM_CLEAR_TO_SEND);
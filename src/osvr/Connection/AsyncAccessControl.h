@@ -34,7 +34,7 @@
 #include <boost/optional/optional.hpp>
 
 // Standard includes
-// - none
+#include <functional>
 
 namespace osvr {
 namespace connection {
@@ -67,6 +67,11 @@ namespace connection {
         /// @returns true if there was a request to send.
         bool mainThreadDenyPermanently();
 
+        /// @brief Sets a function to be called from the async thread each time
+        /// it starts waiting on a request to send, so the main thread can be
+        /// woken to service it. Set before any requests are made.
+        void setRequestNotifier(std::function<void()> const &notifier);
+
       private:
         /// @brief Messages/status that may be set by the main thread for read
         /// by
@@ -118,6 +123,9 @@ namespace connection {
         /// Written to by main thread, read by async thread
         volatile MainThreadMessages m_mainMessage;
 
+        /// Called by the async thread when it has set m_rts
+        std::function<void()> m_requestNotifier;
+
         friend class RequestToSend;
     };
 
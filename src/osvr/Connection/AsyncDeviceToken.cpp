@@ -26,22 +26,45 @@
 
 // Internal Includes
 #include "AsyncDeviceToken.h"
+#include <osvr/Connection/Connection.h>
 #include <osvr/Connection/ConnectionDevice.h>
+#include <osvr/Util/Microsleep.h>
 #include <osvr/Util/Verbosity.h>
 
 // Library/third-party includes
 // - none
 
 // Standard includes
-// - none
+#include <exception>
+#include <utility>
 
 namespace osvr {
 namespace connection {
     using boost::unique_lock;
     using boost::mutex;
 
+    /// @brief Number of reports that may be waiting for the main thread
+    /// before the device thread has to wait: several server loop iterations'
+    /// worth for even a high-rate device.
+    static const std::size_t REPORT_QUEUE_CAPACITY = 256;
+
+    /// @brief How long the device thread waits for room in a full queue before
+    /// giving up and dropping the report, so a stalled main thread can't hang
+    /// the device forever.
+    static const boost::chrono::milliseconds REPORT_QUEUE_FULL_TIMEOUT(100);
+
     AsyncDeviceToken::AsyncDeviceToken(std::string const &name)
-        : OSVR_DeviceTokenObject(name) {}
+        : OSVR_DeviceTokenObject(name), m_reports(REPORT_QUEUE_CAPACITY) {
+        /// Make sure the main thread comes around to answer a send guard
+        /// request promptly.
+        m_accessControl.setRequestNotifier([&] { m_signalWakeup(); });
+    }
+
+    AsyncDeviceToken::AsyncDeviceToken(std::string const &name,
+                                       int sleepMicroseconds)
+        : AsyncDeviceToken(name) {
+        m_sleepTime = sleepMicroseconds;
+    }
 
     AsyncDeviceToken::~AsyncDeviceToken() {
         OSVR_DEV_VERBOSE("AsyncDeviceToken\t"
@@ -55,6 +78,13 @@ namespace connection {
                          "In signalShutdown");
         m_run.signalShutdown();
         m_accessControl.mainThreadDenyPermanently();
+        {
+            /// Don't leave the device thread waiting on a queue nobody will
+            /// drain.
+            boost::lock_guard<mutex> lock(m_queueSpaceMutex);
+            m_shuttingDown = true;
+        }
+        m_queueSpace.notify_all();
     }
 
     void AsyncDeviceToken::signalAndWaitForShutdown() {
@@ -73,13 +103,16 @@ namespace connection {
         class WaitCallbackLoop {
           public:
             WaitCallbackLoop(::util::RunLoopManagerBase &run,
-                             DeviceUpdateCallback const &cb)
-                : m_cb(cb), m_run(&run) {}
+                             DeviceUpdateCallback const &cb, int sleepTime)
+                : m_cb(cb), m_run(&run), m_sleepTime(sleepTime) {}
             void operator()() {
                 OSVR_DEV_VERBOSE("WaitCallbackLoop starting");
                 ::util::LoopGuard guard(*m_run);
                 while (m_run->shouldContinue()) {
                     m_cb();
+                    if (m_sleepTime > 0) {
+                        util::time::microsleep(m_sleepTime);
+                    }
                 }
                 OSVR_DEV_VERBOSE("WaitCallbackLoop exiting");
             }
@@ -87,6 +120,7 @@ namespace connection {
           private:
             DeviceUpdateCallback m_cb;
             ::util::RunLoopManagerBase *m_run;
+            int m_sleepTime;
         };
     } // end of anonymous namespace
 
@@ -97,30 +131,55 @@ namespace connection {
     void AsyncDeviceToken::m_ensureThreadStarted() {
         if ((!m_callbackThread) && m_cb) {
             m_callbackThread.reset(
-                new boost::thread(WaitCallbackLoop(m_run, m_cb)));
+                new boost::thread(WaitCallbackLoop(m_run, m_cb, m_sleepTime)));
             m_run.signalAndWaitForStart();
         }
     }
 
+    template <typename F> bool AsyncDeviceToken::m_enqueue(F &&fill) {
+        boost::lock_guard<mutex> producerLock(m_producerMutex);
+        if (!m_reports.tryWrite(fill)) {
+            /// Queue full: hold the device thread until the main thread makes
+            /// room, to throttle a device producing faster than we can send.
+            m_signalWakeup();
+            unique_lock<mutex> lock(m_queueSpaceMutex);
+            bool queued = m_queueSpace.wait_for(
+                lock, REPORT_QUEUE_FULL_TIMEOUT,
+                [&] { return m_shuttingDown || m_reports.tryWrite(fill); });
+            if (!queued || m_shuttingDown) {
+                ++m_droppedReports;
+                OSVR_DEV_VERBOSE("AsyncDeviceToken::m_enqueue\t"
+                                 "Report queue stayed full, dropped a report ("
+                                 << m_droppedReports << " so far)");
+                return false;
+            }
+        }
+        OSVR_DEV_VERBOSE("AsyncDeviceToken::m_enqueue\t"
+                         "Queued a report");
+        m_signalWakeup();
+        return true;
+    }
+
     void AsyncDeviceToken::m_sendData(util::time::TimeValue const &timestamp,
                                       MessageType *type, const char *bytestream,
                                       size_t len) {
-        OSVR_DEV_VERBOSE("AsyncDeviceToken::m_sendData\t"
-                         "about to create RTS object");
-        RequestToSend rts(m_accessControl);
-
-        bool clear = rts.request();
-        if (!clear) {
-            OSVR_DEV_VERBOSE("AsyncDeviceToken::m_sendData\t"
-                             "RTS request responded with not clear to send.");
-            return;
-        }
+        m_enqueue([&](QueuedReport &report) {
+            report.timestamp = timestamp;
+            report.type = type;
+            report.data.assign(bytestream, bytestream + len);
+        });
+    }
 
-        OSVR_DEV_VERBOSE("AsyncDeviceToken::m_sendData\t"
-                         "Have CTS!");
-        m_getConnectionDevice()->sendData(timestamp, type, bytestream, len);
-        OSVR_DEV_VERBOSE("AsyncDeviceToken::m_sendData\t"
-                         "done!");
+    bool AsyncDeviceToken::m_queueSend(SendFunction &&f) {
+        return m_enqueue(
+            [&](QueuedReport &report) { report.send = std::move(f); });
+    }
+
+    void AsyncDeviceToken::m_signalWakeup() {
+        auto conn = m_getConnection();
+        if (conn) {
+            conn->signalWakeup();
+        }
     }
 
     class AsyncSendGuard : public util::GuardInterface {
@@ -140,6 +199,31 @@ namespace connection {
 
     void AsyncDeviceToken::m_connectionInteract() {
         m_ensureThreadStarted();
+        /// Send everything queued so far in one batch, before any guarded
+        /// send, so reports stay in order.
+        auto sent = m_reports.drain([&](QueuedReport &report) {
+            if (!report.send) {
+                m_getConnectionDevice()->sendData(report.timestamp, report.type,
+                                                  report.data.data(),
+                                                  report.data.size());
+                return;
+            }
+            try {
+                report.send();
+            } catch (std::exception const &e) {
+                OSVR_DEV_VERBOSE("AsyncDeviceToken::m_connectionInteract\t"
+                                 "Caught exception sending: "
+                                 << e.what());
+            }
+            /// Free whatever the function held (like an image) now, rather
+            /// than when the slot is next reused.
+            report.send = nullptr;
+        });
+        if (sent > 0) {
+            /// Wake the device thread in case it's waiting for room.
+            boost::lock_guard<mutex> lock(m_queueSpaceMutex);
+            m_queueSpace.notify_one();
+        }
         OSVR_DEV_VERBOSE("AsyncDeviceToken::m_connectionInteract\t"
                          "Going to send a CTS if waiting");
         bool handled = m_accessControl.mainThreadCTS();
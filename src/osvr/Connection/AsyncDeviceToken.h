@@ -28,6 +28,8 @@
 // Internal Includes
 #include <osvr/Connection/DeviceToken.h>
 #include <osvr/Util/CallbackWrapper.h>
+#include <osvr/Util/ProducerConsumerQueue.h>
+#include <osvr/Util/TimeValue.h>
 #include "AsyncAccessControl.h"
 
 // Library/third-party includes
@@ -35,13 +37,20 @@
 #include <util/RunLoopManagerBoost.h>
 
 // Standard includes
+#include <cstddef>
 #include <string>
+#include <vector>
 
 namespace osvr {
 namespace connection {
     class AsyncDeviceToken : public OSVR_DeviceTokenObject {
       public:
         AsyncDeviceToken(std::string const &name);
+
+        /// @brief Constructor for running a sync device's update callback in
+        /// its own thread: the callback is expected to return promptly, so
+        /// the thread sleeps the given number of microseconds between calls.
+        AsyncDeviceToken(std::string const &name, int sleepMicroseconds);
         virtual ~AsyncDeviceToken();
 
         void signalShutdown();
@@ -52,25 +61,68 @@ namespace connection {
         /// The thread will be launched as soon as the first connection
         /// interaction occurs.
         void m_setUpdateCallback(DeviceUpdateCallback const &cb) override;
-        /// Called from the async thread - only permitted to actually
-        /// send data when m_connectionInteract says so.
+        /// Called from the async thread - copies the report into the queue
+        /// for m_connectionInteract to send. Only waits if the queue is full,
+        /// and if it stays full too long, drops the report.
         void m_sendData(util::time::TimeValue const &timestamp,
                         MessageType *type, const char *bytestream,
                         size_t len) override;
         util::GuardPtr m_getSendGuard() override;
+        /// Called from the async thread - queues the function alongside the
+        /// reports from m_sendData, with the same waiting and dropping.
+        bool m_queueSend(SendFunction &&f) override;
+
+        /// @brief Fills the next queue slot, waiting for room if needed.
+        /// Safe to call from several threads at once.
+        /// @return false if the report was dropped.
+        template <typename F> bool m_enqueue(F &&fill);
 
-        /// Called from the main thread - services requests to send from
-        /// the async thread.
+        /// Called from the main thread - sends all queued reports, then
+        /// services requests to send (send guards) from the async thread.
         void m_connectionInteract() override;
 
         void m_stopThreads() override;
 
         void m_ensureThreadStarted();
+
+        /// @brief Lets the main thread know we're waiting on it.
+        void m_signalWakeup();
+
         DeviceUpdateCallback m_cb;
+        /// @brief Microseconds to sleep between calls to m_cb: 0 for a true
+        /// async device, whose callback blocks as needed.
+        int m_sleepTime = 0;
         unique_ptr<boost::thread> m_callbackThread;
 
         AsyncAccessControl m_accessControl;
 
+        /// @brief A report from the async thread awaiting the main thread:
+        /// either raw data, or a function that sends on a typed interface.
+        struct QueuedReport {
+            util::time::TimeValue timestamp;
+            MessageType *type = nullptr;
+            /// @brief Storage reused from report to report.
+            std::vector<char> data;
+            /// @brief If set, called instead of sending data.
+            SendFunction send;
+        };
+        typedef util::ProducerConsumerQueue<QueuedReport> ReportQueue;
+        /// @brief Async thread produces, main thread consumes.
+        ReportQueue m_reports;
+        /// @brief The queue only supports one producer at a time, but plugins
+        /// may send on one device from several threads.
+        boost::mutex m_producerMutex;
+        /// @brief Reports dropped because the queue stayed full: protected by
+        /// m_producerMutex.
+        std::size_t m_droppedReports = 0;
+
+        /// @brief Signalled by the main thread after draining the queue, for
+        /// an async thread waiting for room.
+        boost::condition_variable m_queueSpace;
+        boost::mutex m_queueSpaceMutex;
+        /// @brief Protected by m_queueSpaceMutex.
+        bool m_shuttingDown = false;
+
         ::util::RunLoopManagerBoost m_run;
     };
 } // namespace connection
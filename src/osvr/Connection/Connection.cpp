@@ -162,8 +162,34 @@ namespace connection {
         }
     }
 
+    void Connection::registerWakeupHandler(std::function<void()> handler) {
+        m_wakeupHandlers.push_back(handler);
+    }
+
+    void Connection::signalWakeup() {
+        for (auto const &handler : m_wakeupHandlers) {
+            handler();
+        }
+    }
+
+    void Connection::setSyncDeviceThread(std::string const &pluginName,
+                                         int sleepMicroseconds) {
+        m_syncDeviceThreads[pluginName] = sleepMicroseconds;
+    }
+
+    boost::optional<int>
+    Connection::getSyncDeviceThread(std::string const &pluginName) const {
+        boost::optional<int> ret;
+        auto it = m_syncDeviceThreads.find(pluginName);
+        if (it != end(m_syncDeviceThreads)) {
+            ret = it->second;
+        }
+        return ret;
+    }
+
     Connection::Connection()
-        : m_log(util::log::make_logger(util::log::OSVR_SERVER_LOG)) {}
+        : m_localReports(make_shared<common::LocalReportDispatcher>()),
+          m_log(util::log::make_logger(util::log::OSVR_SERVER_LOG)) {}
 
     Connection::~Connection() {}
 
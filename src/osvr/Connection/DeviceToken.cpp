@@ -30,12 +30,14 @@
 #include <osvr/Connection/DeviceInitObject.h>
 #include <osvr/Connection/Connection.h>
 #include <osvr/Connection/ConnectionDevice.h>
+#include <osvr/PluginHost/PluginSpecificRegistrationContext.h>
 
 // Library/third-party includes
-// - none
+#include <boost/optional.hpp>
 
 // Standard includes
 #include <stdexcept>
+#include <utility>
 
 using osvr::connection::DeviceTokenPtr;
 using osvr::connection::DeviceInitObject;
@@ -56,7 +58,19 @@ OSVR_DeviceTokenObject::createAsyncDevice(DeviceInitObject &init) {
 
 DeviceTokenPtr
 OSVR_DeviceTokenObject::createSyncDevice(DeviceInitObject &init) {
-    DeviceTokenPtr ret(new SyncDeviceToken(init.getQualifiedName()));
+    DeviceTokenPtr ret;
+    boost::optional<int> threadSleep;
+    if (init.getContext()) {
+        threadSleep = init.getConnection()->getSyncDeviceThread(
+            init.getContext()->getName());
+    }
+    if (threadSleep) {
+        /// Configured to run in its own thread: the async token already does
+        /// the hand-off of reports to the server thread.
+        ret.reset(new AsyncDeviceToken(init.getQualifiedName(), *threadSleep));
+    } else {
+        ret.reset(new SyncDeviceToken(init.getQualifiedName()));
+    }
     ret->m_sharedInit(init);
     return ret;
 }
@@ -92,6 +106,10 @@ void OSVR_DeviceTokenObject::sendData(
 
 GuardPtr OSVR_DeviceTokenObject::getSendGuard() { return m_getSendGuard(); }
 
+bool OSVR_DeviceTokenObject::queueSend(SendFunction &&f) {
+    return m_queueSend(std::move(f));
+}
+
 void OSVR_DeviceTokenObject::setUpdateCallback(
     osvr::connection::DeviceUpdateCallback const &cb) {
     m_setUpdateCallback(cb);
@@ -126,6 +144,15 @@ ConnectionDevicePtr OSVR_DeviceTokenObject::m_getConnectionDevice() {
     return m_dev;
 }
 
+bool OSVR_DeviceTokenObject::m_queueSend(SendFunction &&f) {
+    auto guard = m_getSendGuard();
+    if (!guard->lock()) {
+        return false;
+    }
+    f();
+    return true;
+}
+
 void OSVR_DeviceTokenObject::m_stopThreads() {}
 
 void OSVR_DeviceTokenObject::m_sharedInit(DeviceInitObject &init) {
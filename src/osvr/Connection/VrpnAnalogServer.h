@@ -74,8 +74,12 @@ namespace connection {
             m_reportChanges(tv);
         }
 
+        virtual OSVR_ChannelCount getNumChannels() const {
+            return m_getNumChannels();
+        }
+
       private:
-        OSVR_ChannelCount m_getNumChannels() {
+        OSVR_ChannelCount m_getNumChannels() const {
             return static_cast<OSVR_ChannelCount>(Base::num_channel);
         }
         void m_setNumChannels(OSVR_ChannelCount chans) {
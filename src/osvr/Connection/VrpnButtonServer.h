@@ -75,8 +75,12 @@ namespace connection {
             m_reportChanges(tv);
         }
 
+        virtual OSVR_ChannelCount getNumChannels() const {
+            return m_getNumChannels();
+        }
+
       private:
-        OSVR_ChannelCount m_getNumChannels() {
+        OSVR_ChannelCount m_getNumChannels() const {
             return static_cast<OSVR_ChannelCount>(Base::num_buttons);
         }
         void m_setNumChannels(OSVR_ChannelCount chans) {
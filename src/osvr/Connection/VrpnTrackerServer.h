@@ -27,6 +27,8 @@
 
 // Internal Includes
 #include "DeviceConstructionData.h"
+#include <osvr/Common/LocalReportDispatcher.h>
+#include <osvr/Connection/Connection.h>
 #include <osvr/Connection/TrackerServerInterface.h>
 #include <osvr/Util/QuatlibInteropC.h>
 
@@ -44,7 +46,10 @@ namespace connection {
       public:
         typedef vrpn_Tracker Base;
         VrpnTrackerServer(DeviceConstructionData &init)
-            : vrpn_Tracker(init.getQualifiedName().c_str(), init.conn) {
+            : vrpn_Tracker(init.getQualifiedName().c_str(), init.conn),
+              m_local(init.obj.getConnection()
+                          ->getLocalReportDispatcher()
+                          ->getPublisher(init.getQualifiedName())) {
             // Initialize data
             m_resetPos();
             m_resetQuat();
@@ -172,6 +177,14 @@ namespace connection {
             d_connection->pack_message(len, Base::timestamp,
                                        Base::position_m_id, Base::d_sender_id,
                                        msgbuf, CLASS_OF_SERVICE);
+
+            if (m_local->hasSubscribers<OSVR_PoseReport>()) {
+                OSVR_PoseReport report;
+                report.sensor = sensor;
+                osvrVec3FromQuatlib(&(report.pose.translation), Base::pos);
+                osvrQuatFromQuatlib(&(report.pose.rotation), Base::d_quat);
+                m_local->publish(ts, report);
+            }
         }
 
         void m_sendVelocity(OSVR_ChannelCount sensor,
@@ -184,6 +197,21 @@ namespace connection {
             d_connection->pack_message(len, Base::timestamp,
                                        Base::velocity_m_id, Base::d_sender_id,
                                        msgbuf, CLASS_OF_SERVICE);
+
+            if (m_local->hasSubscribers<OSVR_VelocityReport>()) {
+                /// Like the VRPN message, carries both parts: the subscriber
+                /// knows which ones the device really reports.
+                OSVR_VelocityReport report;
+                report.sensor = sensor;
+                report.state.linearVelocityValid = true;
+                osvrVec3FromQuatlib(&(report.state.linearVelocity), Base::vel);
+                report.state.angularVelocityValid = true;
+                osvrQuatFromQuatlib(
+                    &(report.state.angularVelocity.incrementalRotation),
+                    Base::vel_quat);
+                report.state.angularVelocity.dt = Base::vel_quat_dt;
+                m_local->publish(ts, report);
+            }
         }
 
         void m_sendAccel(OSVR_ChannelCount sensor,
@@ -196,7 +224,23 @@ namespace connection {
             d_connection->pack_message(len, Base::timestamp, Base::accel_m_id,
                                        Base::d_sender_id, msgbuf,
                                        CLASS_OF_SERVICE);
-        }
+
+            if (m_local->hasSubscribers<OSVR_AccelerationReport>()) {
+                OSVR_AccelerationReport report;
+                report.sensor = sensor;
+                report.state.linearAccelerationValid = true;
+                osvrVec3FromQuatlib(&(report.state.linearAcceleration),
+                                    Base::acc);
+                report.state.angularAccelerationValid = true;
+                osvrQuatFromQuatlib(
+                    &(report.state.angularAcceleration.incrementalRotation),
+                    Base::acc_quat);
+                report.state.angularAcceleration.dt = Base::acc_quat_dt;
+                m_local->publish(ts, report);
+            }
+        }
+        /// @brief In-process subscribers to this device's reports.
+        common::LocalDeviceReportsPtr m_local;
     };
 
 } // namespace connection
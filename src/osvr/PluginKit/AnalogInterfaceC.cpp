@@ -31,12 +31,13 @@
 #include <osvr/PluginHost/PluginSpecificRegistrationContext.h>
 #include <osvr/Util/PointerWrapper.h>
 #include "HandleNullContext.h"
+#include "UseSendGuard.h"
 
 // Library/third-party includes
 // - none
 
 // Standard includes
-// - none
+#include <vector>
 
 struct OSVR_AnalogDeviceInterfaceObject
     : public osvr::connection::DeviceInterfaceBase {
@@ -75,13 +76,12 @@ OSVR_ReturnCode osvrDeviceAnalogSetValueTimestamped(
     OSVR_PLUGIN_HANDLE_NULL_CONTEXT("osvrDeviceAnalogSetValueTimestamped",
                                     timestamp);
 
-    auto guard = iface->getSendGuard();
-    if (guard->lock()) {
-        bool sendResult = iface->analog->setValue(val, chan, *timestamp);
-        return sendResult ? OSVR_RETURN_SUCCESS : OSVR_RETURN_FAILURE;
+    if (chan >= iface->analog->getNumChannels()) {
+        return OSVR_RETURN_FAILURE;
     }
-
-    return OSVR_RETURN_FAILURE;
+    OSVR_TimeValue tv = *timestamp;
+    return queueSendVoid(
+        iface, [=]() { iface->analog->setValue(val, chan, tv); });
 }
 
 OSVR_ReturnCode
@@ -103,10 +103,10 @@ OSVR_ReturnCode osvrDeviceAnalogSetValuesTimestamped(
     OSVR_PLUGIN_HANDLE_NULL_CONTEXT("osvrDeviceAnalogSetValuesTimestamped",
                                     timestamp);
 
-    auto guard = iface->getSendGuard();
-    if (guard->lock()) {
-        iface->analog->setValues(val, chans, *timestamp);
-        return OSVR_RETURN_SUCCESS;
-    }
-    return OSVR_RETURN_FAILURE;
+    /// Copy the values: the send may happen after we return.
+    std::vector<OSVR_AnalogState> vals(val, val + chans);
+    OSVR_TimeValue tv = *timestamp;
+    return queueSendVoid(iface, [=]() mutable {
+        iface->analog->setValues(vals.data(), chans, tv);
+    });
 }
@@ -30,13 +30,14 @@
 #include <osvr/Connection/DeviceInterfaceBase.h>
 #include <osvr/PluginHost/PluginSpecificRegistrationContext.h>
 #include "HandleNullContext.h"
+#include "UseSendGuard.h"
 #include <osvr/Util/PointerWrapper.h>
 
 // Library/third-party includes
 // - none
 
 // Standard includes
-// - none
+#include <vector>
 
 struct OSVR_ButtonDeviceInterfaceObject : public osvr::connection::DeviceInterfaceBase {
     osvr::util::PointerWrapper<osvr::connection::ButtonServerInterface> button;
@@ -74,13 +75,12 @@ OSVR_ReturnCode osvrDeviceButtonSetValueTimestamped(
     OSVR_PLUGIN_HANDLE_NULL_CONTEXT("osvrDeviceButtonSetValueTimestamped",
                                     timestamp);
 
-    auto guard = iface->getSendGuard();
-    if (guard->lock()) {
-        bool sendResult = iface->button->setValue(val, chan, *timestamp);
-        return sendResult ? OSVR_RETURN_SUCCESS : OSVR_RETURN_FAILURE;
+    if (chan >= iface->button->getNumChannels()) {
+        return OSVR_RETURN_FAILURE;
     }
-
-    return OSVR_RETURN_FAILURE;
+    OSVR_TimeValue tv = *timestamp;
+    return queueSendVoid(
+        iface, [=]() { iface->button->setValue(val, chan, tv); });
 }
 
 OSVR_ReturnCode osvrDeviceButtonSetValues(OSVR_INOUT_PTR OSVR_DeviceToken dev,
@@ -102,10 +102,10 @@ OSVR_ReturnCode osvrDeviceButtonSetValuesTimestamped(
     OSVR_PLUGIN_HANDLE_NULL_CONTEXT("osvrDeviceButtonSetValuesTimestamped",
                                     timestamp);
 
-    auto guard = iface->getSendGuard();
-    if (guard->lock()) {
-        iface->button->setValues(val, chans, *timestamp);
-        return OSVR_RETURN_SUCCESS;
-    }
-    return OSVR_RETURN_FAILURE;
+    /// Copy the values: the send may happen after we return.
+    std::vector<OSVR_ButtonState> vals(val, val + chans);
+    OSVR_TimeValue tv = *timestamp;
+    return queueSendVoid(iface, [=]() mutable {
+        iface->button->setValues(vals.data(), chans, tv);
+    });
 }
@@ -31,6 +31,7 @@
 #include <osvr/PluginHost/PluginSpecificRegistrationContext.h>
 #include <osvr/Common/DirectionComponent.h>
 #include "HandleNullContext.h"
+#include "UseSendGuard.h"
 #include <osvr/Util/Verbosity.h>
 
 // Library/third-party includes
@@ -66,11 +67,8 @@ osvrDeviceDirectionReportData(OSVR_IN_PTR OSVR_DirectionDeviceInterface iface,
                               OSVR_IN_PTR OSVR_DirectionState directionData,
                               OSVR_IN OSVR_ChannelCount sensor,
                               OSVR_IN_PTR OSVR_TimeValue const *timestamp) {
-    auto guard = iface->getSendGuard();
-    if (guard->lock()) {
-        iface->direction->sendDirectionData(directionData, sensor, *timestamp);
-        return OSVR_RETURN_SUCCESS;
-    }
-
-    return OSVR_RETURN_FAILURE;
+    OSVR_TimeValue tv = *timestamp;
+    return queueSendVoid(iface, [=]() {
+        iface->direction->sendDirectionData(directionData, sensor, tv);
+    });
 }
\ No newline at end of file
@@ -30,6 +30,7 @@
 #include <osvr/PluginHost/PluginSpecificRegistrationContext.h>
 #include <osvr/Util/PointerWrapper.h>
 #include "HandleNullContext.h"
+#include "UseSendGuard.h"
 #include <osvr/Util/Verbosity.h>
 #include <osvr/Common/EyeTrackerComponent.h>
 #include <osvr/Common/Location2DComponent.h>
@@ -90,14 +91,11 @@ OSVR_ReturnCode osvrDeviceEyeTrackerReport2DGaze(
     OSVR_IN OSVR_ChannelCount sensor,
     OSVR_IN_PTR OSVR_TimeValue const *timestamp) {
 
-    auto guard = iface->getSendGuard();
-    if (guard->lock()) {
-        iface->location->sendLocationData(gazePosition, sensor, *timestamp);
-        iface->eyetracker->sendNotification(sensor, *timestamp);
-        return OSVR_RETURN_SUCCESS;
-    }
-
-    return OSVR_RETURN_FAILURE;
+    OSVR_TimeValue tv = *timestamp;
+    return queueSendVoid(iface, [=]() {
+        iface->location->sendLocationData(gazePosition, sensor, tv);
+        iface->eyetracker->sendNotification(sensor, tv);
+    });
 }
 
 OSVR_ReturnCode osvrDeviceEyeTrackerReport3DGaze(
@@ -106,15 +104,12 @@ OSVR_ReturnCode osvrDeviceEyeTrackerReport3DGaze(
     OSVR_IN OSVR_EyeGazeBasePoint3DState gazeBasePoint,
     OSVR_IN OSVR_ChannelCount sensor,
     OSVR_IN_PTR OSVR_TimeValue const *timestamp) {
-    auto guard = iface->getSendGuard();
-    if (guard->lock()) {
-        iface->direction->sendDirectionData(gazeDirection, sensor, *timestamp);
-        iface->tracker->sendReport(gazeBasePoint, sensor, *timestamp);
-        iface->eyetracker->sendNotification(sensor, *timestamp);
-        return OSVR_RETURN_SUCCESS;
-    }
-
-    return OSVR_RETURN_FAILURE;
+    OSVR_TimeValue tv = *timestamp;
+    return queueSendVoid(iface, [=]() {
+        iface->direction->sendDirectionData(gazeDirection, sensor, tv);
+        iface->tracker->sendReport(gazeBasePoint, sensor, tv);
+        iface->eyetracker->sendNotification(sensor, tv);
+    });
 }
 
 OSVR_ReturnCode osvrDeviceEyeTrackerReport3DGazeDirection(
@@ -123,14 +118,11 @@ OSVR_ReturnCode osvrDeviceEyeTrackerReport3DGazeDirection(
     OSVR_IN OSVR_ChannelCount sensor,
     OSVR_IN_PTR OSVR_TimeValue const *timestamp) {
 
-    auto guard = iface->getSendGuard();
-    if (guard->lock()) {
-        iface->direction->sendDirectionData(gazeDirection, sensor, *timestamp);
-        iface->eyetracker->sendNotification(sensor, *timestamp);
-        return OSVR_RETURN_SUCCESS;
-    }
-
-    return OSVR_RETURN_FAILURE;
+    OSVR_TimeValue tv = *timestamp;
+    return queueSendVoid(iface, [=]() {
+        iface->direction->sendDirectionData(gazeDirection, sensor, tv);
+        iface->eyetracker->sendNotification(sensor, tv);
+    });
 }
 
 OSVR_ReturnCode
@@ -142,16 +134,13 @@ osvrDeviceEyeTrackerReportGaze(OSVR_IN_PTR OSVR_EyeTrackerDeviceInterface iface,
                                OSVR_IN OSVR_ChannelCount sensor,
                                OSVR_IN_PTR OSVR_TimeValue const *timestamp) {
 
-    auto guard = iface->getSendGuard();
-    if (guard->lock()) {
-        iface->location->sendLocationData(gazePosition, sensor, *timestamp);
-        iface->tracker->sendReport(gazeBasePoint, sensor, *timestamp);
-        iface->direction->sendDirectionData(gazeDirection, sensor, *timestamp);
-        iface->eyetracker->sendNotification(sensor, *timestamp);
-        return OSVR_RETURN_SUCCESS;
-    }
-
-    return OSVR_RETURN_FAILURE;
+    OSVR_TimeValue tv = *timestamp;
+    return queueSendVoid(iface, [=]() {
+        iface->location->sendLocationData(gazePosition, sensor, tv);
+        iface->tracker->sendReport(gazeBasePoint, sensor, tv);
+        iface->direction->sendDirectionData(gazeDirection, sensor, tv);
+        iface->eyetracker->sendNotification(sensor, tv);
+    });
 }
 
 OSVR_ReturnCode osvrDeviceEyeTrackerReportBlink(
@@ -159,11 +148,9 @@ OSVR_ReturnCode osvrDeviceEyeTrackerReportBlink(
     OSVR_IN OSVR_EyeTrackerBlinkState blink, OSVR_IN OSVR_ChannelCount sensor,
     OSVR_IN_PTR OSVR_TimeValue const *timestamp) {
 
-    auto guard = iface->getSendGuard();
-    if (guard->lock()) {
-        iface->button->setValue(blink, sensor, *timestamp);
-        iface->eyetracker->sendNotification(sensor, *timestamp);
-        return OSVR_RETURN_SUCCESS;
-    }
-    return OSVR_RETURN_FAILURE;
+    OSVR_TimeValue tv = *timestamp;
+    return queueSendVoid(iface, [=]() {
+        iface->button->setValue(blink, sensor, tv);
+        iface->eyetracker->sendNotification(sensor, tv);
+    });
 }
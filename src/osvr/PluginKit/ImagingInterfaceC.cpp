@@ -31,13 +31,17 @@
 #include <osvr/PluginHost/PluginSpecificRegistrationContext.h>
 #include <osvr/Common/ImagingComponent.h>
 #include "HandleNullContext.h"
+#include "UseSendGuard.h"
+#include <osvr/Util/AlignedMemoryUniquePtr.h>
 #include <osvr/Util/Verbosity.h>
 
 // Library/third-party includes
 // - none
 
 // Standard includes
-// - none
+#include <cstring>
+#include <memory>
+#include <utility>
 
 // @todo This is a hack. expect this to be moved to a separate osvrJniBridge
 // library and encapsulated behind a proper API.
@@ -80,6 +84,10 @@ struct OSVR_ImagingDeviceInterfaceObject
     osvr::common::ImagingComponent *imaging;
 };
 
+struct OSVR_ImagingFrameBufferObject {
+    osvr::common::ImagingSharedMemoryFramePtr frame;
+};
+
 OSVR_ReturnCode
 osvrDeviceImagingConfigure(OSVR_INOUT_PTR OSVR_DeviceInitOptions opts,
                            OSVR_OUT_PTR OSVR_ImagingDeviceInterface *iface,
@@ -104,11 +112,60 @@ osvrDeviceImagingReportFrame(OSVR_IN_PTR OSVR_DeviceToken,
                              OSVR_IN_PTR OSVR_ImageBufferElement *imageData,
                              OSVR_IN OSVR_ChannelCount sensor,
                              OSVR_IN_PTR OSVR_TimeValue const *timestamp) {
+    /// The caller frees imageData once we return, but the send may happen
+    /// later, so it gets a copy.
+    std::size_t bytes = std::size_t(metadata.height) * metadata.width *
+                        metadata.depth * metadata.channels;
+    std::shared_ptr<OSVR_ImageBufferElement> copy(
+        osvr::util::makeAlignedImageBuffer(bytes));
+    std::memcpy(copy.get(), imageData, bytes);
+    OSVR_TimeValue tv = *timestamp;
+    return queueSendVoid(iface, [=]() {
+        iface->imaging->sendImageData(metadata, copy.get(), sensor, tv);
+    });
+}
+
+OSVR_ReturnCode osvrDeviceImagingAcquireFrameBuffer(
+    OSVR_IN_PTR OSVR_DeviceToken,
+    OSVR_IN_PTR OSVR_ImagingDeviceInterface iface,
+    OSVR_IN OSVR_ImagingMetadata metadata, OSVR_IN OSVR_ChannelCount sensor,
+    OSVR_OUT_PTR OSVR_ImagingFrameBuffer *frame,
+    OSVR_OUT_PTR OSVR_ImageBufferElement **buffer) {
+    *frame = nullptr;
+    *buffer = nullptr;
+    /// Acquiring touches the same component state as sending (and as the
+    /// server thread's handling of client transport requests), so it needs
+    /// the same guard.
     auto guard = iface->getSendGuard();
-    if (guard->lock()) {
-        iface->imaging->sendImageData(metadata, imageData, sensor, *timestamp);
-        return OSVR_RETURN_SUCCESS;
+    if (!guard->lock()) {
+        return OSVR_RETURN_FAILURE;
+    }
+    auto shmFrame = iface->imaging->acquireSharedMemoryFrame(metadata, sensor);
+    if (!shmFrame) {
+        return OSVR_RETURN_FAILURE;
     }
+    *buffer = shmFrame->getBuffer();
+    *frame = new OSVR_ImagingFrameBufferObject{std::move(shmFrame)};
+    return OSVR_RETURN_SUCCESS;
+}
+
+OSVR_ReturnCode osvrDeviceImagingSendFrameBuffer(
+    OSVR_IN_PTR OSVR_DeviceToken,
+    OSVR_IN_PTR OSVR_ImagingDeviceInterface iface,
+    OSVR_IN_PTR OSVR_ImagingFrameBuffer frame,
+    OSVR_IN_PTR OSVR_TimeValue const *timestamp) {
+    /// Shared rather than unique, since the send function must be copyable.
+    std::shared_ptr<OSVR_ImagingFrameBufferObject> owned(frame);
+    OSVR_TimeValue tv = *timestamp;
+    return queueSendVoid(iface, [=]() {
+        iface->imaging->sendSharedMemoryFrame(std::move(owned->frame), tv);
+    });
+}
 
-    return OSVR_RETURN_FAILURE;
+OSVR_ReturnCode
+osvrDeviceImagingReleaseFrameBuffer(OSVR_IN_PTR OSVR_DeviceToken,
+                                    OSVR_IN_PTR OSVR_ImagingDeviceInterface,
+                                    OSVR_IN_PTR OSVR_ImagingFrameBuffer frame) {
+    delete frame;
+    return OSVR_RETURN_SUCCESS;
 }
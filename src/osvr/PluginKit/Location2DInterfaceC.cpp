@@ -30,6 +30,7 @@
 #include <osvr/PluginHost/PluginSpecificRegistrationContext.h>
 #include <osvr/Common/Location2DComponent.h>
 #include "HandleNullContext.h"
+#include "UseSendGuard.h"
 #include <osvr/Util/Verbosity.h>
 #include <osvr/Connection/DeviceInterfaceBase.h>
 
@@ -65,11 +66,8 @@ OSVR_ReturnCode osvrDeviceLocation2DReportData(
     OSVR_IN_PTR OSVR_Location2DState locationData,
     OSVR_IN OSVR_ChannelCount sensor,
     OSVR_IN_PTR OSVR_TimeValue const *timestamp) {
-    auto guard = iface->getSendGuard();
-    if (guard->lock()) {
-        iface->location->sendLocationData(locationData, sensor, *timestamp);
-        return OSVR_RETURN_SUCCESS;
-    }
-
-    return OSVR_RETURN_FAILURE;
+    OSVR_TimeValue tv = *timestamp;
+    return queueSendVoid(iface, [=]() {
+        iface->location->sendLocationData(locationData, sensor, tv);
+    });
 }
\ No newline at end of file
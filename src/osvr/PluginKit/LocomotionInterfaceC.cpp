@@ -29,6 +29,7 @@
 #include <osvr/Connection/DeviceInitObject.h>
 #include <osvr/PluginHost/PluginSpecificRegistrationContext.h>
 #include "HandleNullContext.h"
+#include "UseSendGuard.h"
 #include <osvr/Util/PointerWrapper.h>
 #include <osvr/Common/LocomotionComponent.h>
 #include <osvr/Util/Verbosity.h>
@@ -65,14 +66,10 @@ OSVR_ReturnCode osvrDeviceLocomotionReportNaviVelocity(
     OSVR_IN OSVR_NaviVelocityState naviVelocity,
     OSVR_IN OSVR_ChannelCount sensor,
     OSVR_IN_PTR OSVR_TimeValue const *timestamp) {
-    auto guard = iface->getSendGuard();
-    if (guard->lock()) {
-        iface->locomotion->sendNaviVelocityData(naviVelocity, sensor,
-                                                *timestamp);
-        return OSVR_RETURN_SUCCESS;
-    }
-
-    return OSVR_RETURN_FAILURE;
+    OSVR_TimeValue tv = *timestamp;
+    return queueSendVoid(iface, [=]() {
+        iface->locomotion->sendNaviVelocityData(naviVelocity, sensor, tv);
+    });
 }
 
 OSVR_ReturnCode osvrDeviceLocomotionReportNaviPosition(
@@ -80,12 +77,8 @@ OSVR_ReturnCode osvrDeviceLocomotionReportNaviPosition(
     OSVR_IN OSVR_NaviPositionState naviPosition,
     OSVR_IN OSVR_ChannelCount sensor,
     OSVR_IN_PTR OSVR_TimeValue const *timestamp) {
-    auto guard = iface->getSendGuard();
-    if (guard->lock()) {
-        iface->locomotion->sendNaviPositionData(naviPosition, sensor,
-                                                *timestamp);
-        return OSVR_RETURN_SUCCESS;
-    }
-
-    return OSVR_RETURN_FAILURE;
+    OSVR_TimeValue tv = *timestamp;
+    return queueSendVoid(iface, [=]() {
+        iface->locomotion->sendNaviPositionData(naviPosition, sensor, tv);
+    });
 }
@@ -24,6 +24,7 @@
 
 // Internal Includes
 #include "HandleNullContext.h"
+#include "UseSendGuard.h"
 #include <osvr/Common/SkeletonComponent.h>
 #include <osvr/Connection/DeviceInitObject.h>
 #include <osvr/Connection/DeviceInterfaceBase.h>
@@ -37,7 +38,7 @@
 // - none
 
 // Standard includes
-// - none
+#include <string>
 
 struct OSVR_SkeletonDeviceInterfaceObject
     : public osvr::connection::DeviceInterfaceBase {
@@ -64,24 +65,17 @@ OSVR_ReturnCode
 osvrDeviceSkeletonComplete(OSVR_IN_PTR OSVR_SkeletonDeviceInterface iface,
                            OSVR_IN OSVR_ChannelCount sensor,
                            OSVR_IN_PTR OSVR_TimeValue const *timestamp) {
-    auto guard = iface->getSendGuard();
-    if (guard->lock()) {
-        iface->skeleton->sendNotification(sensor, *timestamp);
-        return OSVR_RETURN_SUCCESS;
-    }
-
-    return OSVR_RETURN_FAILURE;
+    OSVR_TimeValue tv = *timestamp;
+    return queueSendVoid(iface, [=]() {
+        iface->skeleton->sendNotification(sensor, tv);
+    });
 }
 
 OSVR_ReturnCode
 osvrDeviceSkeletonUpdateSpec(OSVR_IN_PTR OSVR_SkeletonDeviceInterface iface,
                              OSVR_IN_READS(len) const char *spec) {
 
-    auto guard = iface->getSendGuard();
-    if (guard->lock()) {
-        iface->skeleton->sendArticulationSpec(spec);
-        return OSVR_RETURN_SUCCESS;
-    }
-
-    return OSVR_RETURN_FAILURE;
+    std::string specCopy(spec);
+    return queueSendVoid(
+        iface, [=]() { iface->skeleton->sendArticulationSpec(specCopy); });
 }
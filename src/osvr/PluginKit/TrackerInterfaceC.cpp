@@ -64,8 +64,11 @@ osvrTrackerSend(const char method[], OSVR_DeviceToken,
                 OSVR_ChannelCount sensor, OSVR_TimeValue const *timestamp) {
     OSVR_PLUGIN_HANDLE_NULL_CONTEXT(method, iface);
     OSVR_PLUGIN_HANDLE_NULL_CONTEXT(method, timestamp);
-    return useSendGuardVoid(
-        iface, [&]() { iface->tracker->sendReport(*val, sensor, *timestamp); });
+    StateType state = *val;
+    OSVR_TimeValue tv = *timestamp;
+    return queueSendVoid(iface, [=]() {
+        iface->tracker->sendReport(state, sensor, tv);
+    });
 }
 
 template <typename StateType>
@@ -75,8 +78,10 @@ osvrTrackerSendVel(const char method[], OSVR_DeviceToken,
                    OSVR_ChannelCount sensor, OSVR_TimeValue const *timestamp) {
     OSVR_PLUGIN_HANDLE_NULL_CONTEXT(method, iface);
     OSVR_PLUGIN_HANDLE_NULL_CONTEXT(method, timestamp);
-    return useSendGuardVoid(iface, [&]() {
-        iface->tracker->sendVelReport(*val, sensor, *timestamp);
+    StateType state = *val;
+    OSVR_TimeValue tv = *timestamp;
+    return queueSendVoid(iface, [=]() {
+        iface->tracker->sendVelReport(state, sensor, tv);
     });
 }
 
@@ -89,8 +94,10 @@ osvrTrackerSendAccel(const char method[], OSVR_DeviceToken,
     OSVR_PLUGIN_HANDLE_NULL_CONTEXT(method, iface);
     OSVR_PLUGIN_HANDLE_NULL_CONTEXT(method, timestamp);
 
-    return useSendGuardVoid(iface, [&]() {
-        iface->tracker->sendAccelReport(*val, sensor, *timestamp);
+    StateType state = *val;
+    OSVR_TimeValue tv = *timestamp;
+    return queueSendVoid(iface, [=]() {
+        iface->tracker->sendAccelReport(state, sensor, tv);
     });
 }
 
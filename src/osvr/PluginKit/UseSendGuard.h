@@ -33,6 +33,7 @@
 
 // Standard includes
 #include <exception>
+#include <utility>
 
 /// Calls a function using the send guard, returning the return value of the
 /// function if it completes without exception.
@@ -62,4 +63,21 @@ inline OSVR_ReturnCode useSendGuardVoid(InterfaceType &iface, F &&func) {
         return OSVR_RETURN_SUCCESS;
     });
 }
+
+/// Hands a void function to the device token to send with, returning success
+/// if it was accepted. It may be run later, from the server thread, so it
+/// must capture what it sends by value.
+template <typename InterfaceType, typename F>
+inline OSVR_ReturnCode queueSendVoid(InterfaceType &iface, F &&func) {
+    try {
+        return iface->queueSend(std::forward<F>(func)) ? OSVR_RETURN_SUCCESS
+                                                       : OSVR_RETURN_FAILURE;
+    } catch (std::exception const &e) {
+        OSVR_DEV_VERBOSE("Caught exception: " << e.what());
+        return OSVR_RETURN_FAILURE;
+    } catch (...) {
+        OSVR_DEV_VERBOSE("Caught non-standard exception!");
+        return OSVR_RETURN_FAILURE;
+    }
+}
 #endif // INCLUDED_UseSendGuard_h_GUID_FEAB5647_E86B_4BA2_0A29_CB5665678CCB
@@ -39,6 +39,7 @@
 #include <boost/algorithm/string/predicate.hpp> // for iends_with()
 
 // Standard includes
+#include <algorithm>
 #include <stdexcept>
 #include <iostream>
 #include <vector>
@@ -104,10 +105,21 @@ namespace server {
     static const char LOCAL_KEY[] = "local";
     static const char PORT_KEY[] = "port"; // not the triwizard cup.
     static const char SLEEP_KEY[] = "sleep";
+    static const char LEGACY_PATH_TREE_KEY[] = "legacyPathTree";
+    /// Plugins whose sync devices run in their own threads. Each thread sleeps
+    /// between updates independently of the server loop's "sleep" (which may
+    /// well be 0): sync update callbacks return promptly, so a thread that
+    /// didn't sleep would spin a core and flood its report queue. Hence a
+    /// default of its own, and a floor on configured values.
+    static const char DEVICE_THREADS_KEY[] = "deviceThreads";
+    static const int DEVICE_THREAD_DEFAULT_SLEEP = 1000; // microseconds
+    static const int DEVICE_THREAD_MIN_SLEEP = 100;      // microseconds
+    static const char PLUGIN_KEY[] = "plugin";
 
     ServerPtr ConfigureServer::constructServer() {
         Json::Value const &root(m_data->root);
         bool local = true;
+        bool legacyPathTree = true;
         std::string iface;
         boost::optional<int> port;
 #ifdef _WIN32
@@ -146,6 +158,11 @@ namespace server {
                 // Convert to microseconds for internal use.
                 sleepTime = static_cast<int>(jsonSleepTime.asDouble() * 1000.0);
             }
+
+            Json::Value jsonLegacyPathTree = jsonServer[LEGACY_PATH_TREE_KEY];
+            if (jsonLegacyPathTree.isBool()) {
+                legacyPathTree = jsonLegacyPathTree.asBool();
+            }
         }
 
         /// Construct a server, or a connection then a server, based on the
@@ -165,6 +182,32 @@ namespace server {
         if (sleepTime > 0.0) {
             m_server->setSleepTime(sleepTime);
         }
+        m_server->setLegacyPathTreeBroadcast(legacyPathTree);
+
+        /// Plugins whose sync devices should run in their own threads: each
+        /// entry is either a plugin name or an object with a "plugin" name
+        /// and a "sleep" time in milliseconds between updates (default 1).
+        Json::Value const &deviceThreads = root[DEVICE_THREADS_KEY];
+        for (auto const &entry : deviceThreads) {
+            std::string plugin;
+            int threadSleepTime = DEVICE_THREAD_DEFAULT_SLEEP;
+            if (entry.isString()) {
+                plugin = entry.asString();
+            } else if (entry.isObject() && entry[PLUGIN_KEY].isString()) {
+                plugin = entry[PLUGIN_KEY].asString();
+                Json::Value const &jsonThreadSleep = entry[SLEEP_KEY];
+                if (jsonThreadSleep.isDouble()) {
+                    threadSleepTime =
+                        static_cast<int>(jsonThreadSleep.asDouble() * 1000.0);
+                }
+            } else {
+                throw std::runtime_error("Invalid entry in " +
+                                         std::string(DEVICE_THREADS_KEY) +
+                                         ": " + entry.toStyledString());
+            }
+            m_server->setSyncDeviceThread(
+                plugin, std::max(threadSleepTime, DEVICE_THREAD_MIN_SLEEP));
+        }
 
         m_server->setHardwareDetectOnConnection();
 
@@ -210,7 +253,6 @@ namespace server {
 
     static const char DRIVERS_KEY[] = "drivers";
     static const char DRIVER_KEY[] = "driver";
-    static const char PLUGIN_KEY[] = "plugin";
     static const char PARAMS_KEY[] = "params";
     bool ConfigureServer::instantiateDrivers() {
         bool success = true;
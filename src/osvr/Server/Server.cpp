@@ -132,6 +132,15 @@ namespace server {
     void Server::setSleepTime(int microseconds) {
         m_impl->setSleepTime(microseconds);
     }
+
+    void Server::setSyncDeviceThread(std::string const &plugin,
+                                     int sleepMicroseconds) {
+        m_impl->setSyncDeviceThread(plugin, sleepMicroseconds);
+    }
+
+    void Server::setLegacyPathTreeBroadcast(bool enabled) {
+        m_impl->setLegacyPathTreeBroadcast(enabled);
+    }
 #if 0
     int Server::getSleepTime() const { return m_impl->getSleepTime(); }
 #endif
@@ -28,6 +28,7 @@
 #include <osvr/Common/AliasProcessor.h>
 #include <osvr/Common/CommonComponent.h>
 #include <osvr/Common/PathTreeFull.h>
+#include <osvr/Common/PathTreeSerialization.h>
 #include <osvr/Common/ProcessDeviceDescriptor.h>
 #include <osvr/Common/SystemComponent.h>
 #include <osvr/Common/Tracing.h>
@@ -38,7 +39,6 @@
 #include <osvr/Util/LogNames.h>
 #include <osvr/Util/Logger.h>
 #include <osvr/Util/MessageKeys.h>
-#include <osvr/Util/Microsleep.h>
 #include <osvr/Util/PortFlags.h>
 #include <osvr/Util/StringLiteralFileToString.h>
 #include <osvr/Util/Verbosity.h>
@@ -53,6 +53,7 @@
 // Standard includes
 #include <functional>
 #include <stdexcept>
+#include <utility>
 
 namespace osvr {
 namespace server {
@@ -94,6 +95,8 @@ namespace server {
             m_systemDevice->addComponent(common::SystemComponent::create());
         m_systemComponent->registerClientRouteUpdateHandler(
             &ServerImpl::m_handleUpdatedRoute, this);
+        m_systemComponent->registerTreeRevisionAckHandler(
+            [&](std::uint32_t revision) { m_handleTreeRevisionAck(revision); });
 
         // Things to do when we get a new incoming connection
         // No longer doing hardware detect unconditionally here - see
@@ -108,6 +111,9 @@ namespace server {
         // Deal with updated device descriptors.
         m_conn->registerDescriptorHandler([&] { m_handleDeviceDescriptors(); });
 
+        // Let async devices wake us when they have something to send.
+        m_conn->registerWakeupHandler([&] { m_signalWakeup(); });
+
         // Set up handlers to enter/exit idle sleep mode.
         // Can't do this with the nice wrappers on the CommonComponent of the
         // system device, I suppose since people aren't really connecting to
@@ -171,6 +177,7 @@ namespace server {
     void ServerImpl::signalStop() {
         boost::unique_lock<boost::mutex> lock(m_runControl);
         m_run.signalShutdown();
+        m_signalWakeup();
     }
 
     void ServerImpl::loadPlugin(std::string const &pluginName) {
@@ -228,6 +235,12 @@ namespace server {
             m_sendTree();
             m_treeDirty.reset();
         }
+        if (m_fullTreeRequested) {
+            m_log->debug() << "Client requested full path tree";
+            m_systemComponent->sendPathTreeDelta(
+                common::makeFullPathTreeDelta(m_sentNodes, m_treeRevision));
+            m_fullTreeRequested = false;
+        }
     }
 
     bool ServerImpl::m_loop() {
@@ -241,11 +254,34 @@ namespace server {
         }
 
         if (m_currentSleepTime > 0) {
-            osvr::util::time::microsleep(m_currentSleepTime);
+            m_waitForWakeup(m_currentSleepTime);
         }
         return shouldContinue;
     }
 
+    void ServerImpl::m_signalWakeup() {
+        {
+            boost::unique_lock<boost::mutex> lock(m_wakeupMutex);
+            m_wakeupPending = true;
+        }
+        m_wakeupCond.notify_one();
+    }
+
+    void ServerImpl::m_waitForWakeup(int microseconds) {
+        boost::unique_lock<boost::mutex> lock(m_wakeupMutex);
+        /// Synchronous devices and the network connection can't wake us, so
+        /// we still have to come back around at the deadline to poll them.
+        auto const deadline = boost::chrono::steady_clock::now() +
+                              boost::chrono::microseconds(microseconds);
+        while (!m_wakeupPending) {
+            if (m_wakeupCond.wait_until(lock, deadline) ==
+                boost::cv_status::timeout) {
+                break;
+            }
+        }
+        m_wakeupPending = false;
+    }
+
     bool ServerImpl::addRoute(std::string const &routingDirective) {
         bool wasNew;
         m_callControlled([&] { wasNew = m_addRoute(routingDirective); });
@@ -364,13 +400,60 @@ namespace server {
     void ServerImpl::m_sendTree() {
 
         common::tracing::markPathTreeBroadcast();
-        m_systemComponent->sendReplacementTree(m_tree);
-        m_log->info() << "Sent path tree to clients.";
+        auto nodes = common::pathTreeToJson(m_tree);
+        auto nodeMap = common::mapNodesByPath(nodes);
+        common::PathTreeDelta delta;
+        if (m_treeRevision != 0 && nodeMap == m_sentNodes) {
+            /// Unchanged (we're probably here because a client connected):
+            /// an empty delta costs current clients nothing, while new ones
+            /// will find they can't apply it and ask for the full tree.
+            delta.revision = m_treeRevision;
+            delta.baseRevision = m_treeRevision;
+        } else {
+            auto previous = m_treeRevision;
+            ++m_treeRevision;
+            if (previous != 0 && m_lastAckedRevision == previous) {
+                delta = common::makePathTreeDelta(m_sentNodes, nodeMap,
+                                                  previous, m_treeRevision);
+            } else {
+                delta = common::makeFullPathTreeDelta(nodeMap, m_treeRevision);
+            }
+            m_sentNodes = std::move(nodeMap);
+        }
+        m_systemComponent->sendPathTreeDelta(delta);
+        if (m_legacyTreeBroadcast) {
+            m_systemComponent->sendReplacementTree(nodes);
+        }
+        m_log->info() << "Sent path tree revision " << m_treeRevision
+                      << " to clients.";
+    }
+
+    void ServerImpl::m_handleTreeRevisionAck(std::uint32_t revision) {
+        if (revision == m_treeRevision) {
+            m_lastAckedRevision = revision;
+        } else {
+            /// A client that can't apply our deltas: everyone gets the full
+            /// tree again (once per loop, however many ask).
+            m_fullTreeRequested = true;
+        }
     }
 
     void ServerImpl::setSleepTime(int microseconds) {
         m_sleepTime = microseconds;
     }
+
+    void ServerImpl::setLegacyPathTreeBroadcast(bool enabled) {
+        m_legacyTreeBroadcast = enabled;
+    }
+
+    void ServerImpl::setSyncDeviceThread(std::string const &plugin,
+                                         int sleepMicroseconds) {
+        m_callControlled([&] {
+            m_log->info() << "Sync devices of plugin " << plugin
+                          << " will run in their own threads.";
+            m_conn->setSyncDeviceThread(plugin, sleepMicroseconds);
+        });
+    }
 #if 0
     int ServerImpl::getSleepTime() const { return m_sleepTime; }
 #endif
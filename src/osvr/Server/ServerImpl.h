@@ -30,6 +30,7 @@
 #include <osvr/Common/CreateDevice.h>
 #include <osvr/Common/LowLatency.h>
 #include <osvr/Common/PathTree.h>
+#include <osvr/Common/PathTreeDelta.h>
 #include <osvr/Common/SystemComponent_fwd.h>
 #include <osvr/Connection/ConnectionPtr.h>
 #include <osvr/Connection/DeviceToken.h>
@@ -51,6 +52,7 @@
 #include <vrpn_Connection.h>
 
 // Standard includes
+#include <cstdint>
 #include <string>
 
 namespace osvr {
@@ -121,6 +123,13 @@ namespace server {
 
         /// @copydoc Server::setSleepTime()
         void setSleepTime(int microseconds);
+
+        /// @copydoc Server::setSyncDeviceThread()
+        void setSyncDeviceThread(std::string const &plugin,
+                                 int sleepMicroseconds);
+
+        /// @copydoc Server::setLegacyPathTreeBroadcast()
+        void setLegacyPathTreeBroadcast(bool enabled);
 #if 0
         /// @copydoc Server::getSleepTime()
         int getSleepTime() const;
@@ -141,6 +150,15 @@ namespace server {
         /// @brief The actual guts of the update
         void m_update();
 
+        /// @brief Wakes the server thread if it's sleeping between loop
+        /// iterations (or keeps it from going to sleep next time): safe to
+        /// call from any thread.
+        void m_signalWakeup();
+
+        /// @brief Sleeps until woken by m_signalWakeup() or until the given
+        /// number of microseconds pass, whichever comes first.
+        void m_waitForWakeup(int microseconds);
+
         /// @brief Internal function to call a callable if the thread isn't
         /// running, or to queue up the callable if it is running.
         template <typename Callable> void m_callControlled(Callable f);
@@ -155,9 +173,13 @@ namespace server {
         /// @brief Queues up a tree transmission for next time around
         void m_queueTreeSend();
 
-        /// @brief sends full path tree contents
+        /// @brief sends path tree contents: as a binary delta if possible,
+        /// as well as in full as JSON for older clients.
         void m_sendTree();
 
+        /// @brief handles a client reporting the tree revision it holds.
+        void m_handleTreeRevisionAck(std::uint32_t revision);
+
         /// @brief handles updated route message from client
         static int VRPN_CALLBACK m_handleUpdatedRoute(void *userdata,
                                                       vrpn_HANDLERPARAM p);
@@ -216,6 +238,20 @@ namespace server {
         common::PathTree m_tree;
         util::Flag m_treeDirty;
 
+        /// @name Path tree revision tracking, for binary deltas
+        /// @{
+        /// @brief Revision number of the last tree sent (0 = none yet).
+        std::uint32_t m_treeRevision = 0;
+        /// @brief Serialized nodes of the last tree sent.
+        common::SerializedNodeMap m_sentNodes;
+        /// @brief Latest revision a client has reported holding.
+        std::uint32_t m_lastAckedRevision = 0;
+        /// @brief Set when a client could not apply a delta.
+        bool m_fullTreeRequested = false;
+        /// @brief Whether to also send the full tree as JSON.
+        bool m_legacyTreeBroadcast = true;
+        /// @}
+
         /// @brief Mutex held by anything executing in the main thread.
         mutable boost::mutex m_mainThreadMutex;
 
@@ -234,20 +270,29 @@ namespace server {
         /// m_thread.get_id() but a callControlled might change it.
         mutable boost::thread::id m_mainThreadId;
 
-        /// @brief Number of microseconds to sleep after each loop iteration
-        /// when at least one client is connected. 0 = no sleeping.
+        /// @brief Maximum number of microseconds to sleep after each loop
+        /// iteration when at least one client is connected. 0 = no sleeping.
         int m_sleepTime = 0;
 
-        /// @brief Number of microseconds to sleep after each loop iteration
-        /// when no clients are connected.
+        /// @brief Maximum number of microseconds to sleep after each loop
+        /// iteration when no clients are connected.
         ///
         /// This is 1 millisecond, the minimum sleep resolution on Windows.
         static const int IDLE_SLEEP_TIME = 1000;
 
-        /// @brief Number of microseconds to sleep after each loop iteration
-        /// right now. 0 = no sleeping.
+        /// @brief Maximum number of microseconds to sleep after each loop
+        /// iteration right now. 0 = no sleeping.
         int m_currentSleepTime = IDLE_SLEEP_TIME;
 
+        /// @name Wakeup signalling: lets async devices and other threads cut
+        /// the server thread's sleep short.
+        /// @{
+        boost::mutex m_wakeupMutex;
+        boost::condition_variable m_wakeupCond;
+        /// @brief Protected by m_wakeupMutex
+        bool m_wakeupPending = false;
+        /// @}
+
         /// The host/interface we're listening on, if any.
         std::string m_host;
 
@@ -285,9 +330,13 @@ namespace server {
     inline void ServerImpl::m_callControlled(Callable f) {
         boost::unique_lock<boost::mutex> lock(m_runControl);
         if (m_running && boost::this_thread::get_id() != m_thread.get_id()) {
-            boost::unique_lock<boost::mutex> innerLock(m_mainThreadMutex);
-            TemporaryThreadIDChanger changer(m_mainThreadId);
-            f();
+            {
+                boost::unique_lock<boost::mutex> innerLock(m_mainThreadMutex);
+                TemporaryThreadIDChanger changer(m_mainThreadId);
+                f();
+            }
+            /// Anything f() left for the server thread gets handled promptly.
+            m_signalWakeup();
         } else {
             f();
         }
@@ -0,0 +1,384 @@
+/** @file
+    @brief Implementation
+
+    @date 2017
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2017 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// Internal Includes
+#include <osvr/Util/BinaryLog.h>
+#include <osvr/Util/Log.h>
+#include <osvr/Util/Logger.h>
+#include <osvr/Util/LogNames.h>
+#include <osvr/Util/ProducerConsumerQueue.h>
+
+#include "LogDefaults.h"
+
+// Library/third-party includes
+// - none
+
+// Standard includes
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#if defined(_MSC_VER) && _MSC_VER < 1900
+/// No thread_local with destructors, so no recycling of queues.
+#define OSVR_BINARY_LOG_THREAD_LOCAL __declspec(thread)
+#define OSVR_BINARY_LOG_RECYCLE_QUEUES 0
+#else
+#define OSVR_BINARY_LOG_THREAD_LOCAL thread_local
+#define OSVR_BINARY_LOG_RECYCLE_QUEUES 1
+#endif
+
+namespace osvr {
+namespace util {
+    namespace log {
+        namespace {
+            /// @brief Records each thread can have pending before more get
+            /// dropped.
+            static const std::size_t RECORDS_PER_THREAD = 1024;
+
+            /// @brief How often the background thread drains the queues.
+            static const std::chrono::milliseconds DRAIN_INTERVAL(10);
+
+            /// @brief The queue of a thread that has logged: written only by
+            /// that thread, drained (under the backend's drain mutex) by
+            /// whoever is draining.
+            struct ThreadQueue {
+                ThreadQueue()
+                    : records(RECORDS_PER_THREAD), dropped(0), inUse(true) {}
+                ProducerConsumerQueue<BinaryLogRecord> records;
+                std::atomic<std::uint64_t> dropped;
+                /// @brief Drops already reported: drain mutex only.
+                std::uint64_t reportedDropped = 0;
+                /// @brief Cleared when the owning thread exits, so another
+                /// thread can take the queue over instead of making a new one.
+                std::atomic<bool> inUse;
+            };
+
+#if OSVR_BINARY_LOG_RECYCLE_QUEUES
+            /// @brief A thread's claim on its queue, given up at thread exit.
+            class ThreadQueueClaim {
+              public:
+                ThreadQueueClaim() = default;
+                ThreadQueueClaim(ThreadQueueClaim const &) = delete;
+                ThreadQueueClaim &operator=(ThreadQueueClaim const &) = delete;
+                ~ThreadQueueClaim() {
+                    if (queue) {
+                        queue->inUse.store(false, std::memory_order_release);
+                    }
+                }
+                ThreadQueue *queue = nullptr;
+            };
+#endif
+
+            /// @brief Owns the format strings, logger names, and per-thread
+            /// queues (so they outlive their threads, and can be reused by
+            /// later ones), and the thread that drains the queues.
+            class BinaryLogBackend {
+              public:
+                static BinaryLogBackend &get() {
+                    static BinaryLogBackend backend;
+                    return backend;
+                }
+
+                ~BinaryLogBackend() {
+                    {
+                        std::lock_guard<std::mutex> lock(m_threadMutex);
+                        m_running = false;
+                    }
+                    m_wake.notify_all();
+                    if (m_thread.joinable()) {
+                        m_thread.join();
+                    }
+                    drain();
+                }
+
+                BinaryLogFormatId registerFormat(const char *format) {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    m_formats.push_back(format);
+                    return static_cast<BinaryLogFormatId>(m_formats.size() -
+                                                          1);
+                }
+
+                const char *getFormat(BinaryLogFormatId id) {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    return id < m_formats.size() ? m_formats[id] : nullptr;
+                }
+
+                BinaryLoggerPtr makeLogger(std::string const &name) {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    auto it = m_loggerIds.find(name);
+                    std::uint16_t id;
+                    if (it != m_loggerIds.end()) {
+                        id = it->second;
+                    } else {
+                        id = static_cast<std::uint16_t>(m_loggers.size());
+                        m_loggerIds[name] = id;
+                        m_loggers.emplace_back(new LoggerEntry);
+                        m_loggers.back()->name = name;
+                        m_loggers.back()->text = make_logger(name);
+                    }
+                    auto ret = make_shared<BinaryLogger>(name, id);
+                    m_loggers[id]->instances.push_back(ret);
+                    m_startThread();
+                    return ret;
+                }
+
+                void setHandler(BinaryLogHandler const &handler) {
+                    std::lock_guard<std::mutex> lock(m_drainMutex);
+                    m_handler = handler;
+                }
+
+                /// @brief Gets the calling thread's queue, on first use
+                /// taking over one left by an exited thread or else creating
+                /// one, so short-lived threads don't pile up queues.
+                ThreadQueue &getThreadQueue() {
+#if OSVR_BINARY_LOG_RECYCLE_QUEUES
+                    static thread_local ThreadQueueClaim claim;
+                    auto &queue = claim.queue;
+#else
+                    static OSVR_BINARY_LOG_THREAD_LOCAL ThreadQueue *queue =
+                        nullptr;
+#endif
+                    if (!queue) {
+                        queue = m_claimQueue();
+                    }
+                    return *queue;
+                }
+
+                void drain() {
+                    std::lock_guard<std::mutex> drainLock(m_drainMutex);
+                    std::vector<ThreadQueue *> queues;
+                    {
+                        std::lock_guard<std::mutex> lock(m_mutex);
+                        for (auto &queue : m_queues) {
+                            queues.push_back(queue.get());
+                        }
+                    }
+                    for (auto queue : queues) {
+                        queue->records.drain([&](BinaryLogRecord &record) {
+                            m_handle(record);
+                        });
+                        auto dropped = queue->dropped.load();
+                        if (dropped != queue->reportedDropped) {
+                            m_generalLogger->warn()
+                                << "Binary log queue full: dropped "
+                                << dropped - queue->reportedDropped
+                                << " records";
+                            queue->reportedDropped = dropped;
+                        }
+                    }
+                    m_reportSuppressed();
+                }
+
+              private:
+                /// @brief Makes a logger right away so the log registry
+                /// is constructed first, and thus destroyed after us.
+                BinaryLogBackend()
+                    : m_generalLogger(make_logger(OSVR_GENERAL_LOG_NAME)) {}
+
+                /// @brief Logger names, and what is needed to handle their
+                /// records.
+                struct LoggerEntry {
+                    std::string name;
+                    /// @brief For the default handler.
+                    LoggerPtr text;
+                    std::vector<weak_ptr<BinaryLogger> > instances;
+                    /// @brief Rate-limited messages already reported.
+                    std::uint64_t reportedSuppressed = 0;
+                };
+
+                /// @brief Drain mutex held.
+                void m_handle(BinaryLogRecord const &record) {
+                    LoggerEntry *entry;
+                    {
+                        std::lock_guard<std::mutex> lock(m_mutex);
+                        if (record.logger >= m_loggers.size()) {
+                            return;
+                        }
+                        entry = m_loggers[record.logger].get();
+                    }
+                    if (m_handler) {
+                        m_handler(entry->name, record);
+                        return;
+                    }
+                    entry->text->log(record.level)
+                        << formatBinaryLogRecord(record);
+                }
+
+                /// @brief Drain mutex held.
+                void m_reportSuppressed() {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    for (auto &entry : m_loggers) {
+                        std::uint64_t suppressed = 0;
+                        for (auto &weak : entry->instances) {
+                            auto logger = weak.lock();
+                            if (logger) {
+                                suppressed += logger->getSuppressedCount();
+                            }
+                        }
+                        if (suppressed > entry->reportedSuppressed) {
+                            entry->text->notice()
+                                << "Rate limit suppressed "
+                                << suppressed - entry->reportedSuppressed
+                                << " binary log messages";
+                        }
+                        /// Can decrease if a logger instance went away.
+                        entry->reportedSuppressed = suppressed;
+                    }
+                }
+
+                ThreadQueue *m_claimQueue() {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    for (auto &queue : m_queues) {
+                        bool expected = false;
+                        /// Any records the previous owner left are still
+                        /// drained in order, before ours.
+                        if (queue->inUse.compare_exchange_strong(
+                                expected, true, std::memory_order_acquire)) {
+                            return queue.get();
+                        }
+                    }
+                    m_queues.emplace_back(new ThreadQueue);
+                    return m_queues.back().get();
+                }
+
+                /// @brief m_mutex held.
+                void m_startThread() {
+                    if (m_thread.joinable()) {
+                        return;
+                    }
+                    m_running = true;
+                    m_thread = std::thread([&] {
+                        std::unique_lock<std::mutex> lock(m_threadMutex);
+                        while (m_running) {
+                            m_wake.wait_for(lock, DRAIN_INTERVAL);
+                            lock.unlock();
+                            drain();
+                            lock.lock();
+                        }
+                    });
+                }
+
+                /// @brief Protects the formats, loggers, and queue list.
+                std::mutex m_mutex;
+                std::vector<const char *> m_formats;
+                std::map<std::string, std::uint16_t> m_loggerIds;
+                /// @brief Indexed by logger ID; entries never move.
+                std::vector<std::unique_ptr<LoggerEntry> > m_loggers;
+                std::vector<std::unique_ptr<ThreadQueue> > m_queues;
+
+                /// @brief Makes one thread at a time the queues' consumer.
+                std::mutex m_drainMutex;
+                BinaryLogHandler m_handler;
+                LoggerPtr m_generalLogger;
+
+                std::mutex m_threadMutex;
+                std::condition_variable m_wake;
+                bool m_running = false;
+                std::thread m_thread;
+            };
+
+            void appendArg(std::ostream &os, BinaryLogRecord const &record,
+                           BinaryLogArg const &arg) {
+                switch (arg.type) {
+                case BinaryLogArg::Int:
+                    os << arg.value.i;
+                    break;
+                case BinaryLogArg::UInt:
+                    os << arg.value.u;
+                    break;
+                case BinaryLogArg::Double:
+                    os << arg.value.d;
+                    break;
+                case BinaryLogArg::Bool:
+                    os << (arg.value.b ? "true" : "false");
+                    break;
+                case BinaryLogArg::Pointer:
+                    os << arg.value.p;
+                    break;
+                case BinaryLogArg::Text:
+                    os.write(record.text + arg.value.text.offset,
+                             arg.value.text.length);
+                    break;
+                }
+            }
+        } // namespace
+
+        BinaryLogFormatId registerBinaryLogFormat(const char *format) {
+            return BinaryLogBackend::get().registerFormat(format);
+        }
+
+        const char *getBinaryLogFormat(BinaryLogFormatId id) {
+            return BinaryLogBackend::get().getFormat(id);
+        }
+
+        std::string formatBinaryLogRecord(BinaryLogRecord const &record) {
+            std::ostringstream os;
+            auto format = getBinaryLogFormat(record.format);
+            if (!format) {
+                os << "[unknown binary log format " << record.format << "]";
+                return os.str();
+            }
+            std::size_t nextArg = 0;
+            for (auto c = format; *c; ++c) {
+                if (c[0] == '{' && c[1] == '}' && nextArg < record.argCount) {
+                    appendArg(os, record, record.args[nextArg]);
+                    ++nextArg;
+                    ++c;
+                } else {
+                    os << *c;
+                }
+            }
+            return os.str();
+        }
+
+        void setBinaryLogHandler(BinaryLogHandler handler) {
+            BinaryLogBackend::get().setHandler(handler);
+        }
+
+        void flushBinaryLogs() { BinaryLogBackend::get().drain(); }
+
+        BinaryLoggerPtr makeBinaryLogger(std::string const &name) {
+            return BinaryLogBackend::get().makeLogger(name);
+        }
+
+        BinaryLogger::BinaryLogger(std::string const &name, std::uint16_t id)
+            : m_name(name), m_id(id), m_level(DEFAULT_LEVEL), m_rateLimit(0),
+              m_window(0), m_windowCount(0), m_suppressed(0) {}
+
+        void BinaryLogger::m_submit(BinaryLogRecord const &record) {
+            auto &queue = BinaryLogBackend::get().getThreadQueue();
+            if (!queue.records.write(record)) {
+                queue.dropped++;
+            }
+        }
+
+    } // namespace log
+} // namespace util
+} // namespace osvr
@@ -0,0 +1,355 @@
+/** @file
+    @brief Implementation
+
+    @date 2017
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2017 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// Internal Includes
+#include "BenchmarkHarness.h"
+
+// Library/third-party includes
+#include <json/value.h>
+#include <json/writer.h>
+
+// Standard includes
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <ctime>
+#include <fstream>
+#include <iostream>
+#include <numeric>
+#include <sstream>
+
+namespace osvr {
+namespace benchmark {
+    namespace {
+        struct Registration {
+            std::string name;
+            BenchmarkFunction f;
+            std::vector<std::int64_t> args;
+        };
+
+        std::vector<Registration> &getRegistry() {
+            static std::vector<Registration> registry;
+            return registry;
+        }
+
+        struct Options {
+            std::string filter;
+            /// @brief Seconds each repetition should take, roughly.
+            double minTime = 0.1;
+            std::size_t repetitions = 5;
+            std::string format = "json";
+            std::string outFile;
+            bool list = false;
+        };
+
+        struct Result {
+            std::string name;
+            std::size_t iterations = 0;
+            /// @brief Nanoseconds per iteration, one per repetition.
+            std::vector<double> samples;
+            std::size_t bytes = 0;
+            std::size_t items = 0;
+            std::string skipReason;
+
+            double min() const {
+                return *std::min_element(samples.begin(), samples.end());
+            }
+            double median() const {
+                auto sorted = samples;
+                std::sort(sorted.begin(), sorted.end());
+                auto mid = sorted.size() / 2;
+                return sorted.size() % 2
+                           ? sorted[mid]
+                           : (sorted[mid - 1] + sorted[mid]) / 2;
+            }
+            double mean() const {
+                return std::accumulate(samples.begin(), samples.end(), 0.) /
+                       samples.size();
+            }
+            double stddev() const {
+                auto m = mean();
+                double sum = 0;
+                for (auto s : samples) {
+                    sum += (s - m) * (s - m);
+                }
+                return std::sqrt(sum / samples.size());
+            }
+            /// @brief Throughput, per second, of a quantity processed per
+            /// iteration, based on the median time.
+            double perSecond(std::size_t perIteration) const {
+                return perIteration * 1e9 / median();
+            }
+        };
+
+        double toNanoseconds(Clock::duration d) {
+            return std::chrono::duration<double, std::nano>(d).count();
+        }
+
+        /// @brief Runs the benchmark once with the given iteration count.
+        State runOnce(Registration const &reg, std::int64_t arg,
+                      std::size_t iterations) {
+            State state(iterations, arg);
+            reg.f(state);
+            return state;
+        }
+
+        Result runBenchmark(Registration const &reg, std::int64_t arg,
+                            std::string const &name, Options const &opts) {
+            Result ret;
+            ret.name = name;
+            /// Grow the iteration count until a run takes long enough to time
+            /// reliably, then scale it to the requested time per repetition.
+            static const std::size_t MAX_ITERATIONS = 1000000000;
+            auto const target = opts.minTime * 1e9;
+            std::size_t iterations = 1;
+            while (true) {
+                auto state = runOnce(reg, arg, iterations);
+                if (state.skipped()) {
+                    ret.skipReason = state.skipReason();
+                    return ret;
+                }
+                auto elapsed = toNanoseconds(state.elapsed());
+                if (elapsed >= target / 10 || iterations >= MAX_ITERATIONS) {
+                    auto scaled = elapsed > 0 ? iterations * target / elapsed
+                                              : double(MAX_ITERATIONS);
+                    iterations = static_cast<std::size_t>(
+                        std::min(std::max(scaled, 1.), double(MAX_ITERATIONS)));
+                    break;
+                }
+                iterations *= 10;
+            }
+            ret.iterations = iterations;
+            for (std::size_t i = 0; i < opts.repetitions; ++i) {
+                auto state = runOnce(reg, arg, iterations);
+                ret.samples.push_back(toNanoseconds(state.elapsed()) /
+                                      iterations);
+                ret.bytes = state.bytesPerIteration();
+                ret.items = state.itemsPerIteration();
+            }
+            return ret;
+        }
+
+        std::string getTimestamp() {
+            auto now = std::time(nullptr);
+            char buf[32] = {0};
+            std::strftime(buf, sizeof(buf), "%Y-%m-%dT%H:%M:%SZ",
+                          std::gmtime(&now));
+            return buf;
+        }
+
+        std::string getCompiler() {
+            std::ostringstream os;
+#if defined(_MSC_VER)
+            os << "MSVC " << _MSC_VER;
+#elif defined(__clang__)
+            os << "Clang " << __clang_version__;
+#elif defined(__GNUC__)
+            os << "GCC " << __VERSION__;
+#else
+            os << "unknown";
+#endif
+            return os.str();
+        }
+
+        void writeJson(std::ostream &os, std::vector<Result> const &results,
+                       Options const &opts) {
+            Json::Value root(Json::objectValue);
+            auto &context = root["context"];
+            context["osvr_version"] = OSVR_BENCHMARK_VERSION;
+            context["compiler"] = getCompiler();
+#ifdef NDEBUG
+            context["build"] = "release";
+#else
+            context["build"] = "debug";
+#endif
+            context["date"] = getTimestamp();
+            context["min_time"] = opts.minTime;
+            context["repetitions"] = Json::UInt64(opts.repetitions);
+            auto &benchmarks = root["benchmarks"];
+            benchmarks = Json::Value(Json::arrayValue);
+            for (auto const &result : results) {
+                Json::Value entry(Json::objectValue);
+                entry["name"] = result.name;
+                if (!result.skipReason.empty()) {
+                    entry["skipped"] = result.skipReason;
+                    benchmarks.append(entry);
+                    continue;
+                }
+                entry["iterations"] = Json::UInt64(result.iterations);
+                auto &ns = entry["ns_per_iteration"];
+                ns["min"] = result.min();
+                ns["median"] = result.median();
+                ns["mean"] = result.mean();
+                ns["stddev"] = result.stddev();
+                if (result.bytes) {
+                    entry["bytes_per_second"] = result.perSecond(result.bytes);
+                }
+                if (result.items) {
+                    entry["items_per_second"] = result.perSecond(result.items);
+                }
+                benchmarks.append(entry);
+            }
+            Json::StyledStreamWriter writer;
+            writer.write(os, root);
+        }
+
+        void writeCsv(std::ostream &os, std::vector<Result> const &results) {
+            os << "name,iterations,min_ns,median_ns,mean_ns,stddev_ns,"
+                  "bytes_per_second,items_per_second,skipped\n";
+            for (auto const &result : results) {
+                os << result.name << ",";
+                if (!result.skipReason.empty()) {
+                    os << ",,,,,,," << result.skipReason << "\n";
+                    continue;
+                }
+                os << result.iterations << "," << result.min() << ","
+                   << result.median() << "," << result.mean() << ","
+                   << result.stddev() << ",";
+                if (result.bytes) {
+                    os << result.perSecond(result.bytes);
+                }
+                os << ",";
+                if (result.items) {
+                    os << result.perSecond(result.items);
+                }
+                os << ",\n";
+            }
+        }
+
+        void printUsage(const char *name) {
+            std::cout
+                << "Usage: " << name << " [options]\n"
+                << "  --filter=TEXT       Only run benchmarks whose name "
+                   "contains TEXT\n"
+                << "  --min-time=SECONDS  Approximate duration of each "
+                   "repetition (default 0.1)\n"
+                << "  --repetitions=N     Timed repetitions of each "
+                   "benchmark (default 5)\n"
+                << "  --format=json|csv   Output format (default json)\n"
+                << "  --out=FILE          Write results to FILE instead of "
+                   "stdout\n"
+                << "  --list              List benchmark names and exit\n";
+        }
+
+        /// @brief Gets the value if the argument is --name=value
+        bool getOptionValue(std::string const &arg, const char *name,
+                            std::string &value) {
+            auto prefix = std::string("--") + name + "=";
+            if (arg.compare(0, prefix.size(), prefix) != 0) {
+                return false;
+            }
+            value = arg.substr(prefix.size());
+            return true;
+        }
+    } // namespace
+
+    bool registerBenchmark(std::string const &name, BenchmarkFunction f,
+                           std::vector<std::int64_t> const &args) {
+        getRegistry().push_back(Registration{name, f, args});
+        return true;
+    }
+
+    int runBenchmarks(int argc, char *argv[]) {
+        Options opts;
+        for (int i = 1; i < argc; ++i) {
+            std::string arg = argv[i];
+            std::string value;
+            if (arg == "--help" || arg == "-h") {
+                printUsage(argv[0]);
+                return 0;
+            } else if (arg == "--list") {
+                opts.list = true;
+            } else if (getOptionValue(arg, "filter", value)) {
+                opts.filter = value;
+            } else if (getOptionValue(arg, "min-time", value)) {
+                opts.minTime = std::atof(value.c_str());
+            } else if (getOptionValue(arg, "repetitions", value)) {
+                opts.repetitions = std::max(1, std::atoi(value.c_str()));
+            } else if (getOptionValue(arg, "format", value) &&
+                       (value == "json" || value == "csv")) {
+                opts.format = value;
+            } else if (getOptionValue(arg, "out", value)) {
+                opts.outFile = value;
+            } else {
+                std::cerr << "Unrecognized argument: " << arg << "\n";
+                printUsage(argv[0]);
+                return 1;
+            }
+        }
+
+        auto registry = getRegistry();
+        std::sort(registry.begin(), registry.end(),
+                  [](Registration const &a, Registration const &b) {
+                      return a.name < b.name;
+                  });
+        std::vector<Result> results;
+        for (auto const &reg : registry) {
+            auto args = reg.args;
+            bool useArg = !args.empty();
+            if (!useArg) {
+                args.push_back(0);
+            }
+            for (auto arg : args) {
+                auto name = reg.name;
+                if (useArg) {
+                    name += "/" + std::to_string(arg);
+                }
+                if (name.find(opts.filter) == std::string::npos) {
+                    continue;
+                }
+                if (opts.list) {
+                    std::cout << name << "\n";
+                    continue;
+                }
+                std::cerr << "Running " << name << "..." << std::endl;
+                results.push_back(runBenchmark(reg, arg, name, opts));
+            }
+        }
+        if (opts.list) {
+            return 0;
+        }
+
+        std::ofstream file;
+        if (!opts.outFile.empty()) {
+            file.open(opts.outFile.c_str());
+            if (!file) {
+                std::cerr << "Could not open " << opts.outFile << "\n";
+                return 1;
+            }
+        }
+        std::ostream &os = opts.outFile.empty() ? std::cout : file;
+        if (opts.format == "csv") {
+            writeCsv(os, results);
+        } else {
+            writeJson(os, results, opts);
+        }
+        return 0;
+    }
+} // namespace benchmark
+} // namespace osvr
+
+int main(int argc, char *argv[]) {
+    return osvr::benchmark::runBenchmarks(argc, argv);
+}
@@ -0,0 +1,135 @@
+/** @file
+    @brief Header
+
+    @date 2017
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2017 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef INCLUDED_BenchmarkHarness_h_GUID_B39073C1_B380_49BA_8095_3C3C669FCECE
+#define INCLUDED_BenchmarkHarness_h_GUID_B39073C1_B380_49BA_8095_3C3C669FCECE
+
+// Internal Includes
+// - none
+
+// Library/third-party includes
+// - none
+
+// Standard includes
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace osvr {
+namespace benchmark {
+    typedef std::chrono::steady_clock Clock;
+
+    /// @brief Passed to a benchmark function each time the harness runs it:
+    /// says how many iterations to time, and collects what they processed.
+    class State {
+      public:
+        State(std::size_t iterations, std::int64_t arg)
+            : m_iterations(iterations), m_arg(arg) {}
+
+        std::size_t iterations() const { return m_iterations; }
+
+        /// @brief The parameter of this run, for benchmarks registered with
+        /// a list of them (0 otherwise).
+        std::int64_t arg() const { return m_arg; }
+
+        /// @brief Calls f() iterations() times, timing only that: do any
+        /// setup before calling this. Call it once per run.
+        template <typename F> void measure(F &&f) {
+            auto const start = Clock::now();
+            for (std::size_t i = 0; i < m_iterations; ++i) {
+                f();
+            }
+            m_elapsed += Clock::now() - start;
+        }
+
+        /// @brief For reporting throughput in bytes per second.
+        void setBytesPerIteration(std::size_t bytes) { m_bytes = bytes; }
+        /// @brief For reporting throughput in items per second.
+        void setItemsPerIteration(std::size_t items) { m_items = items; }
+
+        /// @brief Skip this benchmark, for instance if its input data or a
+        /// required system facility is unavailable.
+        void skip(std::string const &reason) { m_skipReason = reason; }
+
+        Clock::duration elapsed() const { return m_elapsed; }
+        std::size_t bytesPerIteration() const { return m_bytes; }
+        std::size_t itemsPerIteration() const { return m_items; }
+        bool skipped() const { return !m_skipReason.empty(); }
+        std::string const &skipReason() const { return m_skipReason; }
+
+      private:
+        std::size_t m_iterations;
+        std::int64_t m_arg;
+        Clock::duration m_elapsed = Clock::duration::zero();
+        std::size_t m_bytes = 0;
+        std::size_t m_items = 0;
+        std::string m_skipReason;
+    };
+
+    typedef std::function<void(State &)> BenchmarkFunction;
+
+    /// @brief Adds a benchmark to the suite, run once per argument given (or
+    /// once, with argument 0, if none). Use OSVR_BENCHMARK instead.
+    /// @return true, for use in static initializers.
+    bool registerBenchmark(std::string const &name, BenchmarkFunction f,
+                           std::vector<std::int64_t> const &args);
+
+    /// @brief Keeps the compiler from optimizing away the computation of a
+    /// value that a benchmark otherwise doesn't use.
+    template <typename T> inline void doNotOptimize(T const &val) {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "r,m"(val) : "memory");
+#else
+        static volatile char const *sink;
+        sink = reinterpret_cast<char const volatile *>(&val);
+#endif
+    }
+
+    /// @brief Runs the registered benchmarks per the command line (see
+    /// --help) and reports the results.
+    int runBenchmarks(int argc, char *argv[]);
+} // namespace benchmark
+} // namespace osvr
+
+/// @brief Defines a benchmark run once per argument listed, available as
+/// state.arg(): the body follows, as a function taking `State &state`.
+#define OSVR_BENCHMARK_WITH_ARGS(GROUP, NAME, ...)                             \
+    static void osvrBenchmark_##GROUP##_##NAME(                                \
+        ::osvr::benchmark::State &state);                                      \
+    static const bool osvrBenchmarkRegistered_##GROUP##_##NAME =               \
+        ::osvr::benchmark::registerBenchmark(                                  \
+            #GROUP "/" #NAME, &osvrBenchmark_##GROUP##_##NAME,                 \
+            std::vector<std::int64_t>{__VA_ARGS__});                           \
+    static void osvrBenchmark_##GROUP##_##NAME(                                \
+        ::osvr::benchmark::State &state)
+
+/// @brief Defines a benchmark: the body follows, as a function taking
+/// `State &state`.
+#define OSVR_BENCHMARK(GROUP, NAME) OSVR_BENCHMARK_WITH_ARGS(GROUP, NAME, )
+
+#endif // INCLUDED_BenchmarkHarness_h_GUID_B39073C1_B380_49BA_8095_3C3C669FCECE
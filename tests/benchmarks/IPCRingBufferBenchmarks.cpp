@@ -0,0 +1,114 @@
+/** @file
+    @brief Implementation
+
+    @date 2017
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2017 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// Internal Includes
+#include "BenchmarkHarness.h"
+#include <osvr/Common/IPCRingBuffer.h>
+
+// Library/third-party includes
+// - none
+
+// Standard includes
+#include <exception>
+#include <sstream>
+#include <vector>
+
+using osvr::common::IPCRingBuffer;
+using osvr::common::IPCRingBufferPtr;
+
+namespace {
+/// @brief Creates a ring buffer with entries of state.arg() bytes, skipping
+/// the benchmark if shared memory isn't available here.
+IPCRingBufferPtr createRingBuffer(osvr::benchmark::State &state,
+                                  bool lockFree) {
+    static int count = 0;
+    std::ostringstream os;
+    os << "com.osvr.benchmark/" << state.arg() << "/" << count++;
+    IPCRingBufferPtr ret;
+    try {
+        ret = IPCRingBuffer::create(
+            IPCRingBuffer::Options(os.str())
+                .setEntrySize(
+                    static_cast<IPCRingBuffer::entry_size_type>(state.arg()))
+                .setLockFree(lockFree));
+    } catch (std::exception &e) {
+        state.skip(std::string("Could not create shared memory: ") + e.what());
+        return ret;
+    }
+    if (!ret) {
+        state.skip("Could not create shared memory");
+    }
+    return ret;
+}
+
+void putGet(osvr::benchmark::State &state, bool lockFree) {
+    auto shm = createRingBuffer(state, lockFree);
+    if (!shm) {
+        return;
+    }
+    std::vector<IPCRingBuffer::value_type> data(
+        static_cast<std::size_t>(state.arg()), 0x5a);
+    state.setBytesPerIteration(data.size());
+    state.measure([&] {
+        auto seq = shm->put(data.data(), data.size());
+        auto proxy = shm->get(seq);
+        osvr::benchmark::doNotOptimize(proxy.get());
+    });
+}
+
+void putGetLatest(osvr::benchmark::State &state, bool lockFree) {
+    auto shm = createRingBuffer(state, lockFree);
+    if (!shm) {
+        return;
+    }
+    std::vector<IPCRingBuffer::value_type> data(
+        static_cast<std::size_t>(state.arg()), 0x5a);
+    state.setBytesPerIteration(data.size());
+    state.measure([&] {
+        shm->put(data.data(), data.size());
+        auto proxy = shm->getLatest();
+        osvr::benchmark::doNotOptimize(proxy.get());
+    });
+}
+} // namespace
+
+OSVR_BENCHMARK_WITH_ARGS(IPCRingBuffer, PutGet, 64, 4096, 65536, 1 << 20) {
+    putGet(state, false);
+}
+
+OSVR_BENCHMARK_WITH_ARGS(IPCRingBuffer, PutGetLatest, 64, 4096, 65536,
+                         1 << 20) {
+    putGetLatest(state, false);
+}
+
+OSVR_BENCHMARK_WITH_ARGS(IPCRingBuffer, LockFreePutGet, 64, 4096, 65536,
+                         1 << 20) {
+    putGet(state, true);
+}
+
+OSVR_BENCHMARK_WITH_ARGS(IPCRingBuffer, LockFreePutGetLatest, 64, 4096, 65536,
+                         1 << 20) {
+    putGetLatest(state, true);
+}
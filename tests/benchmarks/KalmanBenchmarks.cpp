@@ -0,0 +1,85 @@
+/** @file
+    @brief Implementation
+
+    @date 2017
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2017 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// Internal Includes
+#include "BenchmarkHarness.h"
+#include <osvr/Kalman/AbsoluteOrientationMeasurement.h>
+#include <osvr/Kalman/AbsolutePositionMeasurement.h>
+#include <osvr/Kalman/FlexibleKalmanFilter.h>
+#include <osvr/Kalman/PoseConstantVelocity.h>
+
+// Library/third-party includes
+#include <Eigen/Core>
+#include <Eigen/Geometry>
+
+// Standard includes
+// - none
+
+using ProcessModel = osvr::kalman::PoseConstantVelocityProcessModel;
+using State = ProcessModel::State;
+using AbsoluteOrientationMeasurement =
+    osvr::kalman::AbsoluteOrientationMeasurement<State>;
+using AbsolutePositionMeasurement =
+    osvr::kalman::AbsolutePositionMeasurement<State>;
+using Filter = osvr::kalman::FlexibleKalmanFilter<ProcessModel>;
+
+namespace {
+/// @brief Roughly a tracking camera frame interval.
+static const double DT = 0.01;
+} // namespace
+
+OSVR_BENCHMARK(Kalman, Predict) {
+    auto filter = Filter{};
+    state.setItemsPerIteration(1);
+    state.measure([&] {
+        filter.predict(DT);
+        osvr::benchmark::doNotOptimize(filter.state());
+    });
+}
+
+OSVR_BENCHMARK(Kalman, PredictCorrectPosition) {
+    auto filter = Filter{};
+    auto meas = AbsolutePositionMeasurement{
+        Eigen::Vector3d::Zero(), Eigen::Vector3d::Constant(0.000007)};
+    state.setItemsPerIteration(1);
+    state.measure([&] {
+        filter.predict(DT);
+        filter.correct(meas);
+        osvr::benchmark::doNotOptimize(filter.state());
+    });
+}
+
+OSVR_BENCHMARK(Kalman, PredictCorrectOrientation) {
+    auto filter = Filter{};
+    auto meas = AbsoluteOrientationMeasurement{
+        Eigen::Quaterniond::Identity(),
+        Eigen::Vector3d(0.00001, 0.00001, 0.00001)};
+    state.setItemsPerIteration(1);
+    state.measure([&] {
+        filter.predict(DT);
+        filter.correct(meas);
+        osvr::benchmark::doNotOptimize(filter.state());
+    });
+}
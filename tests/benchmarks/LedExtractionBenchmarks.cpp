@@ -0,0 +1,136 @@
+/** @file
+    @brief Implementation
+
+    @date 2017
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2017 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// Internal Includes
+#include "BenchmarkHarness.h"
+#include <BlobParams.h>
+#include <EdgeHoleBasedLedExtractor.h>
+#include <FusedEdgeDetection.h>
+
+// Library/third-party includes
+#include <opencv2/core/core.hpp>
+#include <opencv2/highgui/highgui.hpp>
+#include <opencv2/imgproc/imgproc.hpp>
+
+// Standard includes
+#include <string>
+#include <vector>
+
+using osvr::vbtracker::BlobParams;
+using osvr::vbtracker::EdgeHoleBasedLedExtractor;
+using osvr::vbtracker::EdgeHoleParams;
+using osvr::vbtracker::FusedEdgeDetector;
+
+namespace {
+/// @brief Loads the HDK sample images once, converted to grayscale like
+/// frames from the tracking camera.
+std::vector<cv::Mat> const &getHDKImages() {
+    static const std::vector<cv::Mat> images = [] {
+        std::vector<cv::Mat> ret;
+        for (int i = 1; i <= 8; ++i) {
+            auto fn = std::string(OSVR_BENCHMARK_HDK_IMAGE_DIR) + "/000" +
+                      std::to_string(i) + ".tif";
+            cv::Mat color = cv::imread(fn, cv::IMREAD_COLOR);
+            if (!color.data) {
+                continue;
+            }
+            cv::Mat gray;
+            cv::cvtColor(color, gray, cv::COLOR_BGR2GRAY);
+            ret.push_back(gray);
+        }
+        return ret;
+    }();
+    return images;
+}
+} // namespace
+
+OSVR_BENCHMARK(LedExtraction, EdgeHoleHDKImages) {
+    auto const &images = getHDKImages();
+    if (images.empty()) {
+        state.skip("Could not load HDK sample images from " +
+                   std::string(OSVR_BENCHMARK_HDK_IMAGE_DIR));
+        return;
+    }
+    EdgeHoleBasedLedExtractor extractor{EdgeHoleParams{}};
+    BlobParams params{};
+    std::size_t i = 0;
+    state.setItemsPerIteration(1);
+    state.setBytesPerIteration(images.front().total());
+    state.measure([&] {
+        auto const &leds = extractor(images[i], params);
+        osvr::benchmark::doNotOptimize(leds.size());
+        i = (i + 1) % images.size();
+    });
+}
+
+/// The edge detection stage alone, as the extractor's separate OpenCV passes.
+OSVR_BENCHMARK(LedExtraction, EdgeDetectionOpenCV) {
+    auto const &images = getHDKImages();
+    if (images.empty()) {
+        state.skip("Could not load HDK sample images from " +
+                   std::string(OSVR_BENCHMARK_HDK_IMAGE_DIR));
+        return;
+    }
+    EdgeHoleParams params{};
+    cv::Mat blurred, edge, edgeTemp, edgeBinary;
+    std::size_t i = 0;
+    state.setItemsPerIteration(1);
+    state.setBytesPerIteration(images.front().total());
+    state.measure([&] {
+        auto blurSize = cv::Size(params.preEdgeDetectionBlurSize,
+                                 params.preEdgeDetectionBlurSize);
+        cv::GaussianBlur(images[i], blurred, blurSize, 0, 0);
+        cv::Laplacian(blurred, edge, CV_8U, params.laplacianKSize,
+                      params.laplacianScale);
+        auto postBlurSize = cv::Size(params.postEdgeDetectionBlurSize,
+                                     params.postEdgeDetectionBlurSize);
+        cv::GaussianBlur(edge, edgeTemp, postBlurSize, 0, 0);
+        cv::threshold(edgeTemp, edgeBinary,
+                      params.postEdgeDetectionBlurThreshold, 255,
+                      cv::THRESH_BINARY);
+        osvr::benchmark::doNotOptimize(edgeBinary.data);
+        i = (i + 1) % images.size();
+    });
+}
+
+/// The same edge detection stage, through the fused single-pass kernel.
+OSVR_BENCHMARK(LedExtraction, EdgeDetectionFused) {
+    auto const &images = getHDKImages();
+    if (images.empty()) {
+        state.skip("Could not load HDK sample images from " +
+                   std::string(OSVR_BENCHMARK_HDK_IMAGE_DIR));
+        return;
+    }
+    FusedEdgeDetector detector{EdgeHoleParams{}};
+    cv::Mat edge, edgeBinary;
+    std::size_t i = 0;
+    state.setItemsPerIteration(1);
+    state.setBytesPerIteration(images.front().total());
+    state.measure([&] {
+        detector(images[i], edge, edgeBinary);
+        osvr::benchmark::doNotOptimize(edgeBinary.data);
+        i = (i + 1) % images.size();
+    });
+}
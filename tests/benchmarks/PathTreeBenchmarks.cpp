@@ -0,0 +1,92 @@
+/** @file
+    @brief Implementation
+
+    @date 2017
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2017 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// Internal Includes
+#include "BenchmarkHarness.h"
+#include <osvr/Common/PathElementTypes.h>
+#include <osvr/Common/PathTreeFull.h>
+#include <osvr/Common/ResolveTreeNode.h>
+
+// Library/third-party includes
+// - none
+
+// Standard includes
+#include <string>
+#include <vector>
+
+using osvr::common::PathTree;
+using namespace osvr::common::elements;
+
+namespace {
+/// @brief Fills the tree with the given number of tracker devices, like the
+/// tree a server with that many devices would have, and gives each sensor an
+/// alias. Returns the alias paths.
+std::vector<std::string> setupTree(PathTree &tree, std::size_t devices) {
+    static const auto plugin = std::string("com_osvr_benchmark");
+    tree.getNodeByPath("/" + plugin, PluginElement());
+    std::vector<std::string> aliases;
+    for (std::size_t i = 0; i < devices; ++i) {
+        auto device = plugin + "/Device" + std::to_string(i);
+        tree.getNodeByPath("/" + device,
+                           DeviceElement::createVRPNDeviceElement(
+                               device, "localhost:3883"));
+        tree.getNodeByPath("/" + device + "/tracker", InterfaceElement());
+        auto alias = "/me/devices/" + std::to_string(i);
+        tree.getNodeByPath(alias,
+                           AliasElement("/" + device + "/tracker/0"));
+        aliases.push_back(alias);
+    }
+    return aliases;
+}
+} // namespace
+
+OSVR_BENCHMARK_WITH_ARGS(PathTree, ResolveAlias, 10, 100, 1000) {
+    PathTree tree;
+    auto aliases = setupTree(tree, static_cast<std::size_t>(state.arg()));
+    std::size_t i = 0;
+    state.setItemsPerIteration(1);
+    state.measure([&] {
+        auto source = osvr::common::resolveTreeNode(tree, aliases[i]);
+        osvr::benchmark::doNotOptimize(source);
+        i = (i + 1) % aliases.size();
+    });
+}
+
+OSVR_BENCHMARK_WITH_ARGS(PathTree, ResolveAliasChain, 1, 4, 16) {
+    PathTree tree;
+    auto aliases = setupTree(tree, 1000);
+    /// Each link in the chain points to the one before it.
+    auto target = aliases.back();
+    for (std::int64_t i = 0; i < state.arg(); ++i) {
+        auto link = "/chain/" + std::to_string(i);
+        tree.getNodeByPath(link, AliasElement(target));
+        target = link;
+    }
+    state.setItemsPerIteration(1);
+    state.measure([&] {
+        auto source = osvr::common::resolveTreeNode(tree, target);
+        osvr::benchmark::doNotOptimize(source);
+    });
+}
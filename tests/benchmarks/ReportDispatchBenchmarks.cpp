@@ -0,0 +1,103 @@
+/** @file
+    @brief Implementation
+
+    @date 2017
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2017 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// Internal Includes
+#include "BenchmarkHarness.h"
+#include "RemoteHandlerInternals.h"
+#include <osvr/Common/ClientContext.h>
+#include <osvr/Common/ClientInterface.h>
+#include <osvr/Common/PathTree.h>
+#include <osvr/Common/Transform.h>
+#include <osvr/Util/ClientCallbackTypesC.h>
+#include <osvr/Util/ClientReportTypesC.h>
+#include <osvr/Util/Pose3C.h>
+#include <osvr/Util/TimeValue.h>
+
+// Library/third-party includes
+// - none
+
+// Standard includes
+#include <string>
+
+namespace common = osvr::common;
+
+namespace {
+/// @brief A client context with no connection, just enough to own
+/// interfaces that reports are dispatched to.
+class DispatchContext : public ::OSVR_ClientContextObject {
+  public:
+    DispatchContext()
+        : ::OSVR_ClientContextObject("com.osvr.benchmark.dispatch",
+                                     &noDelete) {}
+
+  private:
+    static void noDelete(common::ClientContext *) {}
+    void m_update() override {}
+    void m_sendRoute(std::string const &) override {}
+    common::PathTree const &m_getPathTree() const override {
+        return m_pathTree;
+    }
+    common::Transform const &m_getRoomToWorldTransform() const override {
+        return m_roomToWorld;
+    }
+    void m_setRoomToWorldTransform(common::Transform const &xform) override {
+        m_roomToWorld = xform;
+    }
+    common::PathTree m_pathTree;
+    common::Transform m_roomToWorld;
+};
+
+void poseCallback(void *userdata, const OSVR_TimeValue *,
+                  const OSVR_PoseReport *report) {
+    auto &count = *static_cast<std::size_t *>(userdata);
+    count += static_cast<std::size_t>(report->sensor);
+}
+} // namespace
+
+/// Dispatches a pose report to the given number of interfaces, each with a
+/// callback registered, the way a remote handler does for each VRPN message.
+OSVR_BENCHMARK_WITH_ARGS(ReportDispatch, Pose, 1, 8, 64) {
+    DispatchContext ctx;
+    common::InterfaceList ifaces;
+    std::size_t callbackCount = 0;
+    for (std::int64_t i = 0; i < state.arg(); ++i) {
+        auto path = "/me/device" + std::to_string(i);
+        auto iface = ctx.getInterface(path.c_str());
+        iface->registerCallback(&poseCallback, &callbackCount);
+        ifaces.push_back(iface);
+    }
+    osvr::client::RemoteHandlerInternals internals(ifaces);
+
+    OSVR_PoseReport report;
+    report.sensor = 1;
+    osvrPose3SetIdentity(&report.pose);
+    OSVR_TimeValue timestamp;
+    osvr::util::time::getNow(timestamp);
+    state.setItemsPerIteration(ifaces.size());
+    state.measure([&] {
+        internals.setStateAndTriggerCallbacks(timestamp, report);
+        osvr::benchmark::doNotOptimize(callbackCount);
+    });
+}
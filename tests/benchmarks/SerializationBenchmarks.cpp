@@ -0,0 +1,108 @@
+/** @file
+    @brief Implementation
+
+    @date 2017
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2017 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// Internal Includes
+#include "BenchmarkHarness.h"
+#include <osvr/Common/Buffer.h>
+#include <osvr/Common/Serialization.h>
+#include <osvr/Util/ChannelCountC.h>
+#include <osvr/Util/Vec3C.h>
+
+// Library/third-party includes
+// - none
+
+// Standard includes
+#include <string>
+#include <vector>
+
+using osvr::common::Buffer;
+namespace serialization = osvr::common::serialization;
+
+namespace {
+/// @brief Shaped like the pose and tracker messages the server sends most.
+class PoseLikeMessage {
+  public:
+    template <typename T> void processMessage(T &p) {
+        p(sensor);
+        p(translation);
+        p(rotation[0]);
+        p(rotation[1]);
+        p(rotation[2]);
+        p(rotation[3]);
+    }
+    OSVR_ChannelCount sensor;
+    OSVR_Vec3 translation;
+    double rotation[4];
+};
+
+class StringMessage {
+  public:
+    template <typename T> void processMessage(T &p) { p(str); }
+    std::string str;
+};
+
+/// @brief Shaped like an image message: a block of aligned raw data.
+class DataBlockMessage {
+  public:
+    explicit DataBlockMessage(std::size_t len) : data(len) {}
+    template <typename T> void processMessage(T &p) {
+        p(data.data(), serialization::AlignedDataBufferTag(data.size(), 16));
+    }
+    std::vector<char> data;
+};
+
+template <typename Message>
+inline void roundTrip(Message &in, Message &out) {
+    Buffer<> buf;
+    osvr::common::serialize(buf, in);
+    auto reader = buf.startReading();
+    osvr::common::deserialize(reader, out);
+    osvr::benchmark::doNotOptimize(out);
+}
+} // namespace
+
+OSVR_BENCHMARK(Serialization, PoseRoundTrip) {
+    PoseLikeMessage in = {3, {{1., 2., 3.}}, {1., 0., 0., 0.}};
+    PoseLikeMessage out;
+    state.setItemsPerIteration(1);
+    state.measure([&] { roundTrip(in, out); });
+}
+
+OSVR_BENCHMARK_WITH_ARGS(Serialization, StringRoundTrip, 16, 256, 4096) {
+    StringMessage in;
+    in.str.assign(static_cast<std::size_t>(state.arg()), 'x');
+    StringMessage out;
+    state.setBytesPerIteration(in.str.size());
+    state.measure([&] { roundTrip(in, out); });
+}
+
+OSVR_BENCHMARK_WITH_ARGS(Serialization, AlignedDataRoundTrip, 1024, 65536,
+                         1 << 20) {
+    auto len = static_cast<std::size_t>(state.arg());
+    DataBlockMessage in(len);
+    DataBlockMessage out(len);
+    state.setBytesPerIteration(len);
+    state.measure([&] { roundTrip(in, out); });
+}
@@ -0,0 +1,179 @@
+/** @file
+    @brief Test Implementation
+
+    @date 2017
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2017 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// Internal Includes
+#include <osvr/Common/ImageLeaseManager.h>
+
+// Library/third-party includes
+#include "gtest/gtest.h"
+
+// Standard includes
+#include <algorithm>
+#include <vector>
+
+using osvr::common::ImageBufferPtr;
+using osvr::common::ImageData;
+using osvr::common::ImageLeaseAction;
+using osvr::common::ImageLeaseManager;
+using osvr::common::ImageLeasePolicy;
+using osvr::util::time::TimeValue;
+
+static const std::size_t FRAME_BYTES = 16;
+
+/// @brief Stands in for frames read from a shared memory ring: each pins a
+/// fake "entry", flagging when it's released.
+class ImageLeases : public ::testing::Test {
+  public:
+    ImageLeases() : mapping(osvr::make_shared<int>(0)) {}
+
+    ImageData frame(OSVR_ImageBufferElement fill) {
+        storage.emplace_back(FRAME_BYTES, fill);
+        released.push_back(false);
+        auto index = released.size() - 1;
+        ImageData data;
+        data.sensor = 0;
+        data.metadata = OSVR_ImagingMetadata{4, 4, 1, 1, OSVR_IVT_UNSIGNED_INT};
+        data.buffer = ImageBufferPtr(storage[index].data(),
+                                     [this, index](OSVR_ImageBufferElement *) {
+                                         released[index] = true;
+                                     });
+        data.mapping = mapping;
+        return data;
+    }
+
+    static TimeValue at(double seconds) {
+        TimeValue ret;
+        ret.seconds = static_cast<OSVR_TimeValue_Seconds>(seconds);
+        ret.microseconds = static_cast<OSVR_TimeValue_Microseconds>(
+            (seconds - ret.seconds) * 1e6);
+        return ret;
+    }
+
+    osvr::shared_ptr<void> mapping;
+    std::vector<std::vector<OSVR_ImageBufferElement>> storage;
+    std::vector<bool> released;
+    ImageLeaseManager leases;
+};
+
+TEST_F(ImageLeases, PassesThroughOtherFrames) {
+    auto data = frame(1);
+    data.mapping.reset();
+    auto buf = leases.lease(data, at(0));
+    ASSERT_EQ(data.buffer, buf);
+    ASSERT_EQ(0u, leases.getStats().pinned);
+}
+
+TEST_F(ImageLeases, PinsUntilFreed) {
+    auto buf = leases.lease(frame(1), at(0));
+    ASSERT_EQ(storage[0].data(), buf.get());
+    ASSERT_FALSE(released[0]);
+    ASSERT_EQ(1u, leases.getStats().pinned);
+
+    leases.update(at(0.01));
+    ASSERT_FALSE(released[0]);
+
+    buf.reset();
+    ASSERT_TRUE(released[0]);
+    ASSERT_EQ(0u, leases.getStats().pinned);
+}
+
+TEST_F(ImageLeases, CopiesOutOverPinLimit) {
+    ImageLeasePolicy policy;
+    policy.maxPinned = 2;
+    leases.setPolicy(policy);
+    auto a = leases.lease(frame(1), at(0));
+    auto b = leases.lease(frame(2), at(0));
+    auto c = leases.lease(frame(3), at(0));
+    ASSERT_NE(storage[2].data(), c.get());
+    ASSERT_TRUE(released[2]);
+    ASSERT_TRUE(std::equal(storage[2].begin(), storage[2].end(), c.get()));
+    ASSERT_FALSE(released[0]);
+    ASSERT_FALSE(released[1]);
+
+    auto stats = leases.getStats();
+    ASSERT_EQ(2u, stats.pinned);
+    ASSERT_EQ(1u, stats.copied);
+    ASSERT_EQ(0u, stats.revoked);
+
+    /// Freeing a pinned frame makes room again.
+    a.reset();
+    auto d = leases.lease(frame(4), at(0));
+    ASSERT_EQ(storage[3].data(), d.get());
+}
+
+TEST_F(ImageLeases, CopiesOutWhileOverdue) {
+    auto a = leases.lease(frame(1), at(0));
+    leases.update(at(1));
+    ASSERT_FALSE(released[0]);
+    auto b = leases.lease(frame(2), at(1));
+    ASSERT_NE(storage[1].data(), b.get());
+    ASSERT_EQ(1u, leases.getStats().copied);
+
+    a.reset();
+    leases.update(at(1.01));
+    auto c = leases.lease(frame(3), at(1.01));
+    ASSERT_EQ(storage[2].data(), c.get());
+}
+
+TEST_F(ImageLeases, RevokesOverdue) {
+    ImageLeasePolicy policy;
+    policy.action = ImageLeaseAction::Revoke;
+    leases.setPolicy(policy);
+    auto a = leases.lease(frame(1), at(0));
+    auto b = leases.lease(frame(2), at(0.5));
+    leases.update(at(0.55));
+    ASSERT_TRUE(released[0]);
+    ASSERT_FALSE(released[1]);
+    ASSERT_EQ(storage[0].data(), a.get());
+    ASSERT_TRUE(leases.isRevoked(a.get()));
+    ASSERT_FALSE(leases.isRevoked(b.get()));
+
+    auto stats = leases.getStats();
+    ASSERT_EQ(1u, stats.pinned);
+    ASSERT_EQ(1u, stats.revoked);
+    ASSERT_EQ(0u, stats.copied);
+}
+
+TEST_F(ImageLeases, RevokesOldestOverPinLimit) {
+    ImageLeasePolicy policy;
+    policy.action = ImageLeaseAction::Revoke;
+    policy.maxPinned = 2;
+    leases.setPolicy(policy);
+    auto a = leases.lease(frame(1), at(0));
+    auto b = leases.lease(frame(2), at(0));
+    auto c = leases.lease(frame(3), at(0));
+    ASSERT_TRUE(released[0]);
+    ASSERT_FALSE(released[1]);
+    ASSERT_FALSE(released[2]);
+    ASSERT_EQ(storage[2].data(), c.get());
+    ASSERT_EQ(2u, leases.getStats().pinned);
+    ASSERT_EQ(1u, leases.getStats().revoked);
+}
+
+TEST_F(ImageLeases, CountsDroppedFrames) {
+    leases.recordDropped(3);
+    leases.recordDropped(0);
+    ASSERT_EQ(3u, leases.getStats().dropped);
+}
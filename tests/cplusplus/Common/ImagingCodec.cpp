@@ -0,0 +1,99 @@
+/** @file
+    @brief Test Implementation
+
+    @date 2017
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2017 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include "../../../src/osvr/Common/ImagingCodec.h"
+#include "../../../src/osvr/Common/ImagingCodec.cpp"
+
+// Library/third-party includes
+#include "gtest/gtest.h"
+
+// Standard includes
+#include <vector>
+
+using namespace osvr::common::imaging_codec;
+typedef std::vector<uint8_t> ByteVec;
+
+/// A mostly-black "frame" with a few bright spots.
+static ByteVec makeSparseFrame(std::size_t len, std::size_t offset) {
+    ByteVec ret(len, 0);
+    for (std::size_t i = offset; i < len; i += 97) {
+        ret[i] = static_cast<uint8_t>(200 + i % 50);
+        if (i + 1 < len) {
+            ret[i + 1] = 1;
+        }
+    }
+    return ret;
+}
+
+TEST(ImagingCodec, SparseRoundTrip) {
+    auto frame = makeSparseFrame(4096, 3);
+    ByteVec encoded;
+    ASSERT_TRUE(encode(frame.data(), nullptr, frame.size(), encoded));
+    ASSERT_LT(encoded.size(), frame.size() / 4);
+
+    ByteVec decoded(frame.size(), 0xff);
+    ASSERT_TRUE(decode(encoded.data(), encoded.size(), nullptr,
+                       decoded.data(), decoded.size()));
+    ASSERT_EQ(frame, decoded);
+}
+
+TEST(ImagingCodec, DeltaRoundTrip) {
+    /// Bright background that barely changes between frames.
+    ByteVec previous(4096, 128);
+    ByteVec frame = previous;
+    frame[10] = 255;
+    frame[4095] = 3;
+
+    ByteVec encoded;
+    ASSERT_FALSE(encode(frame.data(), nullptr, frame.size(), encoded))
+        << "Should not be compressible without the reference frame";
+    ASSERT_TRUE(
+        encode(frame.data(), previous.data(), frame.size(), encoded));
+
+    ByteVec decoded(frame.size());
+    ASSERT_TRUE(decode(encoded.data(), encoded.size(), previous.data(),
+                       decoded.data(), decoded.size()));
+    ASSERT_EQ(frame, decoded);
+}
+
+TEST(ImagingCodec, IncompressibleRejected) {
+    ByteVec frame(1000);
+    for (std::size_t i = 0; i < frame.size(); ++i) {
+        frame[i] = static_cast<uint8_t>(i % 255 + 1);
+    }
+    ByteVec encoded;
+    ASSERT_FALSE(encode(frame.data(), nullptr, frame.size(), encoded));
+}
+
+TEST(ImagingCodec, WrongLengthRejected) {
+    auto frame = makeSparseFrame(1000, 0);
+    ByteVec encoded;
+    ASSERT_TRUE(encode(frame.data(), nullptr, frame.size(), encoded));
+    ByteVec decoded(frame.size() + 1);
+    ASSERT_FALSE(decode(encoded.data(), encoded.size(), nullptr,
+                        decoded.data(), decoded.size()));
+    ASSERT_FALSE(decode(encoded.data(), encoded.size() - 1, nullptr,
+                        decoded.data(), frame.size()));
+}
@@ -0,0 +1,97 @@
+/** @file
+    @brief Test Implementation
+
+    @date 2017
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2017 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// Internal Includes
+#include <osvr/Common/LocalReportDispatcher.h>
+
+// Library/third-party includes
+#include "gtest/gtest.h"
+
+// Standard includes
+#include <vector>
+
+using osvr::common::LocalReportDispatcher;
+using osvr::common::LocalReportSubscriptionPtr;
+using osvr::util::time::TimeValue;
+
+TEST(LocalReportDispatcher, UnknownDeviceIsNull) {
+    LocalReportDispatcher dispatcher;
+    ASSERT_FALSE(bool(dispatcher.getDevice("org_osvr_test/Tracker")));
+    auto publisher = dispatcher.getPublisher("org_osvr_test/Tracker");
+    ASSERT_TRUE(bool(publisher));
+    ASSERT_EQ(publisher, dispatcher.getDevice("org_osvr_test/Tracker"));
+    ASSERT_EQ(publisher, dispatcher.getPublisher("org_osvr_test/Tracker"));
+    ASSERT_FALSE(bool(dispatcher.getDevice("org_osvr_test/Other")));
+}
+
+TEST(LocalReportDispatcher, DeliversOnlyWhileSubscribed) {
+    LocalReportDispatcher dispatcher;
+    auto publisher = dispatcher.getPublisher("org_osvr_test/Tracker");
+    ASSERT_FALSE(publisher->hasSubscribers<OSVR_PoseReport>());
+
+    std::vector<OSVR_ChannelCount> sensors;
+    TimeValue lastTime = {};
+    auto device = dispatcher.getDevice("org_osvr_test/Tracker");
+    LocalReportSubscriptionPtr sub = device->subscribe<OSVR_PoseReport>(
+        [&](TimeValue const &timestamp, OSVR_PoseReport const &report) {
+            sensors.push_back(report.sensor);
+            lastTime = timestamp;
+        });
+    ASSERT_TRUE(publisher->hasSubscribers<OSVR_PoseReport>());
+    ASSERT_FALSE(publisher->hasSubscribers<OSVR_VelocityReport>());
+
+    OSVR_PoseReport report = {};
+    report.sensor = 2;
+    TimeValue now = {10, 500};
+    publisher->publish(now, report);
+    OSVR_VelocityReport vel = {};
+    publisher->publish(now, vel);
+    ASSERT_EQ(std::vector<OSVR_ChannelCount>{2}, sensors);
+    ASSERT_EQ(10, lastTime.seconds);
+    ASSERT_EQ(500, lastTime.microseconds);
+
+    sub.reset();
+    ASSERT_FALSE(publisher->hasSubscribers<OSVR_PoseReport>());
+    publisher->publish(now, report);
+    ASSERT_EQ(1u, sensors.size());
+}
+
+TEST(LocalReportDispatcher, UnsubscribesTheRightHandler) {
+    LocalReportDispatcher dispatcher;
+    auto publisher = dispatcher.getPublisher("org_osvr_test/Tracker");
+    int first = 0;
+    int second = 0;
+    auto sub1 = publisher->subscribe<OSVR_PoseReport>(
+        [&](TimeValue const &, OSVR_PoseReport const &) { ++first; });
+    auto sub2 = publisher->subscribe<OSVR_PoseReport>(
+        [&](TimeValue const &, OSVR_PoseReport const &) { ++second; });
+    OSVR_PoseReport report = {};
+    TimeValue now = {};
+    publisher->publish(now, report);
+    sub1.reset();
+    publisher->publish(now, report);
+    ASSERT_EQ(1, first);
+    ASSERT_EQ(2, second);
+}
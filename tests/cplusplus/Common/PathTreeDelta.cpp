@@ -0,0 +1,142 @@
+/** @file
+    @brief Test Implementation
+
+    @date 2017
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2017 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include "DummyTree.h"
+#include "../../../src/osvr/Common/PathTreeNodeSerialization.h"
+#include <osvr/Common/Buffer.h>
+#include <osvr/Common/PathTreeDelta.h>
+#include <osvr/Common/PathTreeSerialization.h>
+
+// Library/third-party includes
+#include "gtest/gtest.h"
+#include <json/value.h>
+
+// Standard includes
+#include <vector>
+
+using osvr::common::PathTree;
+using osvr::common::PathTreeDelta;
+using osvr::common::SerializedNodeMap;
+namespace serialization = osvr::common::serialization;
+
+static SerializedNodeMap serialize(PathTree const &tree) {
+    return osvr::common::mapNodesByPath(osvr::common::pathTreeToJson(tree));
+}
+
+TEST(PathTreeDelta, UnchangedTreeGivesEmptyDelta) {
+    PathTree tree;
+    setupDummyTree(tree);
+    auto nodes = serialize(tree);
+    auto delta = osvr::common::makePathTreeDelta(nodes, nodes, 1, 2);
+    ASSERT_FALSE(delta.isFull());
+    ASSERT_TRUE(delta.empty());
+}
+
+TEST(PathTreeDelta, DeltaReproducesNewTree) {
+    PathTree tree;
+    dummy::setupDummyDevice(tree);
+    tree.getNodeByPath("/removeme", dummy::StringElement("bye"));
+    auto base = serialize(tree);
+
+    PathTree newTree;
+    setupDummyTree(newTree);
+    newTree.getNodeByPath(dummy::getDevicePath()).value() =
+        dummy::DeviceElement::createVRPNDeviceElement(dummy::getDevice(),
+                                                      "otherhost:3883");
+    auto current = serialize(newTree);
+
+    auto delta = osvr::common::makePathTreeDelta(base, current, 1, 2);
+    ASSERT_EQ(1u, delta.removed.size());
+    ASSERT_EQ("/removeme", delta.removed.front());
+    /// The device changed, and the alias is new (with its parent nodes, as
+    /// nulls are left out).
+    ASSERT_LT(delta.upserted.size(), current.size());
+
+    auto applied = base;
+    osvr::common::applyPathTreeDelta(applied, delta);
+    ASSERT_EQ(current, applied);
+}
+
+TEST(PathTreeDelta, FullDeltaReplacesEverything) {
+    PathTree tree;
+    setupDummyTree(tree);
+    auto current = serialize(tree);
+    auto delta = osvr::common::makeFullPathTreeDelta(current, 3);
+    ASSERT_TRUE(delta.isFull());
+
+    SerializedNodeMap stale;
+    stale["/stale"] = Json::Value(Json::objectValue);
+    osvr::common::applyPathTreeDelta(stale, delta);
+    ASSERT_EQ(current, stale);
+}
+
+TEST(PathTreeNodeSerialization, RoundTripsAllMemberKinds) {
+    PathTree tree;
+    setupDummyTree(tree);
+    tree.getNodeByPath("/display", dummy::StringElement("{\"a\": 1}"));
+    std::vector<Json::Value> nodes;
+    for (auto const &node : serialize(tree)) {
+        nodes.push_back(node.second);
+    }
+    Json::Value odd(Json::objectValue);
+    odd["path"] = "/odd";
+    odd["type"] = "FutureElement";
+    odd["int"] = -5;
+    odd["uint"] = Json::UInt(7);
+    odd["real"] = 2.5;
+    odd["flag"] = true;
+    odd["nothing"] = Json::nullValue;
+    odd["object"]["nested"] = Json::arrayValue;
+    nodes.push_back(odd);
+
+    osvr::common::Buffer<> buf;
+    osvr::common::serialization::serializeRaw(
+        buf, nodes, serialization::PathTreeNodeListTag());
+    ASSERT_EQ(buf.size(),
+              serialization::getBufferSpaceRequiredRaw(
+                  0, nodes, serialization::PathTreeNodeListTag()));
+
+    std::vector<Json::Value> decoded;
+    auto reader = buf.startReading();
+    serialization::deserializeRaw(reader, decoded,
+                                  serialization::PathTreeNodeListTag());
+    ASSERT_EQ(nodes, decoded);
+    ASSERT_EQ(0u, reader.bytesRemaining());
+}
+
+TEST(PathTreeNodeSerialization, SmallerThanJson) {
+    PathTree tree;
+    setupDummyTree(tree);
+    auto json = osvr::common::pathTreeToJson(tree);
+    std::vector<Json::Value> nodes(json.begin(), json.end());
+
+    osvr::common::Buffer<> binary;
+    serialization::serializeRaw(binary, nodes,
+                                serialization::PathTreeNodeListTag());
+    osvr::common::Buffer<> text;
+    serialization::serializeRaw(text, json,
+                                serialization::JsonOnlyMessageTag());
+    ASSERT_LT(binary.size(), text.size());
+}
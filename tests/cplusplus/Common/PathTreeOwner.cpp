@@ -0,0 +1,102 @@
+/** @file
+    @brief Test Implementation
+
+    @date 2017
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2017 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include "DummyTree.h"
+#include <osvr/Common/PathTreeObserver.h>
+#include <osvr/Common/PathTreeOwner.h>
+#include <osvr/Common/PathTreeSerialization.h>
+
+// Library/third-party includes
+#include "gtest/gtest.h"
+#include <json/value.h>
+
+// Standard includes
+// - none
+
+using osvr::common::PathTree;
+using osvr::common::PathTreeEvents;
+using osvr::common::PathTreeOwner;
+
+class PathTreeOwnerDiff : public ::testing::Test {
+  public:
+    PathTreeOwnerDiff() : observer(owner.makeObserver()) {
+        observer->setEventCallback(PathTreeEvents::AfterUpdate,
+                                   [&](PathTree &) { ++updates; });
+    }
+
+    static Json::Value serialize(PathTree const &tree) {
+        return osvr::common::pathTreeToJson(tree);
+    }
+
+    PathTreeOwner owner;
+    osvr::common::PathTreeObserverPtr observer;
+    int updates = 0;
+};
+
+TEST_F(PathTreeOwnerDiff, InitialTreeIsAllAdded) {
+    PathTree tree;
+    setupDummyTree(tree);
+    owner.replaceTree(serialize(tree));
+    ASSERT_TRUE(bool(owner));
+    ASSERT_EQ(1, updates);
+    ASSERT_FALSE(owner.getLastDiff().added.empty());
+    ASSERT_EQ(1u, owner.getLastDiff().added.count(dummy::getAlias()));
+    ASSERT_TRUE(owner.getLastDiff().removed.empty());
+    ASSERT_TRUE(owner.getLastDiff().changed.empty());
+}
+
+TEST_F(PathTreeOwnerDiff, IdenticalTreeIsNotAnUpdate) {
+    PathTree tree;
+    setupDummyTree(tree);
+    owner.replaceTree(serialize(tree));
+    owner.replaceTree(serialize(tree));
+    ASSERT_EQ(1, updates);
+}
+
+TEST_F(PathTreeOwnerDiff, AddedRemovedAndChanged) {
+    PathTree tree;
+    setupDummyTree(tree);
+    owner.replaceTree(serialize(tree));
+
+    PathTree updated;
+    dummy::setupDummyDevice(updated);
+    /// Re-point the alias and add a new one; drop nothing else.
+    updated.getNodeByPath(dummy::getAlias(),
+                          dummy::AliasElement(dummy::getInterfacePath()));
+    updated.getNodeByPath("/me/head", dummy::AliasElement(getFullSourcePath()));
+    owner.replaceTree(serialize(updated));
+    ASSERT_EQ(2, updates);
+    auto const &diff = owner.getLastDiff();
+    ASSERT_EQ(1u, diff.changed.size());
+    ASSERT_EQ(1u, diff.changed.count(dummy::getAlias()));
+    ASSERT_EQ(1u, diff.added.count("/me/head"));
+    ASSERT_TRUE(diff.removed.empty());
+
+    /// And back again: the new alias goes away.
+    owner.replaceTree(serialize(tree));
+    ASSERT_EQ(3, updates);
+    ASSERT_EQ(1u, owner.getLastDiff().removed.count("/me/head"));
+    ASSERT_EQ(1u, owner.getLastDiff().changed.count(dummy::getAlias()));
+}
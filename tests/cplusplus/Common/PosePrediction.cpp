@@ -0,0 +1,182 @@
+/** @file
+    @brief Test Implementation
+
+    @date 2017
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2017 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include <osvr/Common/PosePrediction.h>
+#include <osvr/Util/Pose3C.h>
+
+// Library/third-party includes
+#include "gtest/gtest.h"
+
+// Standard includes
+#include <cmath>
+
+using osvr::common::InterfaceState;
+using osvr::common::predictPoseState;
+using osvr::util::time::TimeValue;
+
+static TimeValue makeTime(double seconds) {
+    TimeValue ret;
+    ret.seconds = static_cast<OSVR_TimeValue_Seconds>(std::floor(seconds));
+    ret.microseconds = static_cast<OSVR_TimeValue_Microseconds>(
+        std::round((seconds - ret.seconds) * 1e6));
+    return ret;
+}
+
+static OSVR_PoseReport makePoseReport(double x, double yawRadians) {
+    OSVR_PoseReport report;
+    report.sensor = 0;
+    osvrVec3Zero(&report.pose.translation);
+    osvrVec3SetX(&report.pose.translation, x);
+    osvrQuatSetIdentity(&report.pose.rotation);
+    osvrQuatSetW(&report.pose.rotation, std::cos(yawRadians / 2));
+    osvrQuatSetY(&report.pose.rotation, std::sin(yawRadians / 2));
+    return report;
+}
+
+static double getYaw(OSVR_PoseState const &pose) {
+    return 2 * std::atan2(osvrQuatGetY(&pose.rotation),
+                          osvrQuatGetW(&pose.rotation));
+}
+
+TEST(PosePrediction, NoPose) {
+    InterfaceState state;
+    TimeValue timestamp;
+    OSVR_PoseState pose;
+    ASSERT_FALSE(predictPoseState(state, makeTime(1), timestamp, pose));
+}
+
+TEST(PosePrediction, StationaryWithoutHistory) {
+    InterfaceState state;
+    state.setStateFromReport(makeTime(10), makePoseReport(1, 0.5));
+    TimeValue timestamp;
+    OSVR_PoseState pose;
+    ASSERT_TRUE(predictPoseState(state, makeTime(10.02), timestamp, pose));
+    ASSERT_EQ(10, timestamp.seconds);
+    ASSERT_DOUBLE_EQ(1, osvrVec3GetX(&pose.translation));
+    ASSERT_NEAR(0.5, getYaw(pose), 1e-9);
+}
+
+TEST(PosePrediction, FromVelocityState) {
+    InterfaceState state;
+    state.setStateFromReport(makeTime(10), makePoseReport(1, 0));
+
+    OSVR_VelocityReport vel;
+    vel.sensor = 0;
+    vel.state.linearVelocityValid = OSVR_TRUE;
+    osvrVec3Zero(&vel.state.linearVelocity);
+    osvrVec3SetX(&vel.state.linearVelocity, 2);
+    /// 1 radian per second about +Y, expressed over a 0.1 second step.
+    vel.state.angularVelocityValid = OSVR_TRUE;
+    vel.state.angularVelocity.dt = 0.1;
+    osvrQuatSetIdentity(&vel.state.angularVelocity.incrementalRotation);
+    osvrQuatSetW(&vel.state.angularVelocity.incrementalRotation,
+                 std::cos(0.05));
+    osvrQuatSetY(&vel.state.angularVelocity.incrementalRotation,
+                 std::sin(0.05));
+    state.setStateFromReport(makeTime(10), vel);
+
+    TimeValue timestamp;
+    OSVR_PoseState pose;
+    ASSERT_TRUE(predictPoseState(state, makeTime(10.05), timestamp, pose));
+    ASSERT_NEAR(1.1, osvrVec3GetX(&pose.translation), 1e-6);
+    ASSERT_NEAR(0.05, getYaw(pose), 1e-6);
+
+    /// Target times before the pose get the pose unchanged.
+    ASSERT_TRUE(predictPoseState(state, makeTime(9.9), timestamp, pose));
+    ASSERT_DOUBLE_EQ(1, osvrVec3GetX(&pose.translation));
+
+    /// Prediction is capped.
+    ASSERT_TRUE(predictPoseState(state, makeTime(11), timestamp, pose));
+    ASSERT_NEAR(1 + 2 * osvr::common::MAX_POSE_PREDICTION_INTERVAL,
+                osvrVec3GetX(&pose.translation), 1e-6);
+}
+
+TEST(PosePrediction, FromPoseHistory) {
+    InterfaceState state;
+    state.setStateFromReport(makeTime(10), makePoseReport(0, 0));
+    state.setStateFromReport(makeTime(10.01), makePoseReport(0.01, 0.02));
+
+    TimeValue timestamp;
+    OSVR_PoseState pose;
+    ASSERT_TRUE(predictPoseState(state, makeTime(10.03), timestamp, pose));
+    ASSERT_NEAR(0.03, osvrVec3GetX(&pose.translation), 1e-6);
+    ASSERT_NEAR(0.06, getYaw(pose), 1e-6);
+}
+
+TEST(PosePrediction, FromPoseHistoryWithSignFlip) {
+    InterfaceState state;
+    /// -q is the same orientation as q: the prediction must not change.
+    auto prev = makePoseReport(0, 0);
+    osvrQuatSetW(&prev.pose.rotation, -1);
+    state.setStateFromReport(makeTime(10), prev);
+    state.setStateFromReport(makeTime(10.01), makePoseReport(0.01, 0.02));
+
+    TimeValue timestamp;
+    OSVR_PoseState pose;
+    /// Not a whole multiple of the history interval, so rotating the long
+    /// way around would not happen to land on the same orientation.
+    ASSERT_TRUE(predictPoseState(state, makeTime(10.025), timestamp, pose));
+    ASSERT_NEAR(0.05, getYaw(pose), 1e-6);
+}
+
+TEST(PosePrediction, FromVelocityStateWithSignFlip) {
+    InterfaceState state;
+    state.setStateFromReport(makeTime(10), makePoseReport(0, 0));
+
+    OSVR_VelocityReport vel;
+    vel.sensor = 0;
+    vel.state.linearVelocityValid = OSVR_FALSE;
+    /// The same incremental rotation as in FromVelocityState, negated.
+    vel.state.angularVelocityValid = OSVR_TRUE;
+    vel.state.angularVelocity.dt = 0.1;
+    osvrQuatSetIdentity(&vel.state.angularVelocity.incrementalRotation);
+    osvrQuatSetW(&vel.state.angularVelocity.incrementalRotation,
+                 -std::cos(0.05));
+    osvrQuatSetY(&vel.state.angularVelocity.incrementalRotation,
+                 -std::sin(0.05));
+    state.setStateFromReport(makeTime(10), vel);
+
+    TimeValue timestamp;
+    OSVR_PoseState pose;
+    ASSERT_TRUE(predictPoseState(state, makeTime(10.05), timestamp, pose));
+    ASSERT_NEAR(0.05, getYaw(pose), 1e-6);
+}
+
+TEST(PosePrediction, IgnoresStaleVelocity) {
+    InterfaceState state;
+    OSVR_VelocityReport vel;
+    vel.sensor = 0;
+    vel.state.linearVelocityValid = OSVR_TRUE;
+    vel.state.angularVelocityValid = OSVR_FALSE;
+    osvrVec3Zero(&vel.state.linearVelocity);
+    osvrVec3SetX(&vel.state.linearVelocity, 5);
+    state.setStateFromReport(makeTime(9), vel);
+    state.setStateFromReport(makeTime(10), makePoseReport(1, 0));
+
+    TimeValue timestamp;
+    OSVR_PoseState pose;
+    ASSERT_TRUE(predictPoseState(state, makeTime(10.05), timestamp, pose));
+    ASSERT_DOUBLE_EQ(1, osvrVec3GetX(&pose.translation));
+}
@@ -30,6 +30,7 @@
 
 // Standard includes
 #include <string>
+#include <vector>
 
 using osvr::util::StringID;
 using osvr::util::PeerStringID;
@@ -150,3 +151,31 @@ TEST_F(RegisteredStringMapTest, checkSetupPeerMappings) {
     ASSERT_STREQ("RegVal1", corMap.getStringFromId(corID4).c_str());
     ASSERT_STREQ("RegVal2", corMap.getStringFromId(corID5).c_str());
 }
+
+TEST(RegisteredStringMap, manyEntriesKeepStableIds) {
+    RegisteredStringMap regMap;
+    static const int COUNT = 1000;
+    std::vector<StringID> ids;
+    for (int i = 0; i < COUNT; ++i) {
+        ids.push_back(regMap.registerStringID("Joint" + std::to_string(i)));
+    }
+    ASSERT_EQ(COUNT, regMap.getEntries().size());
+    for (int i = 0; i < COUNT; ++i) {
+        auto name = "Joint" + std::to_string(i);
+        ASSERT_EQ(i, ids[i].value());
+        ASSERT_EQ(ids[i].value(), regMap.getStringID(name).value());
+        ASSERT_EQ(ids[i].value(), regMap.registerStringID(name).value());
+        ASSERT_EQ(name, regMap.getStringFromId(ids[i]));
+    }
+    ASSERT_EQ(COUNT, regMap.getEntries().size());
+    ASSERT_TRUE(regMap.getStringID("Joint1000").empty());
+}
+
+TEST_F(RegisteredStringMapTest, lookupWithoutStdString) {
+    const char *name = "RegVal1";
+    ASSERT_EQ(regID1.value(), regMap.getStringID(name).value());
+    ASSERT_EQ(corID2.value(), corMap.getStringID("CorVal2").value());
+    // A prefix of an existing entry is a different string.
+    ASSERT_TRUE(regMap.getStringID("RegVal").empty());
+    ASSERT_TRUE(regMap.getStringID("").empty());
+}
@@ -0,0 +1,97 @@
+/** @file
+    @brief Test Implementation
+
+    @date 2017
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2017 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include <osvr/Common/ReportLatencyStats.h>
+
+// Library/third-party includes
+#include "gtest/gtest.h"
+
+// Standard includes
+// - none
+
+using osvr::common::ReportLatencyStats;
+using osvr::util::time::TimeValue;
+
+static TimeValue makeTime(std::int64_t usec) {
+    TimeValue ret;
+    ret.seconds = usec / 1000000;
+    ret.microseconds = static_cast<decltype(ret.microseconds)>(usec % 1000000);
+    return ret;
+}
+
+TEST(ReportLatencyStats, Empty) {
+    ReportLatencyStats stats;
+    ASSERT_EQ(0u, stats.getReportCount());
+    ASSERT_EQ(0u, stats.getOutOfOrderCount());
+    ASSERT_EQ(0, stats.getLatencyPercentile(0.5));
+    ASSERT_EQ(0., stats.getReportRate());
+}
+
+TEST(ReportLatencyStats, RateAndPercentiles) {
+    ReportLatencyStats stats;
+    /// 100 reports at 1kHz: 98 of them 500us old, two of them 20ms old.
+    for (int i = 0; i < 100; ++i) {
+        std::int64_t const sent = 10000000 + i * 1000;
+        std::int64_t const age = (i == 10 || i == 50) ? 20000 : 500;
+        stats.recordReport(makeTime(sent), makeTime(sent + age));
+    }
+    ASSERT_EQ(100u, stats.getReportCount());
+    ASSERT_EQ(0u, stats.getOutOfOrderCount());
+    ASSERT_NEAR(1000., stats.getReportRate(), 25.);
+    ASSERT_EQ(20000, stats.getMaxLatency());
+
+    auto const p50 = stats.getLatencyPercentile(0.5);
+    ASSERT_GE(p50, 500);
+    ASSERT_LE(p50, 510);
+    auto const p99 = stats.getLatencyPercentile(0.99);
+    ASSERT_GE(p99, 20000);
+    ASSERT_LE(p99, 21000);
+    ASSERT_EQ(20000, stats.getLatencyPercentile(1.));
+}
+
+TEST(ReportLatencyStats, OutOfOrderAndReset) {
+    ReportLatencyStats stats;
+    stats.recordReport(makeTime(2000), makeTime(3000));
+    stats.recordReport(makeTime(1000), makeTime(3500));
+    stats.recordReport(makeTime(3000), makeTime(4000));
+    ASSERT_EQ(3u, stats.getReportCount());
+    ASSERT_EQ(1u, stats.getOutOfOrderCount());
+
+    stats.reset();
+    ASSERT_EQ(0u, stats.getReportCount());
+    ASSERT_EQ(0u, stats.getOutOfOrderCount());
+    ASSERT_EQ(0, stats.getMaxLatency());
+}
+
+TEST(ReportLatencyStats, ClockSkewAndOverflow) {
+    ReportLatencyStats stats;
+    /// A report "from the future" counts as zero age.
+    stats.recordReport(makeTime(5000), makeTime(4000));
+    ASSERT_EQ(0, stats.getMaxLatency());
+    ASSERT_EQ(0, stats.getLatencyPercentile(0.5));
+    /// Ages beyond the last decade land in the overflow bin.
+    stats.recordReport(makeTime(5000), makeTime(5000 + 3000000));
+    ASSERT_EQ(3000000, stats.getLatencyPercentile(1.));
+}
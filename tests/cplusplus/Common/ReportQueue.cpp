@@ -0,0 +1,89 @@
+/** @file
+    @brief Test Implementation
+
+    @date 2017
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2017 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include <osvr/Common/InterfaceReportQueues.h>
+
+// Library/third-party includes
+#include "gtest/gtest.h"
+
+// Standard includes
+#include <vector>
+
+using osvr::common::ReportQueue;
+using Queue = ReportQueue<OSVR_ButtonReport>;
+
+static OSVR_TimeValue makeTime(int i) {
+    OSVR_TimeValue ret;
+    ret.seconds = i;
+    ret.microseconds = 0;
+    return ret;
+}
+
+static void pushButtons(Queue &q, int first, int count) {
+    for (int i = first; i < first + count; ++i) {
+        OSVR_ButtonReport report;
+        report.sensor = i;
+        report.state = OSVR_BUTTON_PRESSED;
+        q.push(makeTime(i), report);
+    }
+}
+
+static std::vector<int> drainSensors(Queue &q, std::size_t max = 100) {
+    std::vector<int> ret;
+    q.drain(max, [&](Queue::Entry const &entry) {
+        EXPECT_EQ(entry.report.sensor, entry.timestamp.seconds);
+        ret.push_back(entry.report.sensor);
+    });
+    return ret;
+}
+
+TEST(ReportQueue, DisabledByDefault) {
+    Queue q;
+    ASSERT_FALSE(q.enabled());
+    pushButtons(q, 0, 3);
+    ASSERT_EQ(0u, q.size());
+    ASSERT_EQ(0u, q.takeDroppedCount());
+}
+
+TEST(ReportQueue, DrainsInOrder) {
+    Queue q;
+    q.setCapacity(4);
+    pushButtons(q, 0, 3);
+    ASSERT_EQ((std::vector<int>{0, 1}), drainSensors(q, 2));
+    pushButtons(q, 3, 3);
+    ASSERT_EQ((std::vector<int>{2, 3, 4, 5}), drainSensors(q));
+    ASSERT_EQ(0u, q.size());
+    ASSERT_EQ(0u, q.takeDroppedCount());
+}
+
+TEST(ReportQueue, OverwritesOldestWhenFull) {
+    Queue q;
+    q.setCapacity(3);
+    pushButtons(q, 0, 5);
+    ASSERT_EQ(3u, q.size());
+    ASSERT_EQ(2u, q.takeDroppedCount());
+    ASSERT_EQ(0u, q.takeDroppedCount());
+    ASSERT_EQ((std::vector<int>{2, 3, 4}), drainSensors(q));
+}
@@ -0,0 +1,106 @@
+/** @file
+    @brief Test Implementation
+
+    @date 2017
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2017 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include <osvr/Common/RigidTransform.h>
+#include <osvr/Common/Transform.h>
+
+// Library/third-party includes
+#include "gtest/gtest.h"
+
+// Standard includes
+// - none
+
+using osvr::common::RigidTransform;
+using osvr::common::Transform;
+
+static Eigen::Matrix4d makeRigid(double degrees, Eigen::Vector3d const &axis,
+                                 Eigen::Vector3d const &xlate) {
+    return (Eigen::Translation3d(xlate) *
+            Eigen::AngleAxisd(osvr::common::degreesToRadians(degrees),
+                              axis.normalized()))
+        .matrix();
+}
+
+class RigidTransformTest : public ::testing::Test {
+  public:
+    RigidTransformTest()
+        : xform(makeRigid(30, Eigen::Vector3d(1, 2, 3),
+                          Eigen::Vector3d(0.1, -0.2, 0.3)),
+                makeRigid(-75, Eigen::Vector3d(0, 1, 0.5),
+                          Eigen::Vector3d(1, 0, -2))) {
+        /// Compose with another, as is done with the room to world transform
+        xform.transform(Transform(
+            Eigen::Matrix4d::Identity(),
+            makeRigid(90, Eigen::Vector3d::UnitY(), Eigen::Vector3d(0, 1, 0))));
+    }
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+    Transform xform;
+};
+
+TEST_F(RigidTransformTest, PoseMatchesMatrixTransform) {
+    RigidTransform rigid;
+    ASSERT_TRUE(rigid.assign(xform));
+
+    Eigen::Quaterniond rot(
+        Eigen::AngleAxisd(0.7, Eigen::Vector3d(1, 1, 0).normalized()));
+    Eigen::Vector3d xlate(0.5, 1.5, -0.25);
+    Eigen::Isometry3d pose = Eigen::Translation3d(xlate) * rot;
+    Eigen::Isometry3d expected(xform.transform(pose.matrix()));
+
+    rigid.transformPose(rot, xlate);
+    ASSERT_TRUE(xlate.isApprox(expected.translation()));
+    ASSERT_TRUE(rot.isApprox(Eigen::Quaterniond(expected.rotation())) ||
+                rot.coeffs().isApprox(
+                    -Eigen::Quaterniond(expected.rotation()).coeffs()));
+}
+
+TEST_F(RigidTransformTest, DerivativesMatchMatrixTransform) {
+    RigidTransform rigid;
+    ASSERT_TRUE(rigid.assign(xform));
+
+    Eigen::Vector3d vel(1, -2, 0.5);
+    Eigen::Vector3d expectedVel = xform.transformDerivative(vel);
+    ASSERT_TRUE(rigid.transformDerivative(vel).isApprox(expectedVel));
+
+    Eigen::Quaterniond inc(
+        Eigen::AngleAxisd(0.01, Eigen::Vector3d(0, 0.3, 1).normalized()));
+    auto actual = rigid.transformDerivative(inc);
+    auto expected = xform.transformDerivative(inc);
+    ASSERT_TRUE(actual.isApprox(expected) ||
+                actual.coeffs().isApprox(-expected.coeffs()));
+}
+
+TEST(RigidTransform, RejectsScaling) {
+    Eigen::Matrix4d scaled = Eigen::Matrix4d::Identity();
+    scaled.topLeftCorner<3, 3>() *= 2.;
+    RigidTransform rigid;
+    ASSERT_FALSE(rigid.assign(Transform(scaled, Eigen::Matrix4d::Identity())));
+    ASSERT_FALSE(rigid.assign(Transform(Eigen::Matrix4d::Identity(), scaled)));
+
+    Eigen::Matrix4d mirrored = Eigen::Matrix4d::Identity();
+    mirrored(0, 0) = -1.;
+    ASSERT_FALSE(
+        rigid.assign(Transform(Eigen::Matrix4d::Identity(), mirrored)));
+}
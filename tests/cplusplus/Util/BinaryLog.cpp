@@ -0,0 +1,149 @@
+/** @file
+    @brief Test Implementation
+
+    @date 2017
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2017 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// Internal Includes
+#include <osvr/Util/BinaryLog.h>
+
+// Library/third-party includes
+#include "gtest/gtest.h"
+
+// Standard includes
+#include <string>
+#include <thread>
+#include <vector>
+
+using osvr::util::log::BinaryLogRecord;
+using osvr::util::log::LogLevel;
+using osvr::util::log::flushBinaryLogs;
+using osvr::util::log::formatBinaryLogRecord;
+using osvr::util::log::makeBinaryLogger;
+using osvr::util::log::setBinaryLogHandler;
+
+/// @brief Collects the formatted messages handled, by logger name.
+class BinaryLog : public ::testing::Test {
+  public:
+    BinaryLog() {
+        flushBinaryLogs();
+        setBinaryLogHandler(
+            [&](std::string const &name, BinaryLogRecord const &record) {
+                names.push_back(name);
+                messages.push_back(formatBinaryLogRecord(record));
+            });
+    }
+    ~BinaryLog() { setBinaryLogHandler(nullptr); }
+    std::vector<std::string> names;
+    std::vector<std::string> messages;
+};
+
+TEST_F(BinaryLog, FormatsArguments) {
+    auto logger = makeBinaryLogger("org_osvr_test/binlog");
+    int const *ptr = nullptr;
+    OSVR_BINARY_LOG(*logger, LogLevel::info,
+                    "sensor {} at {} seen={} by {}: {} {}", 3, 1.5, true,
+                    std::string("camera"), -7, ptr);
+    OSVR_BINARY_LOG(*logger, LogLevel::info, "no arguments {}");
+    flushBinaryLogs();
+    ASSERT_EQ(2u, messages.size());
+    ASSERT_EQ("org_osvr_test/binlog", names[0]);
+    /// Null pointer formatting varies by platform, so check up to it.
+    ASSERT_EQ(0u, messages[0].find("sensor 3 at 1.5 seen=true by camera: -7 "));
+    ASSERT_EQ("no arguments {}", messages[1]);
+}
+
+TEST_F(BinaryLog, TruncatesLongText) {
+    auto logger = makeBinaryLogger("org_osvr_test/binlog");
+    std::string longText(200, 'x');
+    OSVR_BINARY_LOG(*logger, LogLevel::info, "[{}][{}]", longText, "more");
+    flushBinaryLogs();
+    ASSERT_EQ(1u, messages.size());
+    ASSERT_EQ("[" +
+                  std::string(osvr::util::log::BINARY_LOG_TEXT_BYTES, 'x') +
+                  "][]",
+              messages[0]);
+}
+
+TEST_F(BinaryLog, FiltersByLevel) {
+    auto logger = makeBinaryLogger("org_osvr_test/binlog");
+    logger->setLogLevel(LogLevel::warn);
+    OSVR_BINARY_LOG(*logger, LogLevel::info, "dropped");
+    OSVR_BINARY_LOG(*logger, LogLevel::error, "kept");
+    flushBinaryLogs();
+    ASSERT_EQ(1u, messages.size());
+    ASSERT_EQ("kept", messages[0]);
+}
+
+TEST_F(BinaryLog, RateLimits) {
+    auto logger = makeBinaryLogger("org_osvr_test/binlog");
+    logger->setRateLimit(5);
+    for (int i = 0; i < 20; ++i) {
+        OSVR_BINARY_LOG(*logger, LogLevel::info, "message {}", i);
+    }
+    flushBinaryLogs();
+    /// Could straddle a second boundary, letting through another batch.
+    ASSERT_GE(messages.size(), 5u);
+    ASSERT_LE(messages.size(), 10u);
+    ASSERT_EQ(20u, messages.size() + logger->getSuppressedCount());
+    ASSERT_EQ("message 0", messages[0]);
+}
+
+TEST_F(BinaryLog, CollectsFromManyThreads) {
+    auto logger = makeBinaryLogger("org_osvr_test/binlog");
+    static const int THREADS = 4;
+    static const int MESSAGES = 100;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < THREADS; ++t) {
+        threads.emplace_back([&] {
+            for (int i = 0; i < MESSAGES; ++i) {
+                OSVR_BINARY_LOG(*logger, LogLevel::info, "message {}", i);
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    flushBinaryLogs();
+    ASSERT_EQ(std::size_t(THREADS * MESSAGES), messages.size());
+}
+
+TEST_F(BinaryLog, ReusesQueuesOfExitedThreads) {
+    auto logger = makeBinaryLogger("org_osvr_test/binlog");
+    static const int THREADS = 50;
+    static const int MESSAGES = 10;
+    /// Each thread likely takes over the last one's queue before it has been
+    /// drained: nothing may be lost or reordered.
+    for (int t = 0; t < THREADS; ++t) {
+        std::thread([&] {
+            for (int i = 0; i < MESSAGES; ++i) {
+                OSVR_BINARY_LOG(*logger, LogLevel::info, "message {}",
+                                t * MESSAGES + i);
+            }
+        }).join();
+    }
+    flushBinaryLogs();
+    ASSERT_EQ(std::size_t(THREADS * MESSAGES), messages.size());
+    for (int i = 0; i < THREADS * MESSAGES; ++i) {
+        ASSERT_EQ("message " + std::to_string(i), messages[i]);
+    }
+}
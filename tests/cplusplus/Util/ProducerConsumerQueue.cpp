@@ -0,0 +1,101 @@
+/** @file
+    @brief Test Implementation
+
+    @date 2017
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+
+*/
+
+// Copyright 2017 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include <osvr/Util/ProducerConsumerQueue.h>
+
+// Library/third-party includes
+#include "gtest/gtest.h"
+#include <boost/thread.hpp>
+
+// Standard includes
+#include <stdexcept>
+#include <vector>
+
+using osvr::util::ProducerConsumerQueue;
+
+TEST(ProducerConsumerQueue, ZeroCapacityRejected) {
+    ASSERT_THROW(ProducerConsumerQueue<int>(0), std::invalid_argument);
+}
+
+TEST(ProducerConsumerQueue, FillAndEmpty) {
+    ProducerConsumerQueue<int> q(3);
+    ASSERT_EQ(3u, q.capacity());
+    ASSERT_TRUE(q.empty());
+    int out = 0;
+    ASSERT_FALSE(q.tryRead([&](int &v) { out = v; }));
+
+    ASSERT_TRUE(q.write(1));
+    ASSERT_TRUE(q.write(2));
+    ASSERT_TRUE(q.write(3));
+    ASSERT_FALSE(q.write(4)) << "Queue should be full";
+    ASSERT_EQ(3u, q.sizeGuess());
+
+    ASSERT_TRUE(q.tryRead([&](int &v) { out = v; }));
+    ASSERT_EQ(1, out);
+    ASSERT_TRUE(q.write(4)) << "Reading should have freed a slot";
+
+    std::vector<int> drained;
+    ASSERT_EQ(3u, q.drain([&](int &v) { drained.push_back(v); }));
+    ASSERT_EQ((std::vector<int>{2, 3, 4}), drained);
+    ASSERT_TRUE(q.empty());
+}
+
+TEST(ProducerConsumerQueue, SlotsReusedInPlace) {
+    ProducerConsumerQueue<std::vector<char> > q(1);
+    ASSERT_TRUE(q.tryWrite([](std::vector<char> &v) { v.assign(100, 'a'); }));
+    ASSERT_TRUE(q.tryRead([](std::vector<char> &) {}));
+    /// With one slot of capacity plus the sentinel, the third write lands in
+    /// the first slot again.
+    ASSERT_TRUE(q.tryWrite([](std::vector<char> &v) { v.assign(1, 'b'); }));
+    ASSERT_TRUE(q.tryRead([](std::vector<char> &) {}));
+    ASSERT_TRUE(q.tryWrite([](std::vector<char> &v) {
+        ASSERT_GE(v.capacity(), 100u);
+        v.assign(1, 'c');
+    }));
+}
+
+TEST(ProducerConsumerQueue, TwoThreadsInOrder) {
+    static const int COUNT = 10000;
+    ProducerConsumerQueue<int> q(16);
+    boost::thread producer([&] {
+        for (int i = 0; i < COUNT; ++i) {
+            while (!q.write(i)) {
+                boost::this_thread::yield();
+            }
+        }
+    });
+    int expected = 0;
+    bool inOrder = true;
+    while (expected < COUNT) {
+        q.drain([&](int &v) {
+            inOrder = inOrder && (v == expected);
+            ++expected;
+        });
+    }
+    producer.join();
+    ASSERT_TRUE(inOrder);
+    ASSERT_TRUE(q.empty());
+}
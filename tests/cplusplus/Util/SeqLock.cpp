@@ -0,0 +1,87 @@
+/** @file
+    @brief Test Implementation
+
+    @date 2017
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2017 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// Internal Includes
+#include <osvr/Util/SeqLock.h>
+
+// Library/third-party includes
+#include "gtest/gtest.h"
+#include <boost/thread.hpp>
+
+// Standard includes
+#include <atomic>
+
+using osvr::util::SeqLock;
+
+namespace {
+struct Pair {
+    int a;
+    int b;
+};
+} // namespace
+
+TEST(SeqLock, DefaultValueInitialized) {
+    SeqLock<Pair> lock;
+    auto val = lock.load();
+    ASSERT_EQ(0, val.a);
+    ASSERT_EQ(0, val.b);
+    ASSERT_EQ(0u, lock.version());
+}
+
+TEST(SeqLock, StoreThenLoad) {
+    SeqLock<Pair> lock(Pair{1, 2});
+    ASSERT_EQ(1, lock.load().a);
+    lock.store(Pair{3, 4});
+    Pair val;
+    ASSERT_TRUE(lock.tryLoad(val)) << "No writer active, so no retry needed";
+    ASSERT_EQ(3, val.a);
+    ASSERT_EQ(4, val.b);
+    ASSERT_EQ(1u, lock.version());
+}
+
+TEST(SeqLock, ReaderNeverSeesTornValue) {
+    static const int COUNT = 100000;
+    SeqLock<Pair> lock;
+    std::atomic<bool> done(false);
+    boost::thread writer([&] {
+        for (int i = 1; i <= COUNT; ++i) {
+            lock.store(Pair{i, -i});
+        }
+        done = true;
+    });
+    bool consistent = true;
+    int last = 0;
+    bool monotonic = true;
+    while (!done) {
+        auto val = lock.load();
+        consistent = consistent && (val.a == -val.b);
+        monotonic = monotonic && (val.a >= last);
+        last = val.a;
+    }
+    writer.join();
+    ASSERT_TRUE(consistent);
+    ASSERT_TRUE(monotonic);
+    ASSERT_EQ(COUNT, lock.load().a);
+}